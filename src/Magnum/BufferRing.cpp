@@ -0,0 +1,56 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BufferRing.h"
+
+namespace Magnum {
+
+BufferRing::BufferRing(const std::size_t count, const Buffer::TargetHint targetHint): _capacities(count), _current{count - 1} {
+    CORRADE_ASSERT(count, "BufferRing::BufferRing(): expected at least one buffer", );
+
+    _buffers.reserve(count);
+    for(std::size_t i = 0; i != count; ++i)
+        _buffers.emplace_back(targetHint);
+}
+
+std::size_t BufferRing::setData(const Containers::ArrayView<const void> data, const BufferUsage usage) {
+    _current = (_current + 1) % _buffers.size();
+    Buffer& buffer = _buffers[_current];
+
+    /* Orphan the storage and fill it anew if the data fit, otherwise
+       reallocate. Only the data size is needed for the draw, so keeping the
+       larger storage avoids reallocations when the size fluctuates. */
+    if(data.size() <= _capacities[_current]) {
+        buffer.setData({nullptr, _capacities[_current]}, usage);
+        buffer.setSubData(0, data);
+    } else {
+        buffer.setData(data, usage);
+        _capacities[_current] = data.size();
+    }
+
+    return _current;
+}
+
+}
@@ -0,0 +1,173 @@
+#ifndef Magnum_BufferRing_h
+#define Magnum_BufferRing_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::BufferRing
+ */
+
+#include <vector>
+
+#include "Magnum/Buffer.h"
+
+namespace Magnum {
+
+/**
+@brief Ring of buffers for streamed data
+
+Owns a fixed number of @ref Buffer instances and rotates through them on each
+@ref setData() call, orphaning the storage of the buffer before it is filled
+again. This is useful for data that are uploaded anew every frame, such as
+per-instance transformations --- the driver doesn't need to wait until draws
+from previous frames that still source from the buffer are finished, as each
+upload goes to a different buffer and gets fresh storage.
+
+## Instanced drawing
+
+Because attribute bindings of a @ref Mesh refer to a particular buffer, the
+usual approach is to have one mesh for each buffer in the ring, sharing the
+same vertex data and differing only in the buffer with instance data attached
+using @ref Mesh::addVertexBufferInstanced(). After each @ref setData() the mesh
+corresponding to @ref current() is drawn:
+@code
+Buffer vertices;
+BufferRing instances{3};
+Mesh meshes[3];
+for(std::size_t i = 0; i != instances.count(); ++i) {
+    meshes[i].setPrimitive(MeshPrimitive::Triangles)
+        .setCount(36)
+        .addVertexBuffer(vertices, 0, MyShader::Position{})
+        .addVertexBufferInstanced(instances[i], 1, 0, MyShader::TransformationMatrix{});
+}
+
+// Each frame
+std::vector<Matrix4> transformations = ...;
+instances.setData(transformations, BufferUsage::StreamDraw);
+meshes[instances.current()]
+    .setInstanceCount(transformations.size())
+    .draw(shader);
+@endcode
+
+The ring is used by @ref SceneGraph::Drawable::drawInstanced() in the
+@ref SceneGraph-Drawable-instancing "drawable instancing" example.
+
+@anchor BufferRing-buffer-storage
+## Buffer storage
+
+Each buffer keeps the largest storage it ever had. If new data fit into it,
+the storage is orphaned by calling @ref Buffer::setData() with `nullptr` and
+the same size and the data are uploaded using @ref Buffer::setSubData(),
+otherwise the buffer is reallocated with the new data. The size of the buffer
+thus might be larger than the size of data last uploaded to it, use the size
+of the uploaded data for the draw.
+
+@see @ref Buffer::invalidateData()
+*/
+class MAGNUM_EXPORT BufferRing {
+    public:
+        /**
+         * @brief Constructor
+         * @param count         Buffer count, expected to be non-zero
+         * @param targetHint    Target hint for all buffers, see
+         *      @ref Buffer::setTargetHint() for more information
+         *
+         * Creates @p count OpenGL buffer objects. Three buffers are usually
+         * enough for data uploaded every frame.
+         */
+        explicit BufferRing(std::size_t count, Buffer::TargetHint targetHint = Buffer::TargetHint::Array);
+
+        /** @brief Copying is not allowed */
+        BufferRing(const BufferRing&) = delete;
+
+        /** @brief Move constructor */
+        BufferRing(BufferRing&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        BufferRing& operator=(const BufferRing&) = delete;
+
+        /** @brief Move assignment */
+        BufferRing& operator=(BufferRing&&) noexcept = default;
+
+        /** @brief Buffer count */
+        std::size_t count() const { return _buffers.size(); }
+
+        /**
+         * @brief ID of current buffer
+         *
+         * ID of the buffer which received data in last @ref setData() call.
+         * Initially it's the last buffer, so the first call fills the buffer
+         * with ID `0`.
+         */
+        std::size_t current() const { return _current; }
+
+        /** @brief Buffer with given ID */
+        Buffer& operator[](std::size_t id) {
+            CORRADE_ASSERT(id < _buffers.size(), "BufferRing::operator[](): index out of range", _buffers[0]);
+            return _buffers[id];
+        }
+
+        /** @brief Current buffer */
+        Buffer& currentBuffer() { return _buffers[_current]; }
+
+        /**
+         * @brief Storage size of buffer with given ID
+         *
+         * Size of the data the buffer was last allocated with. Unlike
+         * @ref Buffer::size() it doesn't query the driver.
+         */
+        std::size_t capacity(std::size_t id) const {
+            CORRADE_ASSERT(id < _capacities.size(), "BufferRing::capacity(): index out of range", 0);
+            return _capacities[id];
+        }
+
+        /**
+         * @brief Set data of next buffer
+         * @param data          Data
+         * @param usage         Buffer usage
+         * @return ID of the buffer which received the data
+         *
+         * Advances @ref current() to the next buffer in the ring, orphans its
+         * storage and fills it with @p data. See
+         * @ref BufferRing-buffer-storage "class documentation" for more
+         * information.
+         * @see @ref currentBuffer()
+         */
+        std::size_t setData(Containers::ArrayView<const void> data, BufferUsage usage);
+
+        /** @overload */
+        template<class T> std::size_t setData(const std::vector<T>& data, BufferUsage usage) {
+            return setData({data.data(), data.size()}, usage);
+        }
+
+    private:
+        std::vector<Buffer> _buffers;
+        std::vector<std::size_t> _capacities;
+        std::size_t _current;
+};
+
+}
+
+#endif
@@ -99,6 +99,39 @@ Magnum contexts. Enabled by default.
 #define MAGNUM_BUILD_MULTITHREADED
 #undef MAGNUM_BUILD_MULTITHREADED
 
+/**
+@brief SIMD build
+
+Defined if the library is built with SIMD-accelerated math operations. The
+actual instruction set is then detected from compiler flags, see
+@ref MAGNUM_TARGET_SSE and @ref MAGNUM_TARGET_NEON. Disabled by default.
+@see @ref building, @ref cmake
+*/
+#define MAGNUM_BUILD_SIMD
+#undef MAGNUM_BUILD_SIMD
+
+/**
+@brief SSE target
+
+Defined if @ref MAGNUM_BUILD_SIMD is enabled and the compiler targets SSE (e.g.
+any x86-64 target). Vector and matrix operations on four-component
+@ref Magnum::Float "Float" types are then implemented using SSE intrinsics.
+@see @ref MAGNUM_TARGET_NEON
+*/
+#define MAGNUM_TARGET_SSE
+#undef MAGNUM_TARGET_SSE
+
+/**
+@brief NEON target
+
+Defined if @ref MAGNUM_BUILD_SIMD is enabled and the compiler targets ARM NEON.
+Vector and matrix operations on four-component @ref Magnum::Float "Float"
+types are then implemented using NEON intrinsics.
+@see @ref MAGNUM_TARGET_SSE
+*/
+#define MAGNUM_TARGET_NEON
+#undef MAGNUM_TARGET_NEON
+
 /**
 @brief OpenGL ES target
 
@@ -326,6 +359,9 @@ typedef Math::Quaternion<Float> Quaternion;
 /** @brief Float dual quaternion */
 typedef Math::DualQuaternion<Float> DualQuaternion;
 
+/** @brief Float frustum */
+typedef Math::Frustum<Float> Frustum;
+
 /** @brief Float constants */
 typedef Math::Constants<Float> Constants;
 
@@ -447,6 +483,9 @@ typedef Math::Quaternion<Double> Quaterniond;
 /** @brief Double dual quaternion */
 typedef Math::DualQuaternion<Double> DualQuaterniond;
 
+/** @brief Double frustum */
+typedef Math::Frustum<Double> Frustumd;
+
 /** @brief Double constants */
 typedef Math::Constants<Double> Constantsd;
 
@@ -494,6 +533,7 @@ template<UnsignedInt, class> class Attribute;
 
 enum class BufferUsage: GLenum;
 class Buffer;
+class BufferRing;
 
 #ifndef MAGNUM_TARGET_GLES2
 template<UnsignedInt> class BufferImage;
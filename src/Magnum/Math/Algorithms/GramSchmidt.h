@@ -40,8 +40,10 @@ namespace Magnum { namespace Math { namespace Algorithms {
 template<std::size_t cols, std::size_t rows, class T> void gramSchmidtOrthogonalizeInPlace(RectangularMatrix<cols, rows, T>& matrix) {
     static_assert(cols <= rows, "Unsupported matrix aspect ratio");
     for(std::size_t i = 0; i != cols; ++i) {
+        /* Squared length of the vector doesn't change in the inner loop */
+        const T lengthSquared = matrix[i].dot();
         for(std::size_t j = i+1; j != cols; ++j)
-            matrix[j] -= matrix[j].projected(matrix[i]);
+            matrix[j] -= matrix[i]*(Math::dot(matrix[j], matrix[i])/lengthSquared);
     }
 }
 
@@ -0,0 +1,60 @@
+#ifndef Magnum_Math_Algorithms_PolarDecomposition_h
+#define Magnum_Math_Algorithms_PolarDecomposition_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Algorithms::polarDecomposition()
+ */
+
+#include "Magnum/Math/Algorithms/Svd.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+/**
+@brief Polar decomposition of a 3x3 matrix
+
+Decomposes the matrix into a rotation @f$ R @f$ and a symmetric stretch
+@f$ S @f$ so that @f[
+    M = R S
+@f]
+Calculated from @ref svd3x3() as @f$ R = U V^T @f$ and
+@f$ S = V \Sigma V^T @f$, see its documentation for accuracy and performance
+notes. The rotation always has determinant @f$ 1 @f$, so if the determinant
+of @f$ M @f$ is negative, the reflection is contained in @f$ S @f$. Returns
+the rotation first and the stretch second.
+*/
+template<class T> std::pair<Matrix<3, T>, Matrix<3, T>> polarDecomposition(const Matrix<3, T>& matrix) {
+    Matrix<3, T> u{NoInit}, v{NoInit};
+    Vector<3, T> w{NoInit};
+    std::tie(u, w, v) = svd3x3(matrix);
+
+    const Matrix<3, T> vt = v.transposed();
+    return {u*vt, v*Matrix<3, T>::fromDiagonal(w)*vt};
+}
+
+}}}
+
+#endif
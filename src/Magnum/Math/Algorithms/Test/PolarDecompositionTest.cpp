@@ -0,0 +1,92 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Algorithms/PolarDecomposition.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+struct PolarDecompositionTest: Corrade::TestSuite::Tester {
+    explicit PolarDecompositionTest();
+
+    void test();
+    void rotationScaling();
+    void reflection();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Matrix<3, Float> Matrix3x3;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Vector3<Float> Vector3;
+
+PolarDecompositionTest::PolarDecompositionTest() {
+    addTests({&PolarDecompositionTest::test,
+              &PolarDecompositionTest::rotationScaling,
+              &PolarDecompositionTest::reflection});
+}
+
+void PolarDecompositionTest::test() {
+    const Matrix3x3 a{Vector3{ 2.0f, -1.0f,  3.0f},
+                      Vector3{ 4.0f,  7.0f, -2.0f},
+                      Vector3{-5.0f,  1.0f,  6.0f}};
+
+    Matrix3x3 r, s;
+    std::tie(r, s) = Algorithms::polarDecomposition(a);
+
+    CORRADE_COMPARE(r*s, a);
+    CORRADE_COMPARE(r*r.transposed(), Matrix3x3{IdentityInit});
+    CORRADE_COMPARE(r.determinant(), 1.0f);
+    CORRADE_COMPARE(s, s.transposed());
+}
+
+void PolarDecompositionTest::rotationScaling() {
+    /* Rotation with non-uniform scaling along the rotated axes is
+       decomposed back */
+    const Matrix3x3 rotation = Matrix4::rotation(Deg(35.0f), Vector3{1.0f, -1.0f, 2.0f}.normalized()).rotationScaling();
+    const Matrix3x3 scaling = Matrix3x3::fromDiagonal({2.0f, 0.5f, 1.0f});
+
+    Matrix3x3 r, s;
+    std::tie(r, s) = Algorithms::polarDecomposition(rotation*scaling);
+    CORRADE_COMPARE(r, rotation);
+    CORRADE_COMPARE(s, scaling);
+}
+
+void PolarDecompositionTest::reflection() {
+    /* Mirroring can't be represented by a rotation, so it ends up in the
+       stretch */
+    const Matrix3x3 a = Matrix3x3::fromDiagonal({1.0f, -2.0f, 3.0f});
+
+    Matrix3x3 r, s;
+    std::tie(r, s) = Algorithms::polarDecomposition(a);
+    CORRADE_COMPARE(r*s, a);
+    CORRADE_COMPARE(r.determinant(), 1.0f);
+    CORRADE_COMPARE(s.determinant(), a.determinant());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::PolarDecompositionTest)
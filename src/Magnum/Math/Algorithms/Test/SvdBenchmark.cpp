@@ -0,0 +1,133 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Algorithms/PolarDecomposition.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+struct SvdBenchmark: Corrade::TestSuite::Tester {
+    explicit SvdBenchmark();
+
+    void svd();
+    void svd3x3();
+    void polarDecompositionSvd();
+    void polarDecomposition();
+};
+
+typedef Math::Matrix<3, Float> Matrix3x3;
+typedef Math::Vector3<Float> Vector3;
+
+namespace {
+    enum: std::size_t {
+        Count = 1000,
+        Repeats = 10
+    };
+
+    Corrade::Containers::Array<Matrix3x3> matrices() {
+        Corrade::Containers::Array<Matrix3x3> out{Count};
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Matrix3x3{Vector3{Float(i%7) - 3.0f, 1.0f, 0.5f},
+                               Vector3{0.25f, Float(i%5) + 1.0f, -2.0f},
+                               Vector3{1.5f, -1.0f, Float(i%3) - 1.5f}};
+        return out;
+    }
+}
+
+SvdBenchmark::SvdBenchmark() {
+    addBenchmarks({&SvdBenchmark::svd,
+                   &SvdBenchmark::svd3x3,
+                   &SvdBenchmark::polarDecompositionSvd,
+                   &SvdBenchmark::polarDecomposition}, 10);
+}
+
+/* The decomposed matrix is reconstructed back in-place to avoid the compiler
+   optimizing the repeated runs away */
+
+void SvdBenchmark::svd() {
+    Corrade::Containers::Array<Matrix3x3> data = matrices();
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Count; ++i) {
+            RectangularMatrix<3, 3, Float> u;
+            Vector3 w;
+            Matrix3x3 v;
+            std::tie(u, w, v) = Algorithms::svd(RectangularMatrix<3, 3, Float>{data[i]});
+            data[i] = Matrix3x3{u*RectangularMatrix<3, 3, Float>::fromDiagonal(w)*v.transposed()};
+        }
+    }
+
+    CORRADE_VERIFY(data[Count - 1][0].sum() != 0.0f);
+}
+
+void SvdBenchmark::svd3x3() {
+    Corrade::Containers::Array<Matrix3x3> data = matrices();
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Count; ++i) {
+            Matrix3x3 u{NoInit}, v{NoInit};
+            Vector3 w{NoInit};
+            std::tie(u, w, v) = Algorithms::svd3x3(data[i]);
+            data[i] = u*Matrix3x3::fromDiagonal(w)*v.transposed();
+        }
+    }
+
+    CORRADE_VERIFY(data[Count - 1][0].sum() != 0.0f);
+}
+
+/* Polar decomposition calculated using the generic SVD, for comparison */
+void SvdBenchmark::polarDecompositionSvd() {
+    Corrade::Containers::Array<Matrix3x3> data = matrices();
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Count; ++i) {
+            RectangularMatrix<3, 3, Float> u;
+            Vector3 w;
+            Matrix3x3 v;
+            std::tie(u, w, v) = Algorithms::svd(RectangularMatrix<3, 3, Float>{data[i]});
+            const Matrix3x3 vt = v.transposed();
+            data[i] = Matrix3x3{u*vt}*(v*Matrix3x3::fromDiagonal(w)*vt);
+        }
+    }
+
+    CORRADE_VERIFY(data[Count - 1][0].sum() != 0.0f);
+}
+
+void SvdBenchmark::polarDecomposition() {
+    Corrade::Containers::Array<Matrix3x3> data = matrices();
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Count; ++i) {
+            Matrix3x3 r{NoInit}, s{NoInit};
+            std::tie(r, s) = Algorithms::polarDecomposition(data[i]);
+            data[i] = r*s;
+        }
+    }
+
+    CORRADE_VERIFY(data[Count - 1][0].sum() != 0.0f);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::SvdBenchmark)
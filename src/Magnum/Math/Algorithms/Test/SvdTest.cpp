@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Algorithms/Svd.h"
@@ -33,6 +34,9 @@ struct SvdTest: Corrade::TestSuite::Tester {
     explicit SvdTest();
 
     template<class T> void test();
+    template<class T> void test3x3();
+    void test3x3Reflection();
+    void test3x3Degenerate();
 };
 
 template<class T> using Matrix5x8 = RectangularMatrix<5, 8, T>;
@@ -40,10 +44,16 @@ template<class T> using Matrix8 = Matrix<8, T>;
 template<class T> using Matrix5 = Matrix<5, T>;
 template<class T> using Vector8 = Vector<8, T>;
 template<class T> using Vector5 = Vector<5, T>;
+template<class T> using Matrix3x3 = Matrix<3, T>;
+template<class T> using Vector3 = Vector<3, T>;
 
 SvdTest::SvdTest() {
     addTests<SvdTest>({&SvdTest::test<Float>,
-                       &SvdTest::test<Double>});
+                       &SvdTest::test<Double>,
+                       &SvdTest::test3x3<Float>,
+                       &SvdTest::test3x3<Double>,
+                       &SvdTest::test3x3Reflection,
+                       &SvdTest::test3x3Degenerate});
 }
 
 template<class T> void SvdTest::test() {
@@ -75,6 +85,75 @@ template<class T> void SvdTest::test() {
     CORRADE_COMPARE(w, expected);
 }
 
+template<class T> void SvdTest::test3x3() {
+    setTestCaseName(std::is_same<T, Double>::value ? "test3x3<Double>" : "test3x3<Float>");
+
+    const Matrix3x3<T> a{
+        Vector3<T>{T{ 2}, T{-1}, T{ 3}},
+        Vector3<T>{T{ 4}, T{ 7}, T{-2}},
+        Vector3<T>{T{-5}, T{ 1}, T{ 6}}};
+
+    Matrix3x3<T> u{NoInit}, v{NoInit};
+    Vector3<T> w{NoInit};
+    std::tie(u, w, v) = Algorithms::svd3x3(a);
+
+    /* Test composition */
+    CORRADE_COMPARE(u*Matrix3x3<T>::fromDiagonal(w)*v.transposed(), a);
+
+    /* Test that U and V are rotations */
+    CORRADE_COMPARE(u*u.transposed(), Matrix3x3<T>{IdentityInit});
+    CORRADE_COMPARE(v*v.transposed(), Matrix3x3<T>{IdentityInit});
+    CORRADE_COMPARE(u.determinant(), T(1));
+    CORRADE_COMPARE(v.determinant(), T(1));
+
+    /* Test W against the generic implementation, sorted */
+    RectangularMatrix<3, 3, T> u2;
+    Vector3<T> w2;
+    Matrix3x3<T> v2;
+    std::tie(u2, w2, v2) = Algorithms::svd(RectangularMatrix<3, 3, T>{a});
+    std::sort(w2.data(), w2.data() + 3, [](T a, T b) { return a > b; });
+    CORRADE_COMPARE(w, w2);
+}
+
+void SvdTest::test3x3Reflection() {
+    const Matrix3x3<Float> a{
+        Vector3<Float>{-1.0f, 0.0f, 0.0f},
+        Vector3<Float>{ 0.0f, 3.0f, 0.0f},
+        Vector3<Float>{ 0.0f, 0.0f, 2.0f}};
+
+    Matrix3x3<Float> u{NoInit}, v{NoInit};
+    Vector3<Float> w{NoInit};
+    std::tie(u, w, v) = Algorithms::svd3x3(a);
+
+    /* The reflection is in the last singular value, U and V are rotations */
+    CORRADE_COMPARE(w, (Vector3<Float>{3.0f, 2.0f, -1.0f}));
+    CORRADE_COMPARE(u.determinant(), 1.0f);
+    CORRADE_COMPARE(v.determinant(), 1.0f);
+    CORRADE_COMPARE(u*Matrix3x3<Float>::fromDiagonal(w)*v.transposed(), a);
+}
+
+void SvdTest::test3x3Degenerate() {
+    /* Rank one */
+    const Matrix3x3<Float> a{
+        Vector3<Float>{1.0f, 2.0f, 3.0f},
+        Vector3<Float>{2.0f, 4.0f, 6.0f},
+        Vector3<Float>{-1.0f, -2.0f, -3.0f}};
+
+    Matrix3x3<Float> u{NoInit}, v{NoInit};
+    Vector3<Float> w{NoInit};
+    std::tie(u, w, v) = Algorithms::svd3x3(a);
+    CORRADE_COMPARE(w[0], std::sqrt(84.0f));
+    CORRADE_VERIFY(std::abs(w[1]) < 1.0e-5f);
+    CORRADE_VERIFY(std::abs(w[2]) < 1.0e-5f);
+    CORRADE_COMPARE(u*Matrix3x3<Float>::fromDiagonal(w)*v.transposed(), a);
+
+    /* Zero matrix gives zero singular values and identity rotations */
+    std::tie(u, w, v) = Algorithms::svd3x3(Matrix3x3<Float>{ZeroInit});
+    CORRADE_COMPARE(w, Vector3<Float>{});
+    CORRADE_COMPARE(u.determinant(), 1.0f);
+    CORRADE_COMPARE(v.determinant(), 1.0f);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::SvdTest)
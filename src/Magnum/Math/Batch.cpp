@@ -0,0 +1,726 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Batch.h"
+
+#include "Magnum/Math/Bezier.h"
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace Math {
+
+namespace {
+
+/* If SIMD is enabled, the functions below process the input in blocks of four
+   items transposed into structure-of-arrays layout and the remaining items
+   are processed one by one using the regular API. The operations are done in
+   the same order as in the regular API, so the results are the same. */
+
+#ifdef MAGNUM_TARGET_SSE
+/* Four consecutive Vector3s (12 floats) into x, y, z registers and back */
+inline void load3(const Float* const data, __m128& x, __m128& y, __m128& z) {
+    const __m128 p0 = _mm_loadu_ps(data);     /* x0 y0 z0 x1 */
+    const __m128 p1 = _mm_loadu_ps(data + 4); /* y1 z1 x2 y2 */
+    const __m128 p2 = _mm_loadu_ps(data + 8); /* z2 x3 y3 z3 */
+    const __m128 t = _mm_shuffle_ps(p1, p2, _MM_SHUFFLE(1, 0, 3, 2)); /* x2 y2 z2 x3 */
+    const __m128 u = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(1, 0, 2, 1)); /* y0 z0 y1 z1 */
+    const __m128 v = _mm_shuffle_ps(t, p2, _MM_SHUFFLE(3, 2, 2, 1));  /* y2 z2 y3 z3 */
+    x = _mm_shuffle_ps(p0, t, _MM_SHUFFLE(3, 0, 3, 0));
+    y = _mm_shuffle_ps(u, v, _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm_shuffle_ps(u, v, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+inline void store3(Float* const data, const __m128 x, const __m128 y, const __m128 z) {
+    const __m128 xy01 = _mm_unpacklo_ps(x, y); /* x0 y0 x1 y1 */
+    const __m128 xy23 = _mm_unpackhi_ps(x, y); /* x2 y2 x3 y3 */
+    _mm_storeu_ps(data, _mm_shuffle_ps(xy01,
+        _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+    _mm_storeu_ps(data + 4, _mm_shuffle_ps(
+        _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), xy23, _MM_SHUFFLE(1, 0, 2, 0)));
+    _mm_storeu_ps(data + 8, _mm_shuffle_ps(
+        _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+        _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+/* Four consecutive Vector2s (8 floats) into x, y registers and back */
+inline void load2(const Float* const data, __m128& x, __m128& y) {
+    const __m128 p0 = _mm_loadu_ps(data);     /* x0 y0 x1 y1 */
+    const __m128 p1 = _mm_loadu_ps(data + 4); /* x2 y2 x3 y3 */
+    x = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(2, 0, 2, 0));
+    y = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+inline void store2(Float* const data, const __m128 x, const __m128 y) {
+    _mm_storeu_ps(data, _mm_unpacklo_ps(x, y));
+    _mm_storeu_ps(data + 4, _mm_unpackhi_ps(x, y));
+}
+
+/* Four consecutive Vector4s (16 floats) into x, y, z, w registers and back */
+inline void load4(const Float* const data, __m128& x, __m128& y, __m128& z, __m128& w) {
+    x = _mm_loadu_ps(data);
+    y = _mm_loadu_ps(data + 4);
+    z = _mm_loadu_ps(data + 8);
+    w = _mm_loadu_ps(data + 12);
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+}
+
+inline void store4(Float* const data, __m128 x, __m128 y, __m128 z, __m128 w) {
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+    _mm_storeu_ps(data, x);
+    _mm_storeu_ps(data + 4, y);
+    _mm_storeu_ps(data + 8, z);
+    _mm_storeu_ps(data + 12, w);
+}
+#endif
+
+/* Flat linear interpolation of n floats */
+void lerpFloats(const Float* const a, const Float* const b, const Float t, Float* const out, const std::size_t n) {
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    const __m128 tv = _mm_set1_ps(t);
+    const __m128 t1v = _mm_set1_ps(1.0f - t);
+    for(; i + 4 <= n; i += 4)
+        _mm_storeu_ps(out + i, _mm_add_ps(
+            _mm_mul_ps(t1v, _mm_loadu_ps(a + i)),
+            _mm_mul_ps(tv, _mm_loadu_ps(b + i))));
+    #endif
+    for(; i != n; ++i)
+        out[i] = (1.0f - t)*a[i] + t*b[i];
+}
+
+/* Blending of four joint transformations for dual quaternion skinning,
+   normalized by length of the real part */
+inline void blendJoints(const DualQuaternion<Float>* const joints, const Vector4<UnsignedInt>& ids, const Vector4<Float>& weights, Quaternion<Float>& real, Quaternion<Float>& dual) {
+    const Quaternion<Float> first = joints[ids[0]].real();
+    real = first*weights[0];
+    dual = joints[ids[0]].dual()*weights[0];
+    for(std::size_t k = 1; k != 4; ++k) {
+        const DualQuaternion<Float>& joint = joints[ids[k]];
+
+        /* Take the shortest path */
+        const Float weight = dot(first, joint.real()) < 0.0f ? -weights[k] : weights[k];
+        real += joint.real()*weight;
+        dual += joint.dual()*weight;
+    }
+
+    const Float length = real.length();
+    real /= length;
+    dual /= length;
+}
+
+/* Rotation and translation with the blended dual quaternion, in the same
+   order as the SIMD variant below */
+inline Vector3<Float> skinRotate(const Quaternion<Float>& real, const Vector3<Float>& vector) {
+    return vector + 2.0f*cross(real.vector(), cross(real.vector(), vector) + real.scalar()*vector);
+}
+
+inline Vector3<Float> skinTranslation(const Quaternion<Float>& real, const Quaternion<Float>& dual) {
+    return 2.0f*(real.scalar()*dual.vector() - dual.scalar()*real.vector() + cross(real.vector(), dual.vector()));
+}
+
+#ifdef MAGNUM_TARGET_SSE
+inline void cross4(const __m128 ax, const __m128 ay, const __m128 az, const __m128 bx, const __m128 by, const __m128 bz, __m128& x, __m128& y, __m128& z) {
+    x = _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(by, az));
+    y = _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(bz, ax));
+    z = _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(bx, ay));
+}
+
+inline void skinRotate4(const __m128 rx, const __m128 ry, const __m128 rz, const __m128 rs, __m128& x, __m128& y, __m128& z) {
+    const __m128 two = _mm_set1_ps(2.0f);
+    __m128 cx, cy, cz;
+    cross4(rx, ry, rz, x, y, z, cx, cy, cz);
+    cx = _mm_add_ps(cx, _mm_mul_ps(x, rs));
+    cy = _mm_add_ps(cy, _mm_mul_ps(y, rs));
+    cz = _mm_add_ps(cz, _mm_mul_ps(z, rs));
+    __m128 dx, dy, dz;
+    cross4(rx, ry, rz, cx, cy, cz, dx, dy, dz);
+    x = _mm_add_ps(x, _mm_mul_ps(dx, two));
+    y = _mm_add_ps(y, _mm_mul_ps(dy, two));
+    z = _mm_add_ps(z, _mm_mul_ps(dz, two));
+}
+#endif
+
+void skinInternal(const Corrade::Containers::ArrayView<const DualQuaternion<Float>> joints, const Corrade::Containers::ArrayView<const Vector4<UnsignedInt>> jointIds, const Corrade::Containers::ArrayView<const Vector4<Float>> weights, const Corrade::Containers::ArrayView<const Vector3<Float>> points, const Vector3<Float>* const normals, const Corrade::Containers::ArrayView<Vector3<Float>> out, Vector3<Float>* const outNormals) {
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(std::size_t i = 0; i != joints.size(); ++i)
+        CORRADE_ASSERT(joints[i].isNormalized(),
+            "Math::skin(): joint" << i << "is not normalized", );
+    for(std::size_t i = 0; i != jointIds.size(); ++i)
+        CORRADE_ASSERT(jointIds[i].max() < joints.size(),
+            "Math::skin(): joint ID out of range for" << joints.size() << "joints at index" << i, );
+    #endif
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    const Float* const jointData = reinterpret_cast<const Float*>(joints.data());
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    for(; i + 4 <= points.size(); i += 4) {
+        const Vector4<UnsignedInt>* const ids = jointIds.data() + i;
+        __m128 w[4];
+        load4(weights[i].data(), w[0], w[1], w[2], w[3]);
+
+        /* Blend the joints of four points at once, the first joint of each
+           point is used to decide the hemisphere */
+        __m128 fx{}, fy{}, fz{}, fs{}, rx{}, ry{}, rz{}, rs{}, dx{}, dy{}, dz{}, ds{};
+        for(std::size_t k = 0; k != 4; ++k) {
+            __m128 jrx = _mm_loadu_ps(jointData + ids[0][k]*8),
+                jry = _mm_loadu_ps(jointData + ids[1][k]*8),
+                jrz = _mm_loadu_ps(jointData + ids[2][k]*8),
+                jrs = _mm_loadu_ps(jointData + ids[3][k]*8);
+            _MM_TRANSPOSE4_PS(jrx, jry, jrz, jrs);
+            __m128 jdx = _mm_loadu_ps(jointData + ids[0][k]*8 + 4),
+                jdy = _mm_loadu_ps(jointData + ids[1][k]*8 + 4),
+                jdz = _mm_loadu_ps(jointData + ids[2][k]*8 + 4),
+                jds = _mm_loadu_ps(jointData + ids[3][k]*8 + 4);
+            _MM_TRANSPOSE4_PS(jdx, jdy, jdz, jds);
+
+            if(k == 0) {
+                fx = jrx; fy = jry; fz = jrz; fs = jrs;
+                rx = _mm_mul_ps(jrx, w[0]);
+                ry = _mm_mul_ps(jry, w[0]);
+                rz = _mm_mul_ps(jrz, w[0]);
+                rs = _mm_mul_ps(jrs, w[0]);
+                dx = _mm_mul_ps(jdx, w[0]);
+                dy = _mm_mul_ps(jdy, w[0]);
+                dz = _mm_mul_ps(jdz, w[0]);
+                ds = _mm_mul_ps(jds, w[0]);
+                continue;
+            }
+
+            /* Take the shortest path */
+            const __m128 d = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(fx, jrx), _mm_mul_ps(fy, jry)),
+                _mm_mul_ps(fz, jrz)), _mm_mul_ps(fs, jrs));
+            const __m128 weight = _mm_xor_ps(w[k],
+                _mm_and_ps(_mm_cmplt_ps(d, _mm_setzero_ps()), signMask));
+            rx = _mm_add_ps(rx, _mm_mul_ps(jrx, weight));
+            ry = _mm_add_ps(ry, _mm_mul_ps(jry, weight));
+            rz = _mm_add_ps(rz, _mm_mul_ps(jrz, weight));
+            rs = _mm_add_ps(rs, _mm_mul_ps(jrs, weight));
+            dx = _mm_add_ps(dx, _mm_mul_ps(jdx, weight));
+            dy = _mm_add_ps(dy, _mm_mul_ps(jdy, weight));
+            dz = _mm_add_ps(dz, _mm_mul_ps(jdz, weight));
+            ds = _mm_add_ps(ds, _mm_mul_ps(jds, weight));
+        }
+
+        const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)),
+            _mm_mul_ps(rz, rz)), _mm_mul_ps(rs, rs)));
+        rx = _mm_div_ps(rx, length);
+        ry = _mm_div_ps(ry, length);
+        rz = _mm_div_ps(rz, length);
+        rs = _mm_div_ps(rs, length);
+        dx = _mm_div_ps(dx, length);
+        dy = _mm_div_ps(dy, length);
+        dz = _mm_div_ps(dz, length);
+        ds = _mm_div_ps(ds, length);
+
+        /* Translation */
+        const __m128 two = _mm_set1_ps(2.0f);
+        __m128 tx, ty, tz;
+        cross4(rx, ry, rz, dx, dy, dz, tx, ty, tz);
+        tx = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(dx, rs), _mm_mul_ps(rx, ds)), tx), two);
+        ty = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(dy, rs), _mm_mul_ps(ry, ds)), ty), two);
+        tz = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(dz, rs), _mm_mul_ps(rz, ds)), tz), two);
+
+        __m128 px, py, pz;
+        load3(points[i].data(), px, py, pz);
+        skinRotate4(rx, ry, rz, rs, px, py, pz);
+        store3(out[i].data(), _mm_add_ps(px, tx), _mm_add_ps(py, ty), _mm_add_ps(pz, tz));
+
+        if(normals) {
+            __m128 nx, ny, nz;
+            load3(normals[i].data(), nx, ny, nz);
+            skinRotate4(rx, ry, rz, rs, nx, ny, nz);
+            store3(outNormals[i].data(), nx, ny, nz);
+        }
+    }
+    #endif
+    for(; i != points.size(); ++i) {
+        Quaternion<Float> real{NoInit}, dual{NoInit};
+        blendJoints(joints, jointIds[i], weights[i], real, dual);
+        out[i] = skinRotate(real, points[i]) + skinTranslation(real, dual);
+        if(normals) outNormals[i] = skinRotate(real, normals[i]);
+    }
+}
+
+#ifdef MAGNUM_TARGET_SSE
+/* One step of De Casteljau's algorithm, in the same order as in
+   Bezier::value() */
+inline __m128 lerp4(const __m128 a, const __m128 b, const __m128 t, const __m128 t1) {
+    return _mm_add_ps(_mm_mul_ps(a, t1), _mm_mul_ps(b, t));
+}
+
+inline __m128 quadraticValue4(const __m128 p0, const __m128 p1, const __m128 p2, const __m128 t, const __m128 t1) {
+    return lerp4(lerp4(p0, p1, t, t1), lerp4(p1, p2, t, t1), t, t1);
+}
+
+inline __m128 cubicValue4(const __m128 p0, const __m128 p1, const __m128 p2, const __m128 p3, const __m128 t, const __m128 t1) {
+    const __m128 q1 = lerp4(p1, p2, t, t1);
+    return lerp4(
+        lerp4(lerp4(p0, p1, t, t1), q1, t, t1),
+        lerp4(q1, lerp4(p2, p3, t, t1), t, t1), t, t1);
+}
+#endif
+
+}
+
+void transformPoints(const Matrix4<Float>& matrix, const Corrade::Containers::ArrayView<const Vector3<Float>> points, const Corrade::Containers::ArrayView<Vector3<Float>> out) {
+    CORRADE_ASSERT(points.size() == out.size(),
+        "Math::transformPoints(): output view has wrong size, expected" << points.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    __m128 m[4][3];
+    for(std::size_t col = 0; col != 4; ++col)
+        for(std::size_t row = 0; row != 3; ++row)
+            m[col][row] = _mm_set1_ps(matrix[col][row]);
+
+    for(; i + 4 <= points.size(); i += 4) {
+        __m128 x, y, z;
+        load3(points[i].data(), x, y, z);
+        __m128 o[3];
+        for(std::size_t row = 0; row != 3; ++row)
+            o[row] = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(m[0][row], x),
+                _mm_mul_ps(m[1][row], y)),
+                _mm_mul_ps(m[2][row], z)),
+                m[3][row]);
+        store3(out[i].data(), o[0], o[1], o[2]);
+    }
+    #endif
+
+    for(; i != points.size(); ++i)
+        out[i] = matrix.transformPoint(points[i]);
+}
+
+void transformPoints(const Matrix3<Float>& matrix, const Corrade::Containers::ArrayView<const Vector2<Float>> points, const Corrade::Containers::ArrayView<Vector2<Float>> out) {
+    CORRADE_ASSERT(points.size() == out.size(),
+        "Math::transformPoints(): output view has wrong size, expected" << points.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    __m128 m[3][2];
+    for(std::size_t col = 0; col != 3; ++col)
+        for(std::size_t row = 0; row != 2; ++row)
+            m[col][row] = _mm_set1_ps(matrix[col][row]);
+
+    for(; i + 4 <= points.size(); i += 4) {
+        __m128 x, y;
+        load2(points[i].data(), x, y);
+        __m128 o[2];
+        for(std::size_t row = 0; row != 2; ++row)
+            o[row] = _mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(m[0][row], x),
+                _mm_mul_ps(m[1][row], y)),
+                m[2][row]);
+        store2(out[i].data(), o[0], o[1]);
+    }
+    #endif
+
+    for(; i != points.size(); ++i)
+        out[i] = matrix.transformPoint(points[i]);
+}
+
+void transformVectors(const Matrix4<Float>& matrix, const Corrade::Containers::ArrayView<const Vector3<Float>> vectors, const Corrade::Containers::ArrayView<Vector3<Float>> out) {
+    CORRADE_ASSERT(vectors.size() == out.size(),
+        "Math::transformVectors(): output view has wrong size, expected" << vectors.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    __m128 m[3][3];
+    for(std::size_t col = 0; col != 3; ++col)
+        for(std::size_t row = 0; row != 3; ++row)
+            m[col][row] = _mm_set1_ps(matrix[col][row]);
+
+    for(; i + 4 <= vectors.size(); i += 4) {
+        __m128 x, y, z;
+        load3(vectors[i].data(), x, y, z);
+        __m128 o[3];
+        for(std::size_t row = 0; row != 3; ++row)
+            o[row] = _mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(m[0][row], x),
+                _mm_mul_ps(m[1][row], y)),
+                _mm_mul_ps(m[2][row], z));
+        store3(out[i].data(), o[0], o[1], o[2]);
+    }
+    #endif
+
+    for(; i != vectors.size(); ++i)
+        out[i] = matrix.transformVector(vectors[i]);
+}
+
+void transformVectors(const Matrix3<Float>& matrix, const Corrade::Containers::ArrayView<const Vector2<Float>> vectors, const Corrade::Containers::ArrayView<Vector2<Float>> out) {
+    CORRADE_ASSERT(vectors.size() == out.size(),
+        "Math::transformVectors(): output view has wrong size, expected" << vectors.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    __m128 m[2][2];
+    for(std::size_t col = 0; col != 2; ++col)
+        for(std::size_t row = 0; row != 2; ++row)
+            m[col][row] = _mm_set1_ps(matrix[col][row]);
+
+    for(; i + 4 <= vectors.size(); i += 4) {
+        __m128 x, y;
+        load2(vectors[i].data(), x, y);
+        store2(out[i].data(),
+            _mm_add_ps(_mm_mul_ps(m[0][0], x), _mm_mul_ps(m[1][0], y)),
+            _mm_add_ps(_mm_mul_ps(m[0][1], x), _mm_mul_ps(m[1][1], y)));
+    }
+    #endif
+
+    for(; i != vectors.size(); ++i)
+        out[i] = matrix.transformVector(vectors[i]);
+}
+
+void multiply(const Corrade::Containers::ArrayView<const Matrix4<Float>> a, const Corrade::Containers::ArrayView<const Matrix4<Float>> b, const Corrade::Containers::ArrayView<Matrix4<Float>> out) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == out.size(),
+        "Math::multiply(): views don't have the same size, expected" << a.size() << "but got" << b.size() << "and" << out.size(), );
+
+    /* The 4x4 product is already SIMD-accelerated if enabled */
+    for(std::size_t i = 0; i != a.size(); ++i)
+        out[i] = a[i]*b[i];
+}
+
+void multiply(const Corrade::Containers::ArrayView<const Matrix3<Float>> a, const Corrade::Containers::ArrayView<const Matrix3<Float>> b, const Corrade::Containers::ArrayView<Matrix3<Float>> out) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == out.size(),
+        "Math::multiply(): views don't have the same size, expected" << a.size() << "but got" << b.size() << "and" << out.size(), );
+
+    for(std::size_t i = 0; i != a.size(); ++i)
+        out[i] = a[i]*b[i];
+}
+
+void multiply(const Matrix4<Float>& a, const Corrade::Containers::ArrayView<const Matrix4<Float>> b, const Corrade::Containers::ArrayView<Matrix4<Float>> out) {
+    CORRADE_ASSERT(b.size() == out.size(),
+        "Math::multiply(): output view has wrong size, expected" << b.size() << "but got" << out.size(), );
+
+    #ifdef MAGNUM_TARGET_SSE
+    const __m128 a0 = _mm_loadu_ps(a.data());
+    const __m128 a1 = _mm_loadu_ps(a.data() + 4);
+    const __m128 a2 = _mm_loadu_ps(a.data() + 8);
+    const __m128 a3 = _mm_loadu_ps(a.data() + 12);
+
+    for(std::size_t i = 0; i != b.size(); ++i) {
+        for(std::size_t col = 0; col != 4; ++col) {
+            const Float* const bc = b[i].data() + col*4;
+            _mm_storeu_ps(out[i].data() + col*4, _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(a0, _mm_set1_ps(bc[0])),
+                _mm_mul_ps(a1, _mm_set1_ps(bc[1]))),
+                _mm_mul_ps(a2, _mm_set1_ps(bc[2]))),
+                _mm_mul_ps(a3, _mm_set1_ps(bc[3]))));
+        }
+    }
+    #else
+    /* Local copy, so the compiler doesn't need to reload it on every
+       iteration because of possible aliasing with the output */
+    const Matrix4<Float> left = a;
+    for(std::size_t i = 0; i != b.size(); ++i)
+        out[i] = left*b[i];
+    #endif
+}
+
+void multiply(const Matrix3<Float>& a, const Corrade::Containers::ArrayView<const Matrix3<Float>> b, const Corrade::Containers::ArrayView<Matrix3<Float>> out) {
+    CORRADE_ASSERT(b.size() == out.size(),
+        "Math::multiply(): output view has wrong size, expected" << b.size() << "but got" << out.size(), );
+
+    const Matrix3<Float> left = a;
+    for(std::size_t i = 0; i != b.size(); ++i)
+        out[i] = left*b[i];
+}
+
+void dot(const Corrade::Containers::ArrayView<const Vector2<Float>> a, const Corrade::Containers::ArrayView<const Vector2<Float>> b, const Corrade::Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == out.size(),
+        "Math::dot(): views don't have the same size, expected" << a.size() << "but got" << b.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    for(; i + 4 <= a.size(); i += 4) {
+        __m128 ax, ay, bx, by;
+        load2(a[i].data(), ax, ay);
+        load2(b[i].data(), bx, by);
+        _mm_storeu_ps(out.data() + i, _mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)));
+    }
+    #endif
+    for(; i != a.size(); ++i)
+        out[i] = Math::dot(a[i], b[i]);
+}
+
+void dot(const Corrade::Containers::ArrayView<const Vector3<Float>> a, const Corrade::Containers::ArrayView<const Vector3<Float>> b, const Corrade::Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == out.size(),
+        "Math::dot(): views don't have the same size, expected" << a.size() << "but got" << b.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    for(; i + 4 <= a.size(); i += 4) {
+        __m128 ax, ay, az, bx, by, bz;
+        load3(a[i].data(), ax, ay, az);
+        load3(b[i].data(), bx, by, bz);
+        _mm_storeu_ps(out.data() + i, _mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(ax, bx),
+            _mm_mul_ps(ay, by)),
+            _mm_mul_ps(az, bz)));
+    }
+    #endif
+    for(; i != a.size(); ++i)
+        out[i] = Math::dot(a[i], b[i]);
+}
+
+void dot(const Corrade::Containers::ArrayView<const Vector4<Float>> a, const Corrade::Containers::ArrayView<const Vector4<Float>> b, const Corrade::Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == out.size(),
+        "Math::dot(): views don't have the same size, expected" << a.size() << "but got" << b.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    for(; i + 4 <= a.size(); i += 4) {
+        __m128 ax, ay, az, aw, bx, by, bz, bw;
+        load4(a[i].data(), ax, ay, az, aw);
+        load4(b[i].data(), bx, by, bz, bw);
+        _mm_storeu_ps(out.data() + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(ax, bx),
+            _mm_mul_ps(ay, by)),
+            _mm_mul_ps(az, bz)),
+            _mm_mul_ps(aw, bw)));
+    }
+    #endif
+    for(; i != a.size(); ++i)
+        out[i] = Math::dot(a[i], b[i]);
+}
+
+void normalize(const Corrade::Containers::ArrayView<const Vector2<Float>> vectors, const Corrade::Containers::ArrayView<Vector2<Float>> out) {
+    CORRADE_ASSERT(vectors.size() == out.size(),
+        "Math::normalize(): output view has wrong size, expected" << vectors.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    for(; i + 4 <= vectors.size(); i += 4) {
+        __m128 x, y;
+        load2(vectors[i].data(), x, y);
+        const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+        store2(out[i].data(), _mm_div_ps(x, length), _mm_div_ps(y, length));
+    }
+    #endif
+    for(; i != vectors.size(); ++i)
+        out[i] = vectors[i].normalized();
+}
+
+void normalize(const Corrade::Containers::ArrayView<const Vector3<Float>> vectors, const Corrade::Containers::ArrayView<Vector3<Float>> out) {
+    CORRADE_ASSERT(vectors.size() == out.size(),
+        "Math::normalize(): output view has wrong size, expected" << vectors.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    for(; i + 4 <= vectors.size(); i += 4) {
+        __m128 x, y, z;
+        load3(vectors[i].data(), x, y, z);
+        const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(x, x),
+            _mm_mul_ps(y, y)),
+            _mm_mul_ps(z, z)));
+        store3(out[i].data(), _mm_div_ps(x, length), _mm_div_ps(y, length), _mm_div_ps(z, length));
+    }
+    #endif
+    for(; i != vectors.size(); ++i)
+        out[i] = vectors[i].normalized();
+}
+
+void normalize(const Corrade::Containers::ArrayView<const Vector4<Float>> vectors, const Corrade::Containers::ArrayView<Vector4<Float>> out) {
+    CORRADE_ASSERT(vectors.size() == out.size(),
+        "Math::normalize(): output view has wrong size, expected" << vectors.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    for(; i + 4 <= vectors.size(); i += 4) {
+        __m128 x, y, z, w;
+        load4(vectors[i].data(), x, y, z, w);
+        const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(x, x),
+            _mm_mul_ps(y, y)),
+            _mm_mul_ps(z, z)),
+            _mm_mul_ps(w, w)));
+        store4(reinterpret_cast<Float*>(out.data() + i), _mm_div_ps(x, length), _mm_div_ps(y, length), _mm_div_ps(z, length), _mm_div_ps(w, length));
+    }
+    #endif
+    for(; i != vectors.size(); ++i)
+        out[i] = vectors[i].normalized();
+}
+
+void lerp(const Corrade::Containers::ArrayView<const Vector2<Float>> a, const Corrade::Containers::ArrayView<const Vector2<Float>> b, const Float t, const Corrade::Containers::ArrayView<Vector2<Float>> out) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == out.size(),
+        "Math::lerp(): views don't have the same size, expected" << a.size() << "but got" << b.size() << "and" << out.size(), );
+
+    lerpFloats(reinterpret_cast<const Float*>(a.data()), reinterpret_cast<const Float*>(b.data()), t, reinterpret_cast<Float*>(out.data()), a.size()*2);
+}
+
+void lerp(const Corrade::Containers::ArrayView<const Vector3<Float>> a, const Corrade::Containers::ArrayView<const Vector3<Float>> b, const Float t, const Corrade::Containers::ArrayView<Vector3<Float>> out) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == out.size(),
+        "Math::lerp(): views don't have the same size, expected" << a.size() << "but got" << b.size() << "and" << out.size(), );
+
+    lerpFloats(reinterpret_cast<const Float*>(a.data()), reinterpret_cast<const Float*>(b.data()), t, reinterpret_cast<Float*>(out.data()), a.size()*3);
+}
+
+void lerp(const Corrade::Containers::ArrayView<const Vector4<Float>> a, const Corrade::Containers::ArrayView<const Vector4<Float>> b, const Float t, const Corrade::Containers::ArrayView<Vector4<Float>> out) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == out.size(),
+        "Math::lerp(): views don't have the same size, expected" << a.size() << "but got" << b.size() << "and" << out.size(), );
+
+    lerpFloats(reinterpret_cast<const Float*>(a.data()), reinterpret_cast<const Float*>(b.data()), t, reinterpret_cast<Float*>(out.data()), a.size()*4);
+}
+
+void lerp(const Corrade::Containers::ArrayView<const Quaternion<Float>> normalizedA, const Corrade::Containers::ArrayView<const Quaternion<Float>> normalizedB, const Float t, const Corrade::Containers::ArrayView<Quaternion<Float>> out) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size() && normalizedA.size() == out.size(),
+        "Math::lerp(): views don't have the same size, expected" << normalizedA.size() << "but got" << normalizedB.size() << "and" << out.size(), );
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(std::size_t i = 0; i != normalizedA.size(); ++i)
+        CORRADE_ASSERT(normalizedA[i].isNormalized() && normalizedB[i].isNormalized(),
+            "Math::lerp(): quaternions must be normalized", );
+    #endif
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    const __m128 tv = _mm_set1_ps(t);
+    const __m128 t1v = _mm_set1_ps(1.0f - t);
+    for(; i + 4 <= normalizedA.size(); i += 4) {
+        __m128 ax, ay, az, as, bx, by, bz, bs;
+        load4(reinterpret_cast<const Float*>(normalizedA.data() + i), ax, ay, az, as);
+        load4(reinterpret_cast<const Float*>(normalizedB.data() + i), bx, by, bz, bs);
+        const __m128 x = _mm_add_ps(_mm_mul_ps(ax, t1v), _mm_mul_ps(bx, tv));
+        const __m128 y = _mm_add_ps(_mm_mul_ps(ay, t1v), _mm_mul_ps(by, tv));
+        const __m128 z = _mm_add_ps(_mm_mul_ps(az, t1v), _mm_mul_ps(bz, tv));
+        const __m128 s = _mm_add_ps(_mm_mul_ps(as, t1v), _mm_mul_ps(bs, tv));
+        const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)), _mm_mul_ps(s, s)));
+        store4(reinterpret_cast<Float*>(out.data() + i), _mm_div_ps(x, length), _mm_div_ps(y, length),
+            _mm_div_ps(z, length), _mm_div_ps(s, length));
+    }
+    #endif
+    for(; i != normalizedA.size(); ++i)
+        out[i] = ((1.0f - t)*normalizedA[i] + t*normalizedB[i]).normalized();
+}
+
+void slerp(const Corrade::Containers::ArrayView<const Quaternion<Float>> normalizedA, const Corrade::Containers::ArrayView<const Quaternion<Float>> normalizedB, const Float t, const Corrade::Containers::ArrayView<Quaternion<Float>> out) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size() && normalizedA.size() == out.size(),
+        "Math::slerp(): views don't have the same size, expected" << normalizedA.size() << "but got" << normalizedB.size() << "and" << out.size(), );
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(std::size_t i = 0; i != normalizedA.size(); ++i)
+        CORRADE_ASSERT(normalizedA[i].isNormalized() && normalizedB[i].isNormalized(),
+            "Math::slerp(): quaternions must be normalized", );
+    #endif
+
+    for(std::size_t i = 0; i != normalizedA.size(); ++i)
+        out[i] = Implementation::slerp(normalizedA[i], normalizedB[i], t);
+}
+
+void sclerp(const Corrade::Containers::ArrayView<const DualQuaternion<Float>> normalizedA, const Corrade::Containers::ArrayView<const DualQuaternion<Float>> normalizedB, const Float t, const Corrade::Containers::ArrayView<DualQuaternion<Float>> out) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size() && normalizedA.size() == out.size(),
+        "Math::sclerp(): views don't have the same size, expected" << normalizedA.size() << "but got" << normalizedB.size() << "and" << out.size(), );
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(std::size_t i = 0; i != normalizedA.size(); ++i)
+        CORRADE_ASSERT(normalizedA[i].isNormalized() && normalizedB[i].isNormalized(),
+            "Math::sclerp(): dual quaternions must be normalized", );
+    #endif
+
+    for(std::size_t i = 0; i != normalizedA.size(); ++i)
+        out[i] = Implementation::sclerp(normalizedA[i], normalizedB[i], t);
+}
+
+void skin(const Corrade::Containers::ArrayView<const DualQuaternion<Float>> joints, const Corrade::Containers::ArrayView<const Vector4<UnsignedInt>> jointIds, const Corrade::Containers::ArrayView<const Vector4<Float>> weights, const Corrade::Containers::ArrayView<const Vector3<Float>> points, const Corrade::Containers::ArrayView<Vector3<Float>> out) {
+    CORRADE_ASSERT(jointIds.size() == points.size() && weights.size() == points.size() && out.size() == points.size(),
+        "Math::skin(): views don't have the same size, expected" << points.size() << "but got" << jointIds.size() << Corrade::Utility::Debug::nospace << "," << weights.size() << "and" << out.size(), );
+
+    skinInternal(joints, jointIds, weights, points, nullptr, out, nullptr);
+}
+
+void skin(const Corrade::Containers::ArrayView<const DualQuaternion<Float>> joints, const Corrade::Containers::ArrayView<const Vector4<UnsignedInt>> jointIds, const Corrade::Containers::ArrayView<const Vector4<Float>> weights, const Corrade::Containers::ArrayView<const Vector3<Float>> points, const Corrade::Containers::ArrayView<const Vector3<Float>> normals, const Corrade::Containers::ArrayView<Vector3<Float>> out, const Corrade::Containers::ArrayView<Vector3<Float>> outNormals) {
+    CORRADE_ASSERT(jointIds.size() == points.size() && weights.size() == points.size() && out.size() == points.size() && normals.size() == points.size() && outNormals.size() == points.size(),
+        "Math::skin(): views don't have the same size, expected" << points.size() << "but got" << jointIds.size() << Corrade::Utility::Debug::nospace << "," << weights.size() << Corrade::Utility::Debug::nospace << "," << normals.size() << Corrade::Utility::Debug::nospace << "," << out.size() << "and" << outNormals.size(), );
+
+    skinInternal(joints, jointIds, weights, points, normals.data(), out, outNormals.data());
+}
+
+void bezierValues(const Corrade::Containers::ArrayView<const Bezier<2, 2, Float>> curves, const Corrade::Containers::ArrayView<const Float> t, const Corrade::Containers::ArrayView<Vector2<Float>> out) {
+    CORRADE_ASSERT(curves.size() == t.size() && curves.size() == out.size(),
+        "Math::bezierValues(): views don't have the same size, expected" << curves.size() << "but got" << t.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    const Float* const data = reinterpret_cast<const Float*>(curves.data());
+    const __m128 one = _mm_set1_ps(1.0f);
+    for(; i + 4 <= curves.size(); i += 4) {
+        /* Six floats per curve, the second load overlaps the first */
+        const Float* const c = data + i*6;
+        __m128 p0x = _mm_loadu_ps(c), p0y = _mm_loadu_ps(c + 6),
+            p1x = _mm_loadu_ps(c + 12), p1y = _mm_loadu_ps(c + 18);
+        _MM_TRANSPOSE4_PS(p0x, p0y, p1x, p1y);
+        __m128 a = _mm_loadu_ps(c + 2), b = _mm_loadu_ps(c + 8),
+            p2x = _mm_loadu_ps(c + 14), p2y = _mm_loadu_ps(c + 20);
+        _MM_TRANSPOSE4_PS(a, b, p2x, p2y);
+
+        const __m128 tv = _mm_loadu_ps(t.data() + i);
+        const __m128 t1v = _mm_sub_ps(one, tv);
+        store2(out[i].data(),
+            quadraticValue4(p0x, p1x, p2x, tv, t1v),
+            quadraticValue4(p0y, p1y, p2y, tv, t1v));
+    }
+    #endif
+    for(; i != curves.size(); ++i)
+        out[i] = curves[i].value(t[i]);
+}
+
+void bezierValues(const Corrade::Containers::ArrayView<const Bezier<3, 3, Float>> curves, const Corrade::Containers::ArrayView<const Float> t, const Corrade::Containers::ArrayView<Vector3<Float>> out) {
+    CORRADE_ASSERT(curves.size() == t.size() && curves.size() == out.size(),
+        "Math::bezierValues(): views don't have the same size, expected" << curves.size() << "but got" << t.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_TARGET_SSE
+    const Float* const data = reinterpret_cast<const Float*>(curves.data());
+    const __m128 one = _mm_set1_ps(1.0f);
+    for(; i + 4 <= curves.size(); i += 4) {
+        /* Twelve floats per curve, three transposes give all coordinates */
+        const Float* const c = data + i*12;
+        __m128 p0x = _mm_loadu_ps(c), p0y = _mm_loadu_ps(c + 12),
+            p0z = _mm_loadu_ps(c + 24), p1x = _mm_loadu_ps(c + 36);
+        _MM_TRANSPOSE4_PS(p0x, p0y, p0z, p1x);
+        __m128 p1y = _mm_loadu_ps(c + 4), p1z = _mm_loadu_ps(c + 16),
+            p2x = _mm_loadu_ps(c + 28), p2y = _mm_loadu_ps(c + 40);
+        _MM_TRANSPOSE4_PS(p1y, p1z, p2x, p2y);
+        __m128 p2z = _mm_loadu_ps(c + 8), p3x = _mm_loadu_ps(c + 20),
+            p3y = _mm_loadu_ps(c + 32), p3z = _mm_loadu_ps(c + 44);
+        _MM_TRANSPOSE4_PS(p2z, p3x, p3y, p3z);
+
+        const __m128 tv = _mm_loadu_ps(t.data() + i);
+        const __m128 t1v = _mm_sub_ps(one, tv);
+        store3(out[i].data(),
+            cubicValue4(p0x, p1x, p2x, p3x, tv, t1v),
+            cubicValue4(p0y, p1y, p2y, p3y, tv, t1v),
+            cubicValue4(p0z, p1z, p2z, p3z, tv, t1v));
+    }
+    #endif
+    for(; i != curves.size(); ++i)
+        out[i] = curves[i].value(t[i]);
+}
+
+}}
@@ -0,0 +1,245 @@
+#ifndef Magnum_Math_Batch_h
+#define Magnum_Math_Batch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Batch functions @ref Magnum::Math::transformPoints(), @ref Magnum::Math::transformVectors(), @ref Magnum::Math::multiply(), @ref Magnum::Math::dot(), @ref Magnum::Math::normalize(), @ref Magnum::Math::lerp(), @ref Magnum::Math::slerp(), @ref Magnum::Math::sclerp(), @ref Magnum::Math::bezierValues(), @ref Magnum::Math::skin()
+ */
+
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/visibility.h"
+#include "Magnum/Math/Math.h"
+
+namespace Magnum { namespace Math {
+
+/** @todo Double versions, strided views */
+
+/**
+@brief Transform points using given transformation matrix
+
+Equivalent to calling @ref Matrix4::transformPoint() on each item of @p points
+and saving the result to corresponding item of @p out. If
+@ref MAGNUM_TARGET_SSE is defined, four points at a time are transposed into
+structure-of-arrays layout and processed with SSE intrinsics, which is
+significantly faster than transforming them one by one. Expects that both
+views have the same size, they can point to the same memory for in-place
+transformation.
+
+Note that the overloads differ only in view types, thus arrays need to be
+converted to views explicitly:
+@code
+Vector3 points[256];
+Math::transformPoints(transformation, Containers::arrayView(points), Containers::arrayView(points));
+@endcode
+@see @ref transformVectors(),
+    @ref MeshTools::transformPointsInPlace()
+*/
+void MAGNUM_EXPORT transformPoints(const Matrix4<Float>& matrix, Corrade::Containers::ArrayView<const Vector3<Float>> points, Corrade::Containers::ArrayView<Vector3<Float>> out);
+
+/**
+@overload
+
+Equivalent to calling @ref Matrix3::transformPoint() on each item.
+*/
+void MAGNUM_EXPORT transformPoints(const Matrix3<Float>& matrix, Corrade::Containers::ArrayView<const Vector2<Float>> points, Corrade::Containers::ArrayView<Vector2<Float>> out);
+
+/**
+@brief Transform vectors using given transformation matrix
+
+Equivalent to calling @ref Matrix4::transformVector() on each item of
+@p vectors and saving the result to corresponding item of @p out. See
+@ref transformPoints() for more information.
+@see @ref MeshTools::transformVectorsInPlace()
+*/
+void MAGNUM_EXPORT transformVectors(const Matrix4<Float>& matrix, Corrade::Containers::ArrayView<const Vector3<Float>> vectors, Corrade::Containers::ArrayView<Vector3<Float>> out);
+
+/**
+@overload
+
+Equivalent to calling @ref Matrix3::transformVector() on each item.
+*/
+void MAGNUM_EXPORT transformVectors(const Matrix3<Float>& matrix, Corrade::Containers::ArrayView<const Vector2<Float>> vectors, Corrade::Containers::ArrayView<Vector2<Float>> out);
+
+/**
+@brief Multiply matrices pair-wise
+
+Saves @f$ \boldsymbol A_i \boldsymbol B_i @f$ to @p out for each @f$ i @f$.
+Expects that all views have the same size, @p out can point to the same
+memory as @p a or @p b.
+*/
+void MAGNUM_EXPORT multiply(Corrade::Containers::ArrayView<const Matrix4<Float>> a, Corrade::Containers::ArrayView<const Matrix4<Float>> b, Corrade::Containers::ArrayView<Matrix4<Float>> out);
+
+/** @overload */
+void MAGNUM_EXPORT multiply(Corrade::Containers::ArrayView<const Matrix3<Float>> a, Corrade::Containers::ArrayView<const Matrix3<Float>> b, Corrade::Containers::ArrayView<Matrix3<Float>> out);
+
+/**
+@brief Multiply matrices with common left-hand side
+
+Saves @f$ \boldsymbol A \boldsymbol B_i @f$ to @p out for each @f$ i @f$,
+with @f$ \boldsymbol A @f$ loaded only once. Useful e.g. for applying camera
+matrix to all object transformations. Expects that both views have the same
+size, @p out can point to the same memory as @p b.
+*/
+void MAGNUM_EXPORT multiply(const Matrix4<Float>& a, Corrade::Containers::ArrayView<const Matrix4<Float>> b, Corrade::Containers::ArrayView<Matrix4<Float>> out);
+
+/** @overload */
+void MAGNUM_EXPORT multiply(const Matrix3<Float>& a, Corrade::Containers::ArrayView<const Matrix3<Float>> b, Corrade::Containers::ArrayView<Matrix3<Float>> out);
+
+/**
+@brief Dot product of vectors pair-wise
+
+Saves @ref dot(const Vector<size, T>&, const Vector<size, T>&) "dot(a[i], b[i])"
+to @p out for each @f$ i @f$. Expects that all views have the same size.
+*/
+void MAGNUM_EXPORT dot(Corrade::Containers::ArrayView<const Vector2<Float>> a, Corrade::Containers::ArrayView<const Vector2<Float>> b, Corrade::Containers::ArrayView<Float> out);
+
+/** @overload */
+void MAGNUM_EXPORT dot(Corrade::Containers::ArrayView<const Vector3<Float>> a, Corrade::Containers::ArrayView<const Vector3<Float>> b, Corrade::Containers::ArrayView<Float> out);
+
+/** @overload */
+void MAGNUM_EXPORT dot(Corrade::Containers::ArrayView<const Vector4<Float>> a, Corrade::Containers::ArrayView<const Vector4<Float>> b, Corrade::Containers::ArrayView<Float> out);
+
+/**
+@brief Normalize vectors
+
+Saves @ref Vector::normalized() "vectors[i].normalized()" to @p out for each
+@f$ i @f$. Expects that both views have the same size, they can point to the
+same memory for in-place normalization. Not to be confused with
+@ref normalize(const Integral&), which converts integral values to normalized
+floating-point.
+*/
+void MAGNUM_EXPORT normalize(Corrade::Containers::ArrayView<const Vector2<Float>> vectors, Corrade::Containers::ArrayView<Vector2<Float>> out);
+
+/** @overload */
+void MAGNUM_EXPORT normalize(Corrade::Containers::ArrayView<const Vector3<Float>> vectors, Corrade::Containers::ArrayView<Vector3<Float>> out);
+
+/** @overload */
+void MAGNUM_EXPORT normalize(Corrade::Containers::ArrayView<const Vector4<Float>> vectors, Corrade::Containers::ArrayView<Vector4<Float>> out);
+
+/**
+@brief Linear interpolation of vectors
+
+Saves @ref lerp(const T&, const T&, U) "lerp(a[i], b[i], t)" to @p out for
+each @f$ i @f$. Expects that all views have the same size, @p out can point to
+the same memory as @p a or @p b.
+*/
+void MAGNUM_EXPORT lerp(Corrade::Containers::ArrayView<const Vector2<Float>> a, Corrade::Containers::ArrayView<const Vector2<Float>> b, Float t, Corrade::Containers::ArrayView<Vector2<Float>> out);
+
+/** @overload */
+void MAGNUM_EXPORT lerp(Corrade::Containers::ArrayView<const Vector3<Float>> a, Corrade::Containers::ArrayView<const Vector3<Float>> b, Float t, Corrade::Containers::ArrayView<Vector3<Float>> out);
+
+/** @overload */
+void MAGNUM_EXPORT lerp(Corrade::Containers::ArrayView<const Vector4<Float>> a, Corrade::Containers::ArrayView<const Vector4<Float>> b, Float t, Corrade::Containers::ArrayView<Vector4<Float>> out);
+
+/**
+@brief Linear interpolation of quaternions
+
+Saves @ref lerp(const Quaternion<T>&, const Quaternion<T>&, T) "lerp(normalizedA[i], normalizedB[i], t)"
+to @p out for each @f$ i @f$. The normalization of all input quaternions is
+checked once before the interpolation, not for every item. If
+@ref MAGNUM_TARGET_SSE is defined, four quaternions at a time are transposed
+into structure-of-arrays layout and processed with SSE intrinsics. Expects
+that all views have the same size, @p out can point to the same memory as
+@p normalizedA or @p normalizedB.
+
+As with all other batch functions, no state is kept between calls, so large
+arrays can be split into slices processed in parallel on multiple threads.
+*/
+void MAGNUM_EXPORT lerp(Corrade::Containers::ArrayView<const Quaternion<Float>> normalizedA, Corrade::Containers::ArrayView<const Quaternion<Float>> normalizedB, Float t, Corrade::Containers::ArrayView<Quaternion<Float>> out);
+
+/**
+@brief Spherical linear interpolation of quaternions
+
+Saves @ref slerp(const Quaternion<T>&, const Quaternion<T>&, T) "slerp(normalizedA[i], normalizedB[i], t)"
+to @p out for each @f$ i @f$. The normalization of all input quaternions is
+checked once before the interpolation, not for every item. Expects that all
+views have the same size, @p out can point to the same memory as
+@p normalizedA or @p normalizedB.
+*/
+void MAGNUM_EXPORT slerp(Corrade::Containers::ArrayView<const Quaternion<Float>> normalizedA, Corrade::Containers::ArrayView<const Quaternion<Float>> normalizedB, Float t, Corrade::Containers::ArrayView<Quaternion<Float>> out);
+
+/**
+@brief Screw linear interpolation of dual quaternions
+
+Saves @ref sclerp(const DualQuaternion<T>&, const DualQuaternion<T>&, T) "sclerp(normalizedA[i], normalizedB[i], t)"
+to @p out for each @f$ i @f$. The normalization of all input dual quaternions
+is checked once before the interpolation, not for every item. Expects that
+all views have the same size, @p out can point to the same memory as
+@p normalizedA or @p normalizedB.
+*/
+void MAGNUM_EXPORT sclerp(Corrade::Containers::ArrayView<const DualQuaternion<Float>> normalizedA, Corrade::Containers::ArrayView<const DualQuaternion<Float>> normalizedB, Float t, Corrade::Containers::ArrayView<DualQuaternion<Float>> out);
+
+/**
+@brief Dual quaternion skinning of points
+@param joints       Normalized joint transformations
+@param jointIds     Indices into @p joints for each point
+@param weights      Joint weights for each point
+@param points       Points to transform
+@param out          Where to save the transformed points
+
+Implements dual quaternion linear blending as described in
+[Skinning with Dual Quaternions](https://www.cs.utah.edu/~ladislav/kavan07skinning/kavan07skinning.html)
+by Kavan et al. For each point, the four joint transformations given by
+@p jointIds are blended with @p weights, flipping those in opposite hemisphere
+than the first one, the result is normalized and applied to the point. Points
+influenced by less than four joints should have the remaining weights set to
+zero. The weights are expected to sum up to one.
+
+Expects that all joints are normalized, all joint IDs are in range and that
+all views except @p joints have the same size. The input is validated once
+before the transformation, not for every item. If @ref MAGNUM_TARGET_SSE is
+defined, four points at a time are processed in structure-of-arrays layout
+with SSE intrinsics. No state is kept between calls, so large meshes can be
+split into slices processed in parallel on multiple threads.
+*/
+void MAGNUM_EXPORT skin(Corrade::Containers::ArrayView<const DualQuaternion<Float>> joints, Corrade::Containers::ArrayView<const Vector4<UnsignedInt>> jointIds, Corrade::Containers::ArrayView<const Vector4<Float>> weights, Corrade::Containers::ArrayView<const Vector3<Float>> points, Corrade::Containers::ArrayView<Vector3<Float>> out);
+
+/**
+@overload
+
+Additionally rotates @p normals with the blended transformation and saves
+them to @p outNormals, sharing the blending work with the points.
+*/
+void MAGNUM_EXPORT skin(Corrade::Containers::ArrayView<const DualQuaternion<Float>> joints, Corrade::Containers::ArrayView<const Vector4<UnsignedInt>> jointIds, Corrade::Containers::ArrayView<const Vector4<Float>> weights, Corrade::Containers::ArrayView<const Vector3<Float>> points, Corrade::Containers::ArrayView<const Vector3<Float>> normals, Corrade::Containers::ArrayView<Vector3<Float>> out, Corrade::Containers::ArrayView<Vector3<Float>> outNormals);
+
+/**
+@brief Evaluate Bézier curves
+
+Saves @ref Bezier::value() "curves[i].value(t[i])" to @p out for each
+@f$ i @f$. If @ref MAGNUM_TARGET_SSE is defined, control points of four curves
+at a time are transposed into structure-of-arrays layout and the De
+Casteljau's algorithm is done on all of them at once. Expects that all views
+have the same size.
+*/
+void MAGNUM_EXPORT bezierValues(Corrade::Containers::ArrayView<const Bezier<2, 2, Float>> curves, Corrade::Containers::ArrayView<const Float> t, Corrade::Containers::ArrayView<Vector2<Float>> out);
+
+/** @overload */
+void MAGNUM_EXPORT bezierValues(Corrade::Containers::ArrayView<const Bezier<3, 3, Float>> curves, Corrade::Containers::ArrayView<const Float> t, Corrade::Containers::ArrayView<Vector3<Float>> out);
+
+}}
+
+#endif
@@ -30,12 +30,63 @@
  * @brief Class @ref Magnum::Math::Bezier, alias @ref Magnum::Math::QuadraticBezier, @ref Magnum::Math::QuadraticBezier2D, @ref Magnum::Math::QuadraticBezier3D, @ref Magnum::Math::CubicBezier, @ref Magnum::Math::CubicBezier2D, @ref Magnum::Math::CubicBezier3D
  */
 
-#include <array>
+#include <algorithm>
+#include <Corrade/Containers/ArrayView.h>
 
-#include "Magnum/Math/Vector.h"
+#include "Magnum/Math/Range.h"
 
 namespace Magnum { namespace Math {
 
+namespace Implementation {
+    /* Interpolation factors in (0, 1) at which given coordinate of the curve
+       has a local extremum, found as roots of the derivative. Implemented
+       only for quadratic and cubic curves, returns count of found factors. */
+    template<UnsignedInt order> struct BezierExtrema {
+        template<std::size_t size, class T> static std::size_t extrema(const Vector<size, T>*, std::size_t, Float*) { return 0; }
+    };
+    template<> struct BezierExtrema<2> {
+        template<std::size_t size, class T> static std::size_t extrema(const Vector<size, T>* const p, const std::size_t i, Float* const out) {
+            /* Linear derivative d0 + (d1 - d0)t */
+            const T d0 = p[1][i] - p[0][i];
+            const T d1 = p[2][i] - p[1][i];
+            if(d0 == d1) return 0;
+            const Float t = Float(d0/(d0 - d1));
+            if(!(t > 0.0f && t < 1.0f)) return 0;
+            out[0] = t;
+            return 1;
+        }
+    };
+    template<> struct BezierExtrema<3> {
+        template<std::size_t size, class T> static std::size_t extrema(const Vector<size, T>* const p, const std::size_t i, Float* const out) {
+            /* Quadratic derivative at^2 + bt + c */
+            const T d0 = p[1][i] - p[0][i];
+            const T d1 = p[2][i] - p[1][i];
+            const T d2 = p[3][i] - p[2][i];
+            const T a = d0 - 2*d1 + d2;
+            const T b = 2*(d1 - d0);
+            const T c = d0;
+
+            Float t[2];
+            std::size_t count = 0;
+            if(a == T(0)) {
+                if(b == T(0)) return 0;
+                t[count++] = Float(-c/b);
+            } else {
+                const T discriminant = b*b - 4*a*c;
+                if(discriminant < T(0)) return 0;
+                const T root = std::sqrt(discriminant);
+                t[count++] = Float((-b + root)/(2*a));
+                t[count++] = Float((-b - root)/(2*a));
+            }
+
+            std::size_t found = 0;
+            for(std::size_t j = 0; j != count; ++j)
+                if(t[j] > 0.0f && t[j] < 1.0f) out[found++] = t[j];
+            return found;
+        }
+    };
+}
+
 /**
 @brief Bézier curve
 @tparam order       Order of Bézier curve
@@ -119,11 +170,20 @@ template<UnsignedInt order, UnsignedInt dimensions, class T> class Bezier {
          * @brief Interpolate the curve at given position
          *
          * Returns point on the curve for given interpolation factor. Uses
-         * the [De Casteljau's algorithm](https://en.wikipedia.org/wiki/De_Casteljau%27s_algorithm).
-         * @see @ref subdivide()
+         * the [De Casteljau's algorithm](https://en.wikipedia.org/wiki/De_Casteljau%27s_algorithm)
+         * in-place on a copy of the control points, so only @ref Order + 1
+         * temporaries are needed.
+         * @see @ref subdivide(), @ref derivative(),
+         *      @ref bezierValues(Corrade::Containers::ArrayView<const Bezier<3, 3, Float>>, Corrade::Containers::ArrayView<const Float>, Corrade::Containers::ArrayView<Vector3<Float>>)
          */
         Vector<dimensions, T> value(Float t) const {
-            return calculateIntermediatePoints(t)[0][order];
+            Vector<dimensions, T> points[order + 1];
+            for(std::size_t i = 0; i <= order; ++i)
+                points[i] = _data[i];
+            for(std::size_t r = 1; r <= order; ++r)
+                for(std::size_t i = 0; i <= order - r; ++i)
+                    points[i] = (1 - t)*points[i] + t*points[i + 1];
+            return points[0];
         }
 
         /**
@@ -134,15 +194,87 @@ template<UnsignedInt order, UnsignedInt dimensions, class T> class Bezier {
          * @see @ref value()
          */
         std::pair<Bezier<order, dimensions, T>, Bezier<order, dimensions, T>> subdivide(Float t) const {
-            const auto iPoints = calculateIntermediatePoints(t);
-            Bezier<order, dimensions, T> left, right;
+            Vector<dimensions, T> points[order + 1];
             for(std::size_t i = 0; i <= order; ++i)
-                left[i] = iPoints[0][i];
-            for(std::size_t i = 0, j = order; i <= order; --j, ++i)
-                right[i] = iPoints[i][j];
+                points[i] = _data[i];
+
+            /* Left curve is formed by first points of each iteration, right
+               curve by the last ones */
+            Bezier<order, dimensions, T> left{NoInit}, right{NoInit};
+            left[0] = points[0];
+            right[order] = points[order];
+            for(std::size_t r = 1; r <= order; ++r) {
+                for(std::size_t i = 0; i <= order - r; ++i)
+                    points[i] = (1 - t)*points[i] + t*points[i + 1];
+                left[r] = points[0];
+                right[order - r] = points[order - r];
+            }
             return {left, right};
         }
 
+        /**
+         * @brief Derivative of the curve
+         *
+         * Returns a curve of one order lower, its value at given position is
+         * the tangent of this curve at the same position. Available only for
+         * curves with order larger than one, calling it on a linear curve is
+         * a compile-time error. Derivative of a linear curve is just the
+         * constant `(*this)[1] - (*this)[0]`.
+         * @f[
+         *      \boldsymbol{Q}_i = n (\boldsymbol{P}_{i + 1} - \boldsymbol{P}_i)
+         * @f]
+         */
+        Bezier<order - 1, dimensions, T> derivative() const {
+            static_assert(order > 1, "Bezier::derivative(): derivative of a linear curve is a constant, not a curve");
+            Bezier<order - 1, dimensions, T> out{NoInit};
+            for(std::size_t i = 0; i != order; ++i)
+                out[i] = T(order)*(_data[i + 1] - _data[i]);
+            return out;
+        }
+
+        /**
+         * @brief Bounding range of the curve
+         *
+         * For linear, quadratic and cubic curves the range is tight, computed
+         * from end points and local extrema of each coordinate, which are
+         * found analytically as roots of the derivative. For higher orders
+         * the range of all control points is returned, which encloses the
+         * curve thanks to its convex hull property, but might not be tight.
+         */
+        Range<dimensions, T> bounds() const;
+
+        /**
+         * @brief Fill arc length lookup table
+         *
+         * Samples the curve at `out.size()` uniformly distributed
+         * positions, including both end points, and saves cumulative length
+         * of the polyline going through the samples to @p out. The first
+         * item is always zero, the last is an approximation of curve length
+         * which gets more precise with more samples. Expects that @p out has
+         * at least two items. The table is meant to be computed once and
+         * then used with @ref arcLengthParameter() for sampling the curve
+         * with constant speed. No allocation is done, the storage is owned
+         * by the caller.
+         */
+        void arcLengths(Corrade::Containers::ArrayView<T> out) const;
+
+        /**
+         * @brief Interpolation factor for given arc length
+         *
+         * Finds interpolation factor at which the curve reaches given
+         * @p length from its beginning, using a binary search in lookup
+         * table computed with @ref arcLengths() and linear interpolation
+         * between its samples. The length is clamped to range of the table.
+         * Passing the result to @ref value() gives constant speed motion
+         * along the curve:
+         * @code
+         * Float table[32];
+         * bezier.arcLengths(table);
+         * Vector2 position = bezier.value(CubicBezier2D::arcLengthParameter(table, speed*time));
+         * @endcode
+         */
+        static Float arcLengthParameter(Corrade::Containers::ArrayView<const T> arcLengths, T length);
+
     private:
         /* Implementation for Bezier<order, dimensions, T>::Bezier(const Bezier<order, dimensions, U>&) */
         template<class U, std::size_t ...sequence> constexpr explicit Bezier(Implementation::Sequence<sequence...>, const Bezier<order, dimensions, U>& other) noexcept: _data{Vector<dimensions, T>(other._data[sequence])...} {}
@@ -151,20 +283,6 @@ template<UnsignedInt order, UnsignedInt dimensions, class T> class Bezier {
         /* MSVC 2015 can't handle {} here */
         template<class U, std::size_t ...sequence> constexpr explicit Bezier(Implementation::Sequence<sequence...>, U): _data{Vector<dimensions, T>((static_cast<void>(sequence), U{typename U::Init{}}))...} {}
 
-        /* Calculates and returns all intermediate points generated when using De Casteljau's algorithm */
-        std::array<Bezier<order, dimensions, T>, order + 1> calculateIntermediatePoints(Float t) const {
-            std::array<Bezier<order, dimensions, T>, order + 1> iPoints;
-            for(std::size_t i = 0; i <= order; ++i) {
-                iPoints[i][0] = _data[i];
-            }
-            for(std::size_t r = 1; r <= order; ++r) {
-                for(std::size_t i = 0; i <= order - r; ++i) {
-                    iPoints[i][r] = (1 - t)*iPoints[i][r - 1] + t*iPoints[i + 1][r - 1];
-                }
-            }
-            return iPoints;
-        }
-
         Vector<dimensions, T> _data[order + 1];
 };
 
@@ -262,6 +380,60 @@ extern template MAGNUM_EXPORT Corrade::Utility::Debug& operator<<(Corrade::Utili
 extern template MAGNUM_EXPORT Corrade::Utility::Debug& operator<<(Corrade::Utility::Debug&, const Bezier<3, 3, Double>&);
 #endif
 
+template<UnsignedInt order, UnsignedInt dimensions, class T> Range<dimensions, T> Bezier<order, dimensions, T>::bounds() const {
+    Vector<dimensions, T> min = Math::min(_data[0], _data[order]);
+    Vector<dimensions, T> max = Math::max(_data[0], _data[order]);
+
+    /* Tight bounds from local extrema of each coordinate */
+    if(order <= 3) {
+        for(std::size_t i = 0; i != dimensions; ++i) {
+            Float t[2];
+            const std::size_t count = Implementation::BezierExtrema<order>::extrema(_data, i, t);
+            for(std::size_t j = 0; j != count; ++j) {
+                const T extremum = value(t[j])[i];
+                min[i] = Math::min(min[i], extremum);
+                max[i] = Math::max(max[i], extremum);
+            }
+        }
+
+    /* Conservative bounds from the convex hull */
+    } else for(std::size_t i = 1; i != order; ++i) {
+        min = Math::min(min, _data[i]);
+        max = Math::max(max, _data[i]);
+    }
+
+    return {min, max};
+}
+
+template<UnsignedInt order, UnsignedInt dimensions, class T> void Bezier<order, dimensions, T>::arcLengths(const Corrade::Containers::ArrayView<T> out) const {
+    CORRADE_ASSERT(out.size() >= 2,
+        "Math::Bezier::arcLengths(): expected at least two items but got" << out.size(), );
+
+    const Float step = 1.0f/Float(out.size() - 1);
+    Vector<dimensions, T> previous = _data[0];
+    out[0] = T(0);
+    for(std::size_t i = 1; i != out.size(); ++i) {
+        const Vector<dimensions, T> current = i + 1 == out.size() ? _data[order] : value(Float(i)*step);
+        out[i] = out[i - 1] + (current - previous).length();
+        previous = current;
+    }
+}
+
+template<UnsignedInt order, UnsignedInt dimensions, class T> Float Bezier<order, dimensions, T>::arcLengthParameter(const Corrade::Containers::ArrayView<const T> arcLengths, const T length) {
+    CORRADE_ASSERT(arcLengths.size() >= 2,
+        "Math::Bezier::arcLengthParameter(): expected at least two items but got" << arcLengths.size(), {});
+
+    const std::size_t last = arcLengths.size() - 1;
+    if(!(length > arcLengths[0])) return 0.0f;
+    if(!(length < arcLengths[last])) return 1.0f;
+
+    /* First sample after given length, the previous one is then before */
+    const std::size_t i = std::upper_bound(arcLengths.begin(), arcLengths.end(), length) - arcLengths.begin();
+    const T segment = arcLengths[i] - arcLengths[i - 1];
+    const Float fraction = segment == T(0) ? 0.0f : Float((length - arcLengths[i - 1])/segment);
+    return (Float(i - 1) + fraction)/Float(last);
+}
+
 }}
 
 namespace Corrade { namespace Utility {
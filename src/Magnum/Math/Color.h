@@ -123,6 +123,56 @@ template<class T> inline typename Color3<T>::HSV toHSV(typename std::enable_if<s
     return toHSV<typename Color3<T>::FloatingPointType>(normalize<Color3<typename Color3<T>::FloatingPointType>>(color));
 }
 
+/* sRGB transfer function and its inverse, for a single channel */
+template<class T> inline T fromSrgb(T value) {
+    return value <= T(0.04045) ? value/T(12.92) :
+        std::pow((value + T(0.055))/T(1.055), T(2.4));
+}
+template<class T> inline T toSrgb(T value) {
+    return value <= T(0.0031308) ? value*T(12.92) :
+        T(1.055)*std::pow(value, T(1)/T(2.4)) - T(0.055);
+}
+
+/* Convert color from sRGB */
+template<class T> inline typename std::enable_if<std::is_floating_point<T>::value, Color3<T>>::type fromSrgb(const Vector3<typename Color3<T>::FloatingPointType>& srgb) {
+    return {fromSrgb(srgb[0]), fromSrgb(srgb[1]), fromSrgb(srgb[2])};
+}
+template<class T> inline typename std::enable_if<std::is_integral<T>::value, Color3<T>>::type fromSrgb(const Vector3<typename Color3<T>::FloatingPointType>& srgb) {
+    return denormalize<Color3<T>>(fromSrgb<typename Color3<T>::FloatingPointType>(srgb));
+}
+
+/* Convert color to sRGB */
+template<class T> inline Vector3<typename Color3<T>::FloatingPointType> toSrgb(typename std::enable_if<std::is_floating_point<T>::value, const Color3<T>&>::type color) {
+    return {toSrgb(color[0]), toSrgb(color[1]), toSrgb(color[2])};
+}
+template<class T> inline Vector3<typename Color3<T>::FloatingPointType> toSrgb(typename std::enable_if<std::is_integral<T>::value, const Color3<T>&>::type color) {
+    return toSrgb<typename Color3<T>::FloatingPointType>(normalize<Color3<typename Color3<T>::FloatingPointType>>(color));
+}
+
+/* Convert color from sRGB + alpha */
+template<class T> inline typename std::enable_if<std::is_floating_point<T>::value, Color4<T>>::type fromSrgbAlpha(const Vector4<typename Color4<T>::FloatingPointType>& srgbAlpha) {
+    return {fromSrgb<T>(srgbAlpha.rgb()), srgbAlpha.a()};
+}
+template<class T> inline typename std::enable_if<std::is_integral<T>::value, Color4<T>>::type fromSrgbAlpha(const Vector4<typename Color4<T>::FloatingPointType>& srgbAlpha) {
+    return denormalize<Color4<T>>(fromSrgbAlpha<typename Color4<T>::FloatingPointType>(srgbAlpha));
+}
+
+/* Convert color to sRGB + alpha */
+template<class T> inline Vector4<typename Color4<T>::FloatingPointType> toSrgbAlpha(typename std::enable_if<std::is_floating_point<T>::value, const Color4<T>&>::type color) {
+    return {toSrgb<T>(color.rgb()), color.a()};
+}
+template<class T> inline Vector4<typename Color4<T>::FloatingPointType> toSrgbAlpha(typename std::enable_if<std::is_integral<T>::value, const Color4<T>&>::type color) {
+    return toSrgbAlpha<typename Color4<T>::FloatingPointType>(normalize<Color4<typename Color4<T>::FloatingPointType>>(color));
+}
+
+/* Convert floating-point sRGB values to integral. Unlike denormalize(), the
+   values are rounded to nearest. */
+template<class Integral, std::size_t size, class T> inline Vector<size, Integral> denormalizeSrgb(const Vector<size, T>& srgb) {
+    static_assert(std::is_floating_point<T>::value && std::is_integral<Integral>::value,
+        "Math::Color::toSrgb(): conversion must be done to integral type");
+    return Vector<size, Integral>(round(srgb*T(std::numeric_limits<Integral>::max())));
+}
+
 /* Value for full channel (1.0f for floats, 255 for unsigned byte) */
 template<class T> constexpr typename std::enable_if<std::is_floating_point<T>::value, T>::type fullChannel() {
     return T(1);
@@ -151,6 +201,12 @@ Conversion from and to HSV is done always using floating-point types, so hue
 is always in range in range @f$ [0.0, 360.0] @f$, saturation and value in
 range @f$ [0.0, 1.0] @f$.
 
+The color is assumed to be in linear RGB. Conversion from and to sRGB is done
+using @ref fromSrgb() and @ref toSrgb(), again always using floating-point
+types for the computation. For converting whole images see
+@ref Math::fromSrgb(Corrade::Containers::ArrayView<const Color3<UnsignedByte>>, Corrade::Containers::ArrayView<Color3<Float>>)
+and @ref Math::toSrgb(Corrade::Containers::ArrayView<const Color3<Float>>, Corrade::Containers::ArrayView<Color3<UnsignedByte>>).
+
 @see @link operator""_rgb() @endlink, @link operator""_rgbf() @endlink,
     @ref Color4, @ref Magnum::Color3, @ref Magnum::Color3ub
 */
@@ -249,6 +305,49 @@ template<class T> class Color3: public Vector3<T> {
             return fromHSV(std::make_tuple(hue, saturation, value));
         }
 
+        /**
+         * @brief Create linear RGB color from sRGB representation
+         * @param srgb  Color in sRGB color space
+         *
+         * Applies inverse sRGB curve onto input, returning the input in
+         * linear RGB color space with D65 illuminant and 2° standard
+         * observer: @f[
+         *      \boldsymbol{c}_\mathrm{linear} = \begin{cases}
+         *          \dfrac{\boldsymbol{c}_\mathrm{sRGB}}{12.92}, & \boldsymbol{c}_\mathrm{sRGB} \le 0.04045 \\
+         *          \left( \dfrac{0.055 + \boldsymbol{c}_\mathrm{sRGB}}{1 + 0.055} \right)^{2.4}, & \boldsymbol{c}_\mathrm{sRGB} > 0.04045
+         *      \end{cases}
+         * @f]
+         * @see @ref toSrgb(), @ref Color4::fromSrgbAlpha()
+         */
+        static Color3<T> fromSrgb(const Vector3<FloatingPointType>& srgb) {
+            return Implementation::fromSrgb<T>(srgb);
+        }
+
+        /**
+         * @brief Create linear RGB color from integral sRGB representation
+         * @param srgb  Color in sRGB color space
+         *
+         * Useful in cases where you have for example an 8-bit sRGB
+         * representation and want to create a floating-point linear RGB
+         * color out of it:
+         * @code
+         * Math::Vector3<UnsignedByte> srgb;
+         * auto rgb = Color3::fromSrgb(srgb);
+         * @endcode
+         *
+         * The input is normalized using @ref normalize() and then passed to
+         * @ref fromSrgb(const Vector3<FloatingPointType>&).
+         */
+        template<class Integral> static
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        typename std::enable_if<std::is_integral<Integral>::value, Color3<T>>::type
+        #else
+        Color3<T>
+        #endif
+        fromSrgb(const Vector3<Integral>& srgb) {
+            return fromSrgb(normalize<Vector3<FloatingPointType>>(srgb));
+        }
+
         /**
          * @brief Default constructor
          *
@@ -342,6 +441,42 @@ template<class T> class Color3: public Vector3<T> {
             return Implementation::value<T>(*this);
         }
 
+        /**
+         * @brief Convert to sRGB representation
+         *
+         * Assuming the color is in linear RGB with D65 illuminant and 2°
+         * standard observer, applies sRGB curve onto it, returning the color
+         * represented in sRGB color space: @f[
+         *      \boldsymbol{c}_\mathrm{sRGB} = \begin{cases}
+         *          12.92\boldsymbol{c}_\mathrm{linear}, & \boldsymbol{c}_\mathrm{linear} \le 0.0031308 \\
+         *          (1 + 0.055) \boldsymbol{c}_\mathrm{linear}^{1/2.4}-0.055, & \boldsymbol{c}_\mathrm{linear} > 0.0031308
+         *      \end{cases}
+         * @f]
+         * @see @ref fromSrgb(), @ref Color4::toSrgbAlpha()
+         */
+        Vector3<FloatingPointType> toSrgb() const {
+            return Implementation::toSrgb<T>(*this);
+        }
+
+        /**
+         * @brief Convert to integral sRGB representation
+         *
+         * Useful in cases where you have a floating-point linear RGB color
+         * and want to create for example an 8-bit sRGB representation out of
+         * it:
+         * @code
+         * Color3 color;
+         * Math::Vector3<UnsignedByte> srgb = color.toSrgb<UnsignedByte>();
+         * @endcode
+         *
+         * Unlike @ref denormalize(), the result of @ref toSrgb() is rounded to
+         * nearest integral value, as the truncation error would be very
+         * visible in dark areas.
+         */
+        template<class Integral> Vector3<Integral> toSrgb() const {
+            return Implementation::denormalizeSrgb<Integral>(toSrgb());
+        }
+
         MAGNUM_VECTOR_SUBCLASS_IMPLEMENTATION(3, Color3)
 };
 
@@ -444,6 +579,49 @@ class Color4: public Vector4<T> {
             return fromHSV(std::make_tuple(hue, saturation, value), alpha);
         }
 
+        /**
+         * @brief Create linear RGBA color from sRGB + alpha representation
+         * @param srgbAlpha Color in sRGB color space with linear alpha
+         *
+         * Applies inverse sRGB curve onto RGB channels of the input, alpha
+         * channel is assumed to be linear. See @ref Color3::fromSrgb() for
+         * more information.
+         * @see @ref toSrgbAlpha()
+         */
+        static Color4<T> fromSrgbAlpha(const Vector4<FloatingPointType>& srgbAlpha) {
+            return Implementation::fromSrgbAlpha<T>(srgbAlpha);
+        }
+
+        /**
+         * @brief Create linear RGBA color from sRGB representation
+         * @param srgb  Color in sRGB color space
+         * @param a     Alpha value, defaults to `1.0` for floating-point types
+         *      and maximum positive value for integral types.
+         *
+         * Applies inverse sRGB curve onto RGB channels of the input. See
+         * @ref Color3::fromSrgb() for more information.
+         */
+        static Color4<T> fromSrgb(const Vector3<FloatingPointType>& srgb, T a = Implementation::fullChannel<T>()) {
+            return {Implementation::fromSrgb<T>(srgb), a};
+        }
+
+        /**
+         * @brief Create linear RGBA color from integral sRGB + alpha representation
+         * @param srgbAlpha Color in sRGB color space with linear alpha
+         *
+         * The input is normalized using @ref normalize() and then passed to
+         * @ref fromSrgbAlpha(const Vector4<FloatingPointType>&).
+         */
+        template<class Integral> static
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        typename std::enable_if<std::is_integral<Integral>::value, Color4<T>>::type
+        #else
+        Color4<T>
+        #endif
+        fromSrgbAlpha(const Vector4<Integral>& srgbAlpha) {
+            return fromSrgbAlpha(normalize<Vector4<FloatingPointType>>(srgbAlpha));
+        }
+
         /**
          * @brief Default constructor
          *
@@ -527,6 +705,27 @@ class Color4: public Vector4<T> {
             return Implementation::value<T>(Vector4<T>::rgb());
         }
 
+        /**
+         * @brief Convert to sRGB + alpha representation
+         *
+         * Applies sRGB curve onto RGB channels, alpha channel is kept linear.
+         * See @ref Color3::toSrgb() for more information.
+         * @see @ref fromSrgbAlpha()
+         */
+        Vector4<FloatingPointType> toSrgbAlpha() const {
+            return Implementation::toSrgbAlpha<T>(*this);
+        }
+
+        /**
+         * @brief Convert to integral sRGB + alpha representation
+         *
+         * All channels are rounded to nearest integral value, see
+         * @ref Color3::toSrgb() for more information.
+         */
+        template<class Integral> Vector4<Integral> toSrgbAlpha() const {
+            return Implementation::denormalizeSrgb<Integral>(toSrgbAlpha());
+        }
+
         MAGNUM_VECTOR_SUBCLASS_IMPLEMENTATION(4, Color4)
 };
 
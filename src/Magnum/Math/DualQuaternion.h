@@ -40,6 +40,36 @@ namespace Magnum { namespace Math {
 
 namespace Implementation {
     template<class, class> struct DualQuaternionConverter;
+
+    /* Used in sclerp() and its batch variant (no assertions) */
+    template<class T> DualQuaternion<T> sclerp(const DualQuaternion<T>& normalizedA, const DualQuaternion<T>& normalizedB, const T t) {
+        const T dotResult = dot(normalizedA.real().vector(), normalizedB.real().vector());
+
+        /* Avoid division by zero */
+        const T cosHalfAngle = dotResult + normalizedA.real().scalar()*normalizedB.real().scalar();
+        if(std::abs(cosHalfAngle) >= T(1))
+            return {normalizedA.real(), {Implementation::lerp(normalizedA.dual().vector(), normalizedB.dual().vector(), t), T(0)}};
+
+        /* l + εm = q_A^**q_B, multiplying with -1 ensures shortest path when dot < 0 */
+        const DualQuaternion<T> diff = normalizedA.quaternionConjugated()*(dotResult < T(0) ? -normalizedB : normalizedB);
+        const Quaternion<T>& l = diff.real();
+        const Quaternion<T>& m = diff.dual();
+
+        /* a/2 = acos(l_S) - εm_S/|l_V| */
+        const T invr = l.vector().lengthInverted();
+        const Dual<T> aHalf{std::acos(l.scalar()), -m.scalar()*invr};
+
+        /* direction = n_0 = l_V/|l_V|
+           moment = n_ε = (m_V - n_0*(a_ε/2)*l_S)/|l_V| */
+        const Vector3<T> direction = l.vector()*invr;
+        const Vector3<T> moment = (m.vector() - direction*(aHalf.dual()*l.scalar()))*invr;
+        const Dual<Vector3<T>> n{direction, moment};
+
+        /* q_ScLERP = q_A*(cos(t*a/2) + n*sin(t*a/2)) */
+        Dual<T> sin, cos;
+        std::tie(sin, cos) = Math::sincos(t*Dual<Rad<T>>(aHalf));
+        return normalizedA*DualQuaternion<T>{n*sin, cos};
+    }
 }
 
 /** @relatesalso DualQuaternion
@@ -66,32 +96,7 @@ Expects that both dual quaternions are normalized. @f[
 template<class T> inline DualQuaternion<T> sclerp(const DualQuaternion<T>& normalizedA, const DualQuaternion<T>& normalizedB, const T t) {
     CORRADE_ASSERT(normalizedA.isNormalized() && normalizedB.isNormalized(),
         "Math::sclerp(): dual quaternions must be normalized", {});
-    const T dotResult = dot(normalizedA.real().vector(), normalizedB.real().vector());
-
-    /* Avoid division by zero */
-    const T cosHalfAngle = dotResult + normalizedA.real().scalar()*normalizedB.real().scalar();
-    if(std::abs(cosHalfAngle) >= T(1))
-        return {normalizedA.real(), {Implementation::lerp(normalizedA.dual().vector(), normalizedB.dual().vector(), t), T(0)}};
-
-    /* l + εm = q_A^**q_B, multiplying with -1 ensures shortest path when dot < 0 */
-    const DualQuaternion<T> diff = normalizedA.quaternionConjugated()*(dotResult < T(0) ? -normalizedB : normalizedB);
-    const Quaternion<T>& l = diff.real();
-    const Quaternion<T>& m = diff.dual();
-
-    /* a/2 = acos(l_S) - εm_S/|l_V| */
-    const T invr = l.vector().lengthInverted();
-    const Dual<T> aHalf{std::acos(l.scalar()), -m.scalar()*invr};
-
-    /* direction = n_0 = l_V/|l_V|
-       moment = n_ε = (m_V - n_0*(a_ε/2)*l_S)/|l_V| */
-    const Vector3<T> direction = l.vector()*invr;
-    const Vector3<T> moment = (m.vector() - direction*(aHalf.dual()*l.scalar()))*invr;
-    const Dual<Vector3<T>> n{direction, moment};
-
-    /* q_ScLERP = q_A*(cos(t*a/2) + n*sin(t*a/2)) */
-    Dual<T> sin, cos;
-    std::tie(sin, cos) = Math::sincos(t*Dual<Rad<T>>(aHalf));
-    return normalizedA*DualQuaternion<T>{n*sin, cos};
+    return Implementation::sclerp(normalizedA, normalizedB, t);
 }
 
 /**
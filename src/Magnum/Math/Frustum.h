@@ -0,0 +1,184 @@
+#ifndef Magnum_Math_Frustum_h
+#define Magnum_Math_Frustum_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2016 Ashwin Ravichandran <ashwinravichandran24@gmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::Frustum
+ */
+
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Camera frustum
+
+Defined by six planes, each represented by a @ref Vector4 containing plane
+normal in its first three components and distance from origin in the last, so
+that point @f$ \boldsymbol p @f$ is inside the half-space defined by the plane
+if @f$ \boldsymbol n \cdot \boldsymbol p + d \ge 0 @f$. The normals are
+pointing inside the frustum. See @ref Geometry::Intersection::pointFrustum(),
+@ref Geometry::Intersection::rangeFrustum() and
+@ref Geometry::Intersection::sphereFrustum() for visibility queries.
+@see @ref Magnum::Frustum, @ref Magnum::Frustumd
+*/
+template<class T> class Frustum {
+    public:
+        typedef T Type;             /**< @brief Underlying data type */
+
+        /**
+         * @brief Create frustum from projection matrix
+         *
+         * Extracts the planes from a projection matrix or a combined
+         * projection and view matrix using the Gribb/Hartmann method. The
+         * planes are normalized, so the plane equation gives a signed
+         * distance of the point from the plane, which is needed for
+         * @ref Geometry::Intersection::sphereFrustum().
+         */
+        static Frustum<T> fromMatrix(const Matrix4<T>& m) {
+            const Vector4<T> x = m.row(0);
+            const Vector4<T> y = m.row(1);
+            const Vector4<T> z = m.row(2);
+            const Vector4<T> w = m.row(3);
+            return {normalizePlane(w + x),
+                    normalizePlane(w - x),
+                    normalizePlane(w + y),
+                    normalizePlane(w - y),
+                    normalizePlane(w + z),
+                    normalizePlane(w - z)};
+        }
+
+        /**
+         * @brief Default constructor
+         *
+         * Equivalent to planes of the @f$ [-1, 1] @f$ cube, i.e. a frustum
+         * of an identity projection matrix.
+         */
+        constexpr /*implicit*/ Frustum() noexcept: _data{
+            { T(1),  T(0),  T(0), T(1)},
+            {-T(1),  T(0),  T(0), T(1)},
+            { T(0),  T(1),  T(0), T(1)},
+            { T(0), -T(1),  T(0), T(1)},
+            { T(0),  T(0),  T(1), T(1)},
+            { T(0),  T(0), -T(1), T(1)}} {}
+
+        /** @brief Construct frustum without initializing the contents */
+        explicit Frustum(NoInitT) noexcept: _data{Vector4<T>{NoInit}, Vector4<T>{NoInit}, Vector4<T>{NoInit}, Vector4<T>{NoInit}, Vector4<T>{NoInit}, Vector4<T>{NoInit}} {}
+
+        /** @brief Construct frustum from planes */
+        constexpr /*implicit*/ Frustum(const Vector4<T>& left, const Vector4<T>& right, const Vector4<T>& bottom, const Vector4<T>& top, const Vector4<T>& near, const Vector4<T>& far) noexcept: _data{left, right, bottom, top, near, far} {}
+
+        /**
+         * @brief Construct frustum from another of different type
+         *
+         * Performs only default casting on the values, no rounding or
+         * anything else.
+         */
+        template<class U> constexpr explicit Frustum(const Frustum<U>& other) noexcept: _data{
+            Vector4<T>{other[0]}, Vector4<T>{other[1]}, Vector4<T>{other[2]},
+            Vector4<T>{other[3]}, Vector4<T>{other[4]}, Vector4<T>{other[5]}} {}
+
+        /** @brief Equality comparison */
+        bool operator==(const Frustum<T>& other) const {
+            for(std::size_t i = 0; i != 6; ++i)
+                if(_data[i] != other._data[i]) return false;
+            return true;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const Frustum<T>& other) const {
+            return !operator==(other);
+        }
+
+        /**
+         * @brief Raw data
+         * @return One-dimensional array of 24 elements, planes in order
+         *      left, right, bottom, top, near, far
+         */
+        T* data() { return _data[0].data(); }
+        constexpr const T* data() const { return _data[0].data(); } /**< @overload */
+
+        /**
+         * @brief Plane at given index
+         *
+         * @p i should not be larger than `5`, the planes are in order left,
+         * right, bottom, top, near, far.
+         */
+        Vector4<T>& operator[](std::size_t i) { return _data[i]; }
+        constexpr Vector4<T> operator[](std::size_t i) const { return _data[i]; } /**< @overload */
+
+        /** @brief Left plane */
+        Vector4<T>& left() { return _data[0]; }
+        constexpr Vector4<T> left() const { return _data[0]; } /**< @overload */
+
+        /** @brief Right plane */
+        Vector4<T>& right() { return _data[1]; }
+        constexpr Vector4<T> right() const { return _data[1]; } /**< @overload */
+
+        /** @brief Bottom plane */
+        Vector4<T>& bottom() { return _data[2]; }
+        constexpr Vector4<T> bottom() const { return _data[2]; } /**< @overload */
+
+        /** @brief Top plane */
+        Vector4<T>& top() { return _data[3]; }
+        constexpr Vector4<T> top() const { return _data[3]; } /**< @overload */
+
+        /** @brief Near plane */
+        Vector4<T>& near() { return _data[4]; }
+        constexpr Vector4<T> near() const { return _data[4]; } /**< @overload */
+
+        /** @brief Far plane */
+        Vector4<T>& far() { return _data[5]; }
+        constexpr Vector4<T> far() const { return _data[5]; } /**< @overload */
+
+    private:
+        static Vector4<T> normalizePlane(const Vector4<T>& plane) {
+            return plane/plane.xyz().length();
+        }
+
+        Vector4<T> _data[6];
+};
+
+/** @debugoperator{Magnum::Math::Frustum} */
+template<class T> Corrade::Utility::Debug& operator<<(Corrade::Utility::Debug& debug, const Frustum<T>& value) {
+    debug << "Frustum({" << Corrade::Utility::Debug::nospace;
+    for(std::size_t i = 0; i != 6; ++i) {
+        if(i != 0) debug << Corrade::Utility::Debug::nospace << "},\n        {" << Corrade::Utility::Debug::nospace;
+        for(std::size_t j = 0; j != 4; ++j) {
+            if(j != 0) debug << Corrade::Utility::Debug::nospace << ",";
+            debug << value[i][j];
+        }
+    }
+    return debug << Corrade::Utility::Debug::nospace << "})";
+}
+
+}}
+
+#endif
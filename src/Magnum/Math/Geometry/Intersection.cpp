@@ -0,0 +1,201 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Intersection.h"
+
+namespace Magnum { namespace Math { namespace Geometry {
+
+namespace {
+
+/* Calls consumer(i, mask) with bits of mask set for items starting at i
+   that intersect the frustum. If SIMD is enabled, four items at a time are
+   transposed into structure-of-arrays layout and tested against all six
+   planes, the remaining items are processed one by one using the regular
+   API. The operations are done in the same order as in the regular API, so
+   the results are the same. */
+template<class Consumer> void rangesFrustum(const Corrade::Containers::ArrayView<const Range3D<Float>> ranges, const Frustum<Float>& frustumRef, Consumer&& consumer) {
+    /* Local copy so the compiler doesn't need to reload the planes after
+       each write to the output */
+    const Frustum<Float> frustum = frustumRef;
+    std::size_t i = 0;
+
+    #ifdef MAGNUM_TARGET_SSE
+    __m128 normalX[6], normalY[6], normalZ[6], absX[6], absY[6], absZ[6], distance[6];
+    for(std::size_t p = 0; p != 6; ++p) {
+        const Vector4<Float> plane = frustum[p];
+        normalX[p] = _mm_set1_ps(plane.x());
+        normalY[p] = _mm_set1_ps(plane.y());
+        normalZ[p] = _mm_set1_ps(plane.z());
+        absX[p] = _mm_set1_ps(Math::abs(plane.x()));
+        absY[p] = _mm_set1_ps(Math::abs(plane.y()));
+        absZ[p] = _mm_set1_ps(Math::abs(plane.z()));
+        distance[p] = _mm_set1_ps(plane.w());
+    }
+
+    const __m128 half = _mm_set1_ps(0.5f);
+    for(; i + 4 <= ranges.size(); i += 4) {
+        /* Each range is six floats, load the first four and last four of
+           each and transpose them to get all components */
+        __m128 minX = _mm_loadu_ps(ranges[i].data());
+        __m128 minY = _mm_loadu_ps(ranges[i + 1].data());
+        __m128 minZ = _mm_loadu_ps(ranges[i + 2].data());
+        __m128 maxX = _mm_loadu_ps(ranges[i + 3].data());
+        _MM_TRANSPOSE4_PS(minX, minY, minZ, maxX);
+        __m128 unused = _mm_loadu_ps(ranges[i].data() + 2);
+        __m128 a = _mm_loadu_ps(ranges[i + 1].data() + 2);
+        __m128 maxY = _mm_loadu_ps(ranges[i + 2].data() + 2);
+        __m128 maxZ = _mm_loadu_ps(ranges[i + 3].data() + 2);
+        _MM_TRANSPOSE4_PS(unused, a, maxY, maxZ);
+
+        const __m128 centerX = _mm_mul_ps(_mm_add_ps(minX, maxX), half);
+        const __m128 centerY = _mm_mul_ps(_mm_add_ps(minY, maxY), half);
+        const __m128 centerZ = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half);
+        const __m128 extentX = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+        const __m128 extentY = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+        const __m128 extentZ = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+        __m128 outside = _mm_setzero_ps();
+        for(std::size_t p = 0; p != 6; ++p) {
+            const __m128 center = _mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(normalX[p], centerX),
+                _mm_mul_ps(normalY[p], centerY)),
+                _mm_mul_ps(normalZ[p], centerZ));
+            const __m128 extent = _mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(absX[p], extentX),
+                _mm_mul_ps(absY[p], extentY)),
+                _mm_mul_ps(absZ[p], extentZ));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(_mm_add_ps(center, extent), distance[p]), _mm_setzero_ps()));
+        }
+
+        consumer(i, ~UnsignedInt(_mm_movemask_ps(outside)) & 0xf);
+    }
+    #endif
+
+    for(; i != ranges.size(); ++i)
+        consumer(i, Intersection::rangeFrustum(ranges[i], frustum) ? 1 : 0);
+}
+
+/* Equivalent of the above for spheres */
+template<class Consumer> void spheresFrustum(const Corrade::Containers::ArrayView<const Vector3<Float>> centers, const Corrade::Containers::ArrayView<const Float> radii, const Frustum<Float>& frustumRef, Consumer&& consumer) {
+    const Frustum<Float> frustum = frustumRef;
+    std::size_t i = 0;
+
+    #ifdef MAGNUM_TARGET_SSE
+    __m128 normalX[6], normalY[6], normalZ[6], distance[6];
+    for(std::size_t p = 0; p != 6; ++p) {
+        const Vector4<Float> plane = frustum[p];
+        normalX[p] = _mm_set1_ps(plane.x());
+        normalY[p] = _mm_set1_ps(plane.y());
+        normalZ[p] = _mm_set1_ps(plane.z());
+        distance[p] = _mm_set1_ps(plane.w());
+    }
+
+    for(; i + 4 <= centers.size(); i += 4) {
+        const __m128 centerX = _mm_setr_ps(centers[i].x(), centers[i + 1].x(), centers[i + 2].x(), centers[i + 3].x());
+        const __m128 centerY = _mm_setr_ps(centers[i].y(), centers[i + 1].y(), centers[i + 2].y(), centers[i + 3].y());
+        const __m128 centerZ = _mm_setr_ps(centers[i].z(), centers[i + 1].z(), centers[i + 2].z(), centers[i + 3].z());
+        const __m128 negativeRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radii.data() + i));
+
+        __m128 outside = _mm_setzero_ps();
+        for(std::size_t p = 0; p != 6; ++p) {
+            const __m128 center = _mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(normalX[p], centerX),
+                _mm_mul_ps(normalY[p], centerY)),
+                _mm_mul_ps(normalZ[p], centerZ));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(center, distance[p]), negativeRadius));
+        }
+
+        consumer(i, ~UnsignedInt(_mm_movemask_ps(outside)) & 0xf);
+    }
+    #endif
+
+    for(; i != centers.size(); ++i)
+        consumer(i, Intersection::sphereFrustum(centers[i], radii[i], frustum) ? 1 : 0);
+}
+
+/* Saves the visibility bits into a mask */
+struct MaskConsumer {
+    void operator()(const std::size_t i, const UnsignedInt visible) {
+        mask[i/32] |= visible << (i%32);
+    }
+
+    Corrade::Containers::ArrayView<UnsignedInt> mask;
+};
+
+/* Saves indices of visible items */
+struct IndexConsumer {
+    void operator()(const std::size_t i, UnsignedInt visible) {
+        /* Written without branches, as the visibility is hard to predict */
+        for(std::size_t j = 0; visible; ++j, visible >>= 1) {
+            indices[count] = UnsignedInt(i + j);
+            count += visible & 1;
+        }
+    }
+
+    Corrade::Containers::ArrayView<UnsignedInt> indices;
+    std::size_t count;
+};
+
+}
+
+void Intersection::rangeFrustumMask(const Corrade::Containers::ArrayView<const Range3D<Float>> ranges, const Frustum<Float>& frustum, const Corrade::Containers::ArrayView<UnsignedInt> visibleMask) {
+    CORRADE_ASSERT(visibleMask.size() == (ranges.size() + 31)/32,
+        "Math::Geometry::Intersection::rangeFrustumMask(): output view has wrong size, expected" << (ranges.size() + 31)/32 << "but got" << visibleMask.size(), );
+
+    for(std::size_t i = 0; i != visibleMask.size(); ++i) visibleMask[i] = 0;
+    rangesFrustum(ranges, frustum, MaskConsumer{visibleMask});
+}
+
+std::size_t Intersection::rangeFrustumIndices(const Corrade::Containers::ArrayView<const Range3D<Float>> ranges, const Frustum<Float>& frustum, const Corrade::Containers::ArrayView<UnsignedInt> visibleIndices) {
+    CORRADE_ASSERT(visibleIndices.size() >= ranges.size(),
+        "Math::Geometry::Intersection::rangeFrustumIndices(): output view too small, expected at least" << ranges.size() << "but got" << visibleIndices.size(), 0);
+
+    IndexConsumer consumer{visibleIndices, 0};
+    rangesFrustum(ranges, frustum, consumer);
+    return consumer.count;
+}
+
+void Intersection::sphereFrustumMask(const Corrade::Containers::ArrayView<const Vector3<Float>> centers, const Corrade::Containers::ArrayView<const Float> radii, const Frustum<Float>& frustum, const Corrade::Containers::ArrayView<UnsignedInt> visibleMask) {
+    CORRADE_ASSERT(centers.size() == radii.size(),
+        "Math::Geometry::Intersection::sphereFrustumMask(): views don't have the same size, expected" << centers.size() << "but got" << radii.size(), );
+    CORRADE_ASSERT(visibleMask.size() == (centers.size() + 31)/32,
+        "Math::Geometry::Intersection::sphereFrustumMask(): output view has wrong size, expected" << (centers.size() + 31)/32 << "but got" << visibleMask.size(), );
+
+    for(std::size_t i = 0; i != visibleMask.size(); ++i) visibleMask[i] = 0;
+    spheresFrustum(centers, radii, frustum, MaskConsumer{visibleMask});
+}
+
+std::size_t Intersection::sphereFrustumIndices(const Corrade::Containers::ArrayView<const Vector3<Float>> centers, const Corrade::Containers::ArrayView<const Float> radii, const Frustum<Float>& frustum, const Corrade::Containers::ArrayView<UnsignedInt> visibleIndices) {
+    CORRADE_ASSERT(centers.size() == radii.size(),
+        "Math::Geometry::Intersection::sphereFrustumIndices(): views don't have the same size, expected" << centers.size() << "but got" << radii.size(), 0);
+    CORRADE_ASSERT(visibleIndices.size() >= centers.size(),
+        "Math::Geometry::Intersection::sphereFrustumIndices(): output view too small, expected at least" << centers.size() << "but got" << visibleIndices.size(), 0);
+
+    IndexConsumer consumer{visibleIndices, 0};
+    spheresFrustum(centers, radii, frustum, consumer);
+    return consumer.count;
+}
+
+}}}
@@ -29,6 +29,11 @@
  * @brief Class @ref Magnum::Math::Geometry::Intersection
  */
 
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/visibility.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Math/Vector3.h"
 
 namespace Magnum { namespace Math { namespace Geometry {
@@ -123,6 +128,147 @@ class Intersection {
             const T f = dot(planePosition, planeNormal);
             return (f-dot(planeNormal, p))/dot(planeNormal, r);
         }
+
+        /**
+         * @brief Intersection of a point and a frustum
+         * @param point     Point
+         * @param frustum   Frustum
+         * @return `true` if the point is on or inside the frustum, `false`
+         *      otherwise
+         *
+         * Checks for each plane of the frustum whether the point is behind
+         * the plane (the points distance from the plane is negative) using
+         * @f$ \boldsymbol n \cdot \boldsymbol p + d < 0 @f$.
+         */
+        template<class T> static bool pointFrustum(const Vector3<T>& point, const Frustum<T>& frustum) {
+            for(std::size_t i = 0; i != 6; ++i) {
+                const Vector4<T> plane = frustum[i];
+                if(dot(plane.xyz(), point) + plane.w() < T(0))
+                    return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Intersection of an axis-aligned box and a frustum
+         * @param range     Axis-aligned box
+         * @param frustum   Frustum
+         * @return `true` if the box intersects with the frustum, `false`
+         *      otherwise
+         *
+         * Checks for each plane of the frustum whether the box is completely
+         * behind the plane, i.e. whether the box center @f$ \boldsymbol c @f$
+         * is farther behind the plane than the box half-size
+         * @f$ \boldsymbol e @f$ projected onto the plane normal: @f[
+         *      \boldsymbol n \cdot \boldsymbol c + |\boldsymbol n| \cdot \boldsymbol e + d < 0
+         * @f]
+         * The test is conservative --- boxes near the frustum corners that
+         * are outside the frustum but not completely behind any of the planes
+         * are reported as intersecting.
+         * @see @ref rangeFrustumMask(), @ref rangeFrustumIndices()
+         */
+        template<class T> static bool rangeFrustum(const Range3D<T>& range, const Frustum<T>& frustum) {
+            const Vector3<T> center = range.center();
+            const Vector3<T> extent = range.size()/T(2);
+            for(std::size_t i = 0; i != 6; ++i) {
+                const Vector4<T> plane = frustum[i];
+                if(dot(plane.xyz(), center) + dot(Math::abs(plane.xyz()), extent) + plane.w() < T(0))
+                    return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Intersection of a sphere and a frustum
+         * @param center    Sphere center
+         * @param radius    Sphere radius
+         * @param frustum   Frustum
+         * @return `true` if the sphere intersects with the frustum, `false`
+         *      otherwise
+         *
+         * Checks for each plane of the frustum whether the sphere is
+         * completely behind the plane using
+         * @f$ \boldsymbol n \cdot \boldsymbol c + d < -r @f$. Expects that
+         * the frustum planes are normalized, such as when created using
+         * @ref Frustum::fromMatrix(). Similarly to @ref rangeFrustum(), the
+         * test is conservative.
+         * @see @ref sphereFrustumMask(), @ref sphereFrustumIndices()
+         */
+        template<class T> static bool sphereFrustum(const Vector3<T>& center, T radius, const Frustum<T>& frustum) {
+            for(std::size_t i = 0; i != 6; ++i) {
+                const Vector4<T> plane = frustum[i];
+                if(dot(plane.xyz(), center) + plane.w() < -radius)
+                    return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Intersection of axis-aligned boxes and a frustum as a bit mask
+         * @param ranges        Axis-aligned boxes
+         * @param frustum       Frustum
+         * @param visibleMask   Where to put the result
+         *
+         * Equivalent to calling @ref rangeFrustum() on each item of
+         * @p ranges, setting bit @f$ i \bmod 32 @f$ of
+         * @p visibleMask item @f$ \lfloor i / 32 \rfloor @f$ if box
+         * @f$ i @f$ intersects the frustum. Unused bits of the last item are
+         * set to zero. Expects that @p visibleMask has exactly
+         * @f$ \lceil n / 32 \rceil @f$ items. If @ref MAGNUM_TARGET_SSE is
+         * defined, four boxes at a time are tested against all six planes
+         * using SSE intrinsics.
+         * @see @ref rangeFrustumIndices()
+         */
+        static MAGNUM_EXPORT void rangeFrustumMask(Corrade::Containers::ArrayView<const Range3D<Float>> ranges, const Frustum<Float>& frustum, Corrade::Containers::ArrayView<UnsignedInt> visibleMask);
+
+        /**
+         * @brief Intersection of axis-aligned boxes and a frustum as an index list
+         * @param ranges        Axis-aligned boxes
+         * @param frustum       Frustum
+         * @param visibleIndices Where to put the result
+         * @return Count of boxes intersecting the frustum
+         *
+         * Equivalent to calling @ref rangeFrustum() on each item of
+         * @p ranges and saving indices of boxes intersecting the frustum in
+         * increasing order to the beginning of @p visibleIndices. Expects
+         * that @p visibleIndices is at least as large as @p ranges. See
+         * @ref rangeFrustumMask() for information about hardware
+         * acceleration.
+         */
+        static MAGNUM_EXPORT std::size_t rangeFrustumIndices(Corrade::Containers::ArrayView<const Range3D<Float>> ranges, const Frustum<Float>& frustum, Corrade::Containers::ArrayView<UnsignedInt> visibleIndices);
+
+        /**
+         * @brief Intersection of spheres and a frustum as a bit mask
+         * @param centers       Sphere centers
+         * @param radii         Sphere radii
+         * @param frustum       Frustum
+         * @param visibleMask   Where to put the result
+         *
+         * Equivalent to calling @ref sphereFrustum() on each pair of items
+         * of @p centers and @p radii, with the result saved as described in
+         * @ref rangeFrustumMask(). Expects that @p centers and @p radii have
+         * the same size.
+         * @see @ref sphereFrustumIndices()
+         */
+        static MAGNUM_EXPORT void sphereFrustumMask(Corrade::Containers::ArrayView<const Vector3<Float>> centers, Corrade::Containers::ArrayView<const Float> radii, const Frustum<Float>& frustum, Corrade::Containers::ArrayView<UnsignedInt> visibleMask);
+
+        /**
+         * @brief Intersection of spheres and a frustum as an index list
+         * @param centers       Sphere centers
+         * @param radii         Sphere radii
+         * @param frustum       Frustum
+         * @param visibleIndices Where to put the result
+         * @return Count of spheres intersecting the frustum
+         *
+         * Equivalent to calling @ref sphereFrustum() on each pair of items
+         * of @p centers and @p radii, with the result saved as described in
+         * @ref rangeFrustumIndices(). Expects that @p centers and @p radii
+         * have the same size.
+         */
+        static MAGNUM_EXPORT std::size_t sphereFrustumIndices(Corrade::Containers::ArrayView<const Vector3<Float>> centers, Corrade::Containers::ArrayView<const Float> radii, const Frustum<Float>& frustum, Corrade::Containers::ArrayView<UnsignedInt> visibleIndices);
 };
 
 }}}
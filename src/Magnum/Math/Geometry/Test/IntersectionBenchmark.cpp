@@ -0,0 +1,145 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Geometry/Intersection.h"
+
+namespace Magnum { namespace Math { namespace Geometry { namespace Test {
+
+struct IntersectionBenchmark: Corrade::TestSuite::Tester {
+    explicit IntersectionBenchmark();
+
+    void rangeFrustumLoop();
+    void rangeFrustum();
+    void sphereFrustumLoop();
+    void sphereFrustum();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Range3D<Float> Range3D;
+typedef Math::Frustum<Float> Frustum;
+
+/* Each benchmark run tests Count*Repeats, i.e. one million objects, so the
+   result in milliseconds is time spent per million objects */
+namespace {
+    enum: std::size_t {
+        Count = 10000,
+        Repeats = 100
+    };
+
+    const Frustum Camera = Frustum::fromMatrix(
+        Matrix4::perspectiveProjection(Deg(60.0f), 1.0f, 0.1f, 100.0f)*
+        Matrix4::rotationY(Deg(30.0f)));
+
+    Vector3 position(std::size_t i) {
+        return {Float(i%100) - 50.0f, Float(i/100%10) - 5.0f, -Float(i/1000)*10.0f};
+    }
+}
+
+IntersectionBenchmark::IntersectionBenchmark() {
+    addBenchmarks({&IntersectionBenchmark::rangeFrustumLoop,
+                   &IntersectionBenchmark::rangeFrustum,
+                   &IntersectionBenchmark::sphereFrustumLoop,
+                   &IntersectionBenchmark::sphereFrustum}, 10);
+}
+
+/* The *Loop variants are the same operations done using the per-item API for
+   comparison */
+
+void IntersectionBenchmark::rangeFrustumLoop() {
+    Corrade::Containers::Array<Range3D> ranges{Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        ranges[i] = Range3D::fromSize(position(i), Vector3{0.5f});
+
+    Corrade::Containers::Array<UnsignedInt> indices(Count);
+    std::size_t count{};
+    CORRADE_BENCHMARK(Repeats) {
+        count = 0;
+        for(std::size_t i = 0; i != Count; ++i)
+            if(Intersection::rangeFrustum(ranges[i], Camera))
+                indices[count++] = UnsignedInt(i);
+    }
+
+    CORRADE_VERIFY(count);
+}
+
+void IntersectionBenchmark::rangeFrustum() {
+    Corrade::Containers::Array<Range3D> ranges{Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        ranges[i] = Range3D::fromSize(position(i), Vector3{0.5f});
+
+    Corrade::Containers::Array<UnsignedInt> indices(Count);
+    std::size_t count{};
+    CORRADE_BENCHMARK(Repeats) {
+        count = Intersection::rangeFrustumIndices(ranges, Camera, indices);
+    }
+
+    CORRADE_VERIFY(count);
+}
+
+void IntersectionBenchmark::sphereFrustumLoop() {
+    Corrade::Containers::Array<Vector3> centers{Count};
+    Corrade::Containers::Array<Float> radii(Count);
+    for(std::size_t i = 0; i != Count; ++i) {
+        centers[i] = position(i);
+        radii[i] = 0.5f;
+    }
+
+    Corrade::Containers::Array<UnsignedInt> indices(Count);
+    std::size_t count{};
+    CORRADE_BENCHMARK(Repeats) {
+        count = 0;
+        for(std::size_t i = 0; i != Count; ++i)
+            if(Intersection::sphereFrustum(centers[i], radii[i], Camera))
+                indices[count++] = UnsignedInt(i);
+    }
+
+    CORRADE_VERIFY(count);
+}
+
+void IntersectionBenchmark::sphereFrustum() {
+    Corrade::Containers::Array<Vector3> centers{Count};
+    Corrade::Containers::Array<Float> radii(Count);
+    for(std::size_t i = 0; i != Count; ++i) {
+        centers[i] = position(i);
+        radii[i] = 0.5f;
+    }
+
+    Corrade::Containers::Array<UnsignedInt> indices(Count);
+    std::size_t count{};
+    CORRADE_BENCHMARK(Repeats) {
+        count = Intersection::sphereFrustumIndices(centers, radii, Camera, indices);
+    }
+
+    CORRADE_VERIFY(count);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::IntersectionBenchmark)
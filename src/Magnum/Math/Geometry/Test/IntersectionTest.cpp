@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Geometry/Intersection.h"
@@ -34,15 +35,34 @@ struct IntersectionTest: Corrade::TestSuite::Tester {
 
     void planeLine();
     void lineLine();
+
+    void pointFrustum();
+    void rangeFrustum();
+    void sphereFrustum();
+    void rangeFrustumBatch();
+    void sphereFrustumBatch();
+    void batchWrongSize();
 };
 
 typedef Math::Vector2<Float> Vector2;
 typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Range3D<Float> Range3D;
+typedef Math::Frustum<Float> Frustum;
 typedef Math::Constants<Float> Constants;
 
+using Corrade::Containers::arrayView;
+
 IntersectionTest::IntersectionTest() {
     addTests({&IntersectionTest::planeLine,
-              &IntersectionTest::lineLine});
+              &IntersectionTest::lineLine,
+
+              &IntersectionTest::pointFrustum,
+              &IntersectionTest::rangeFrustum,
+              &IntersectionTest::sphereFrustum,
+              &IntersectionTest::rangeFrustumBatch,
+              &IntersectionTest::sphereFrustumBatch,
+              &IntersectionTest::batchWrongSize});
 }
 
 void IntersectionTest::planeLine() {
@@ -97,6 +117,112 @@ void IntersectionTest::lineLine() {
         {0.0f, 0.0f}, {1.0f, 2.0f}), Constants::inf());
 }
 
+namespace {
+    /* Frustum of the [0, 10] cube */
+    const Frustum CubeFrustum{
+        {1.0f, 0.0f, 0.0f, 0.0f},
+        {-1.0f, 0.0f, 0.0f, 10.0f},
+        {0.0f, 1.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f, 10.0f},
+        {0.0f, 0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, -1.0f, 10.0f}};
+}
+
+void IntersectionTest::pointFrustum() {
+    /* Inside, on the border, outside */
+    CORRADE_VERIFY(Intersection::pointFrustum({5.0f, 5.0f, 1.0f}, CubeFrustum));
+    CORRADE_VERIFY(Intersection::pointFrustum({0.0f, 0.0f, 0.0f}, CubeFrustum));
+    CORRADE_VERIFY(!Intersection::pointFrustum({0.0f, 0.0f, -1.0f}, CubeFrustum));
+    CORRADE_VERIFY(!Intersection::pointFrustum({5.0f, 11.0f, 5.0f}, CubeFrustum));
+}
+
+void IntersectionTest::rangeFrustum() {
+    /* Inside, partially inside, containing the whole frustum, outside */
+    CORRADE_VERIFY(Intersection::rangeFrustum(Range3D{{1.0f, 1.0f, 1.0f}, {2.0f, 2.0f, 2.0f}}, CubeFrustum));
+    CORRADE_VERIFY(Intersection::rangeFrustum(Range3D{{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}}, CubeFrustum));
+    CORRADE_VERIFY(Intersection::rangeFrustum(Range3D{{-5.0f, -5.0f, -5.0f}, {15.0f, 15.0f, 15.0f}}, CubeFrustum));
+    CORRADE_VERIFY(!Intersection::rangeFrustum(Range3D{{-5.0f, 1.0f, 1.0f}, {-1.0f, 2.0f, 2.0f}}, CubeFrustum));
+    CORRADE_VERIFY(!Intersection::rangeFrustum(Range3D{{1.0f, 1.0f, 11.0f}, {2.0f, 2.0f, 12.0f}}, CubeFrustum));
+}
+
+void IntersectionTest::sphereFrustum() {
+    /* Inside, partially inside, outside */
+    CORRADE_VERIFY(Intersection::sphereFrustum({5.0f, 5.0f, 5.0f}, 1.0f, CubeFrustum));
+    CORRADE_VERIFY(Intersection::sphereFrustum({5.0f, 5.0f, -0.5f}, 1.0f, CubeFrustum));
+    CORRADE_VERIFY(!Intersection::sphereFrustum({5.0f, 5.0f, -1.5f}, 1.0f, CubeFrustum));
+    CORRADE_VERIFY(!Intersection::sphereFrustum({12.0f, 5.0f, 5.0f}, 1.0f, CubeFrustum));
+}
+
+void IntersectionTest::rangeFrustumBatch() {
+    /* 37 boxes to test the four-item blocks, the remainder and more than one
+       item of the mask */
+    Range3D ranges[37];
+    for(std::size_t i = 0; i != 37; ++i) {
+        const Vector3 min{Float(i%5)*4.0f - 6.0f, Float(i%7)*3.0f - 5.0f, Float(i%3)*6.0f - 3.0f};
+        ranges[i] = Range3D{min, min + Vector3{1.0f + Float(i%2)}};
+    }
+
+    UnsignedInt mask[2];
+    Intersection::rangeFrustumMask(arrayView(ranges), CubeFrustum, arrayView(mask));
+
+    UnsignedInt indices[37];
+    const std::size_t count = Intersection::rangeFrustumIndices(arrayView(ranges), CubeFrustum, arrayView(indices));
+
+    std::size_t expectedCount = 0;
+    for(std::size_t i = 0; i != 37; ++i) {
+        const bool visible = Intersection::rangeFrustum(ranges[i], CubeFrustum);
+        CORRADE_COMPARE(bool(mask[i/32] & (1 << (i%32))), visible);
+        if(visible) CORRADE_COMPARE(indices[expectedCount++], i);
+    }
+    CORRADE_COMPARE(count, expectedCount);
+
+    /* Unused bits are zero */
+    CORRADE_COMPARE(mask[1] >> 5, 0);
+}
+
+void IntersectionTest::sphereFrustumBatch() {
+    Vector3 centers[37];
+    Float radii[37];
+    for(std::size_t i = 0; i != 37; ++i) {
+        centers[i] = {Float(i%5)*4.0f - 5.0f, Float(i%7)*3.0f - 4.0f, Float(i%3)*6.0f - 2.0f};
+        radii[i] = 0.5f + Float(i%4);
+    }
+
+    UnsignedInt mask[2];
+    Intersection::sphereFrustumMask(arrayView(centers), arrayView(radii), CubeFrustum, arrayView(mask));
+
+    UnsignedInt indices[37];
+    const std::size_t count = Intersection::sphereFrustumIndices(arrayView(centers), arrayView(radii), CubeFrustum, arrayView(indices));
+
+    std::size_t expectedCount = 0;
+    for(std::size_t i = 0; i != 37; ++i) {
+        const bool visible = Intersection::sphereFrustum(centers[i], radii[i], CubeFrustum);
+        CORRADE_COMPARE(bool(mask[i/32] & (1 << (i%32))), visible);
+        if(visible) CORRADE_COMPARE(indices[expectedCount++], i);
+    }
+    CORRADE_COMPARE(count, expectedCount);
+    CORRADE_COMPARE(mask[1] >> 5, 0);
+}
+
+void IntersectionTest::batchWrongSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const Range3D ranges[33];
+    const Vector3 centers[3];
+    const Float radii[2]{};
+    UnsignedInt mask[1];
+    UnsignedInt indices[2];
+    Intersection::rangeFrustumMask(arrayView(ranges), CubeFrustum, arrayView(mask));
+    Intersection::rangeFrustumIndices(arrayView(ranges), CubeFrustum, arrayView(indices));
+    Intersection::sphereFrustumMask(arrayView(centers), arrayView(radii), CubeFrustum, arrayView(mask));
+
+    CORRADE_COMPARE(out.str(),
+        "Math::Geometry::Intersection::rangeFrustumMask(): output view has wrong size, expected 2 but got 1\n"
+        "Math::Geometry::Intersection::rangeFrustumIndices(): output view too small, expected at least 33 but got 2\n"
+        "Math::Geometry::Intersection::sphereFrustumMask(): views don't have the same size, expected 3 but got 2\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::IntersectionTest)
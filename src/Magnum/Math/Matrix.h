@@ -35,6 +35,7 @@ namespace Magnum { namespace Math {
 
 namespace Implementation {
     template<std::size_t, class> struct MatrixDeterminant;
+    template<std::size_t, class> struct MatrixInverse;
 }
 
 /**
@@ -170,6 +171,9 @@ template<std::size_t size, class T> class Matrix: public RectangularMatrix<size,
          * determinant is computed directly: @f[
          *      \det(A) = a_{0, 0} a_{1, 1} - a_{1, 0} a_{0, 1}
          * @f]
+         * For 3x3 and 4x4 matrices the expansion is written out in closed
+         * form, the 4x4 variant reuses the 2x2 subdeterminants of the first
+         * two and last two columns instead of recursing into 3x3 minors.
          */
         T determinant() const { return Implementation::MatrixDeterminant<size, T>()(*this); }
 
@@ -179,11 +183,15 @@ template<std::size_t size, class T> class Matrix: public RectangularMatrix<size,
          * Computed using Cramer's rule: @f[
          *      A^{-1} = \frac{1}{\det(A)} Adj(A)
          * @f]
-         * See @ref invertedOrthogonal(), @ref Matrix3::invertedRigid() and
-         * @ref Matrix4::invertedRigid() which are faster alternatives for
-         * particular matrix types.
+         * For 3x3 and 4x4 matrices the adjugate is computed in closed form
+         * from the 2x2 subdeterminants, which are shared between the
+         * determinant and all cofactors. If @ref MAGNUM_TARGET_SSE is
+         * defined, the 4x4 @ref Magnum::Float "Float" variant is computed
+         * with SSE intrinsics. See @ref invertedOrthogonal(),
+         * @ref Matrix3::invertedRigid() and @ref Matrix4::invertedRigid()
+         * which are faster alternatives for particular matrix types.
          */
-        Matrix<size, T> inverted() const;
+        Matrix<size, T> inverted() const { return Implementation::MatrixInverse<size, T>()(*this); }
 
         /**
          * @brief Inverted orthogonal matrix
@@ -303,6 +311,34 @@ template<std::size_t size, class T> T MatrixDeterminant<size, T>::operator()(con
     return out;
 }
 
+template<class T> struct MatrixDeterminant<4, T> {
+    T operator()(const Matrix<4, T>& m) const {
+        /* 2x2 subdeterminants of the first two and the last two columns */
+        const T s0 = m[0][0]*m[1][1] - m[1][0]*m[0][1];
+        const T s1 = m[0][0]*m[1][2] - m[1][0]*m[0][2];
+        const T s2 = m[0][0]*m[1][3] - m[1][0]*m[0][3];
+        const T s3 = m[0][1]*m[1][2] - m[1][1]*m[0][2];
+        const T s4 = m[0][1]*m[1][3] - m[1][1]*m[0][3];
+        const T s5 = m[0][2]*m[1][3] - m[1][2]*m[0][3];
+        const T c0 = m[2][0]*m[3][1] - m[3][0]*m[2][1];
+        const T c1 = m[2][0]*m[3][2] - m[3][0]*m[2][2];
+        const T c2 = m[2][0]*m[3][3] - m[3][0]*m[2][3];
+        const T c3 = m[2][1]*m[3][2] - m[3][1]*m[2][2];
+        const T c4 = m[2][1]*m[3][3] - m[3][1]*m[2][3];
+        const T c5 = m[2][2]*m[3][3] - m[3][2]*m[2][3];
+
+        return s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+    }
+};
+
+template<class T> struct MatrixDeterminant<3, T> {
+    constexpr T operator()(const Matrix<3, T>& m) const {
+        return m[0][0]*(m[1][1]*m[2][2] - m[2][1]*m[1][2]) -
+               m[1][0]*(m[0][1]*m[2][2] - m[2][1]*m[0][2]) +
+               m[2][0]*(m[0][1]*m[1][2] - m[1][1]*m[0][2]);
+    }
+};
+
 template<class T> struct MatrixDeterminant<2, T> {
     constexpr T operator()(const Matrix<2, T>& m) const {
         return m[0][0]*m[1][1] - m[1][0]*m[0][1];
@@ -315,6 +351,172 @@ template<class T> struct MatrixDeterminant<1, T> {
     }
 };
 
+template<std::size_t size, class T> struct MatrixInverse {
+    Matrix<size, T> operator()(const Matrix<size, T>& m) const;
+};
+
+template<std::size_t size, class T> Matrix<size, T> MatrixInverse<size, T>::operator()(const Matrix<size, T>& m) const {
+    Matrix<size, T> out{ZeroInit};
+
+    const T _determinant = m.determinant();
+
+    for(std::size_t col = 0; col != size; ++col)
+        for(std::size_t row = 0; row != size; ++row)
+            out[col][row] = (((row+col) & 1) ? -1 : 1)*m.ij(row, col).determinant()/_determinant;
+
+    return out;
+}
+
+/* Adjugate of a 4x4 matrix using 2x2 subdeterminants of the first two and
+   the last two columns. Each subdeterminant is shared by six cofactors and
+   by the determinant itself, so there's no need to build any minors. */
+template<class T> struct MatrixInverse<4, T> {
+    Matrix<4, T> operator()(const Matrix<4, T>& m) const {
+        const T s0 = m[0][0]*m[1][1] - m[1][0]*m[0][1];
+        const T s1 = m[0][0]*m[1][2] - m[1][0]*m[0][2];
+        const T s2 = m[0][0]*m[1][3] - m[1][0]*m[0][3];
+        const T s3 = m[0][1]*m[1][2] - m[1][1]*m[0][2];
+        const T s4 = m[0][1]*m[1][3] - m[1][1]*m[0][3];
+        const T s5 = m[0][2]*m[1][3] - m[1][2]*m[0][3];
+        const T c0 = m[2][0]*m[3][1] - m[3][0]*m[2][1];
+        const T c1 = m[2][0]*m[3][2] - m[3][0]*m[2][2];
+        const T c2 = m[2][0]*m[3][3] - m[3][0]*m[2][3];
+        const T c3 = m[2][1]*m[3][2] - m[3][1]*m[2][2];
+        const T c4 = m[2][1]*m[3][3] - m[3][1]*m[2][3];
+        const T c5 = m[2][2]*m[3][3] - m[3][2]*m[2][3];
+
+        const T determinant = s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+
+        return Matrix<4, T>{
+            Vector<4, T>{ m[1][1]*c5 - m[1][2]*c4 + m[1][3]*c3,
+                         -m[0][1]*c5 + m[0][2]*c4 - m[0][3]*c3,
+                          m[3][1]*s5 - m[3][2]*s4 + m[3][3]*s3,
+                         -m[2][1]*s5 + m[2][2]*s4 - m[2][3]*s3},
+            Vector<4, T>{-m[1][0]*c5 + m[1][2]*c2 - m[1][3]*c1,
+                          m[0][0]*c5 - m[0][2]*c2 + m[0][3]*c1,
+                         -m[3][0]*s5 + m[3][2]*s2 - m[3][3]*s1,
+                          m[2][0]*s5 - m[2][2]*s2 + m[2][3]*s1},
+            Vector<4, T>{ m[1][0]*c4 - m[1][1]*c2 + m[1][3]*c0,
+                         -m[0][0]*c4 + m[0][1]*c2 - m[0][3]*c0,
+                          m[3][0]*s4 - m[3][1]*s2 + m[3][3]*s0,
+                         -m[2][0]*s4 + m[2][1]*s2 - m[2][3]*s0},
+            Vector<4, T>{-m[1][0]*c3 + m[1][1]*c1 - m[1][2]*c0,
+                          m[0][0]*c3 - m[0][1]*c1 + m[0][2]*c0,
+                         -m[3][0]*s3 + m[3][1]*s1 - m[3][2]*s0,
+                          m[2][0]*s3 - m[2][1]*s1 + m[2][2]*s0}}/determinant;
+    }
+};
+
+/* Adjugate of a 3x3 matrix, rows of it are cross products of the columns */
+template<class T> struct MatrixInverse<3, T> {
+    Matrix<3, T> operator()(const Matrix<3, T>& m) const {
+        const Vector<3, T> c0{m[1][1]*m[2][2] - m[2][1]*m[1][2],
+                              m[2][1]*m[0][2] - m[0][1]*m[2][2],
+                              m[0][1]*m[1][2] - m[1][1]*m[0][2]};
+
+        const T determinant = m[0][0]*c0[0] + m[1][0]*c0[1] + m[2][0]*c0[2];
+
+        return Matrix<3, T>{
+            c0,
+            Vector<3, T>{m[2][0]*m[1][2] - m[1][0]*m[2][2],
+                         m[0][0]*m[2][2] - m[2][0]*m[0][2],
+                         m[1][0]*m[0][2] - m[0][0]*m[1][2]},
+            Vector<3, T>{m[1][0]*m[2][1] - m[2][0]*m[1][1],
+                         m[2][0]*m[0][1] - m[0][0]*m[2][1],
+                         m[0][0]*m[1][1] - m[1][0]*m[0][1]}}/determinant;
+    }
+};
+
+#ifdef MAGNUM_TARGET_SSE
+/* SSE version of the above for Float, using the block-wise formulation with
+   2x2 submatrices stored in a single register each. The matrix is processed
+   as if it was row-major, which gives a transposed inverse of a transposed
+   matrix, i.e. exactly the column-major inverse. */
+template<> struct MatrixInverse<4, Float> {
+    Matrix<4, Float> operator()(const Matrix<4, Float>& m) const {
+        const __m128 col0 = _mm_loadu_ps(m[0].data());
+        const __m128 col1 = _mm_loadu_ps(m[1].data());
+        const __m128 col2 = _mm_loadu_ps(m[2].data());
+        const __m128 col3 = _mm_loadu_ps(m[3].data());
+
+        /* 2x2 submatrices, stored as (a00, a01, a10, a11) */
+        const __m128 a = _mm_movelh_ps(col0, col1);
+        const __m128 b = _mm_movehl_ps(col1, col0);
+        const __m128 c = _mm_movelh_ps(col2, col3);
+        const __m128 d = _mm_movehl_ps(col3, col2);
+
+        /* Determinants of all submatrices as (|A|, |B|, |C|, |D|) */
+        const __m128 subdeterminants = _mm_sub_ps(
+            _mm_mul_ps(_mm_shuffle_ps(col0, col2, _MM_SHUFFLE(2, 0, 2, 0)),
+                       _mm_shuffle_ps(col1, col3, _MM_SHUFFLE(3, 1, 3, 1))),
+            _mm_mul_ps(_mm_shuffle_ps(col0, col2, _MM_SHUFFLE(3, 1, 3, 1)),
+                       _mm_shuffle_ps(col1, col3, _MM_SHUFFLE(2, 0, 2, 0))));
+        const __m128 detA = _mm_shuffle_ps(subdeterminants, subdeterminants, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 detB = _mm_shuffle_ps(subdeterminants, subdeterminants, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 detC = _mm_shuffle_ps(subdeterminants, subdeterminants, _MM_SHUFFLE(2, 2, 2, 2));
+        const __m128 detD = _mm_shuffle_ps(subdeterminants, subdeterminants, _MM_SHUFFLE(3, 3, 3, 3));
+
+        /* adj(D)*C, adj(A)*B */
+        const __m128 dc = adjugateMultiply(d, c);
+        const __m128 ab = adjugateMultiply(a, b);
+
+        /* Adjugates of the resulting blocks, not yet divided by the
+           determinant */
+        const __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), multiply(b, dc));
+        const __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), multiply(c, ab));
+        const __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), multiplyAdjugate(d, ab));
+        const __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), multiplyAdjugate(a, dc));
+
+        /* |M| = |A||D| + |B||C| - tr(adj(A)*B*adj(D)*C) */
+        __m128 trace = _mm_mul_ps(ab, _mm_shuffle_ps(dc, dc, _MM_SHUFFLE(3, 1, 2, 0)));
+        trace = _mm_add_ps(trace, _mm_movehl_ps(trace, trace));
+        trace = _mm_add_ss(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 1, 1, 1)));
+        trace = _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+        /* Sign of the adjugate and the division by determinant */
+        const __m128 factor = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+        const __m128 xf = _mm_mul_ps(x, factor);
+        const __m128 yf = _mm_mul_ps(y, factor);
+        const __m128 zf = _mm_mul_ps(z, factor);
+        const __m128 wf = _mm_mul_ps(w, factor);
+
+        /* Apply the adjugate shuffle and store */
+        Matrix<4, Float> out{NoInit};
+        _mm_storeu_ps(out[0].data(), _mm_shuffle_ps(xf, yf, _MM_SHUFFLE(1, 3, 1, 3)));
+        _mm_storeu_ps(out[1].data(), _mm_shuffle_ps(xf, yf, _MM_SHUFFLE(0, 2, 0, 2)));
+        _mm_storeu_ps(out[2].data(), _mm_shuffle_ps(zf, wf, _MM_SHUFFLE(1, 3, 1, 3)));
+        _mm_storeu_ps(out[3].data(), _mm_shuffle_ps(zf, wf, _MM_SHUFFLE(0, 2, 0, 2)));
+        return out;
+    }
+
+    private:
+        /* A*B for 2x2 matrices */
+        static __m128 multiply(__m128 a, __m128 b) {
+            return _mm_add_ps(
+                _mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+                _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+                           _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        /* adj(A)*B for 2x2 matrices */
+        static __m128 adjugateMultiply(__m128 a, __m128 b) {
+            return _mm_sub_ps(
+                _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+                _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)),
+                           _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+
+        /* A*adj(B) for 2x2 matrices */
+        static __m128 multiplyAdjugate(__m128 a, __m128 b) {
+            return _mm_sub_ps(
+                _mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+                _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+                           _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+};
+#endif
+
 }
 #endif
 
@@ -343,18 +545,6 @@ template<std::size_t size, class T> Matrix<size-1, T> Matrix<size, T>::ij(const
     return out;
 }
 
-template<std::size_t size, class T> Matrix<size, T> Matrix<size, T>::inverted() const {
-    Matrix<size, T> out{ZeroInit};
-
-    const T _determinant = determinant();
-
-    for(std::size_t col = 0; col != size; ++col)
-        for(std::size_t row = 0; row != size; ++row)
-            out[col][row] = (((row+col) & 1) ? -1 : 1)*ij(row, col).determinant()/_determinant;
-
-    return out;
-}
-
 }}
 
 namespace Corrade { namespace Utility {
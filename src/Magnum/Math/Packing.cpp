@@ -0,0 +1,593 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Packing.h"
+
+#include <cstring>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
+
+#ifdef MAGNUM_TARGET_SSE
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MAGNUM_MATH_PACKING_SSE2
+#endif
+#if defined(__SSE4_1__) || (defined(_MSC_VER) && defined(__AVX__))
+#include <smmintrin.h>
+#define MAGNUM_MATH_PACKING_SSE41
+#endif
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#include <immintrin.h>
+#define MAGNUM_MATH_PACKING_F16C
+#endif
+#endif
+
+namespace Magnum { namespace Math {
+
+namespace {
+
+union FloatBits {
+    Float f;
+    UnsignedInt u;
+};
+
+/* Conversion of (positive) 32-bit float to float with 5-bit exponent and
+   given mantissa size (10 bits for half-floats, 6 and 5 bits for R11G11B10F)
+   with rounding to nearest, ties to even. Based on "float_to_half_fast3_rtne"
+   from https://gist.github.com/rygorous/2156668. */
+template<UnsignedInt mantissaBits> inline UnsignedInt packSmallFloat(const UnsignedInt bits) {
+    constexpr UnsignedInt shift = 23 - mantissaBits;
+    constexpr UnsignedInt infinity = 0x1f << mantissaBits;
+    FloatBits value;
+    value.u = bits;
+
+    /* Too large values are converted to infinity, NaN to quiet NaN */
+    if(value.u >= (127 + 16) << 23)
+        return value.u > 0x7f800000 ? infinity|(1 << (mantissaBits - 1)) : infinity;
+
+    /* Denormals and zero. Adding a magic value aligns the mantissa bits at the
+       bottom of the float, relying on the FPU to do the rounding. */
+    if(value.u < 113 << 23) {
+        FloatBits magic;
+        magic.u = ((127 - 15) + shift + 1) << 23;
+        value.f += magic.f;
+        return value.u - magic.u;
+    }
+
+    /* Normalized numbers, adjust the exponent and round to nearest even */
+    const UnsignedInt mantissaOdd = (value.u >> shift) & 1;
+    value.u += (UnsignedInt(15 - 127) << 23) + (1 << (shift - 1)) - 1;
+    value.u += mantissaOdd;
+    return value.u >> shift;
+}
+
+/* Inverse of the above. Based on "half_to_float" from the same source. */
+template<UnsignedInt mantissaBits> inline UnsignedInt unpackSmallFloat(const UnsignedInt bits) {
+    constexpr UnsignedInt shift = 23 - mantissaBits;
+    constexpr UnsignedInt shiftedExponent = 0x1f << 23;
+    FloatBits value;
+    value.u = bits << shift;
+    const UnsignedInt exponent = value.u & shiftedExponent;
+    value.u += (127 - 15) << 23;
+
+    /* Infinity and NaN */
+    if(exponent == shiftedExponent)
+        value.u += (128 - 16) << 23;
+
+    /* Zero and denormals, renormalize */
+    else if(exponent == 0) {
+        FloatBits magic;
+        magic.u = 113 << 23;
+        value.u += 1 << 23;
+        value.f -= magic.f;
+    }
+
+    return value.u;
+}
+
+inline UnsignedInt packUnsignedSmallFloat11(const Float value) {
+    FloatBits bits;
+    bits.f = value;
+    /* Negative values are clamped to zero, negative NaN stays NaN */
+    if(bits.u & 0x80000000u)
+        return (bits.u & 0x7fffffffu) > 0x7f800000u ? 0x7c0|0x20 : 0;
+    return packSmallFloat<6>(bits.u);
+}
+
+inline UnsignedInt packUnsignedSmallFloat10(const Float value) {
+    FloatBits bits;
+    bits.f = value;
+    if(bits.u & 0x80000000u)
+        return (bits.u & 0x7fffffffu) > 0x7f800000u ? 0x3e0|0x10 : 0;
+    return packSmallFloat<5>(bits.u);
+}
+
+inline Float unpackUnsignedSmallFloat(const UnsignedInt bits, const UnsignedInt mantissaBits) {
+    FloatBits value;
+    value.u = mantissaBits == 6 ? unpackSmallFloat<6>(bits) : unpackSmallFloat<5>(bits);
+    return value.f;
+}
+
+/* Clamp to [0, 1] range and round to nearest integer value */
+inline UnsignedInt packUnorm(const Float value, const Float max) {
+    return UnsignedInt(Math::clamp(value, 0.0f, 1.0f)*max + 0.5f);
+}
+
+#ifdef MAGNUM_MATH_PACKING_SSE2
+inline __m128i packUnorm(const __m128 value, const __m128 max) {
+    return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f)), max), _mm_set1_ps(0.5f)));
+}
+#endif
+
+/* Linear values of all 8-bit sRGB values */
+constexpr Float SrgbToLinear[256]{
+    0.0f, 0.000303526991f, 0.000607053982f, 0.000910580973f, 0.00121410796f,
+    0.00151763496f, 0.00182116195f, 0.00212468882f, 0.00242821593f, 0.0027317428f,
+    0.00303526991f, 0.00334653584f, 0.00367650739f, 0.00402471703f, 0.00439144205f,
+    0.00477695325f, 0.00518151652f, 0.00560539169f, 0.00604883302f, 0.00651209056f,
+    0.00699541019f, 0.00749903219f, 0.00802319311f, 0.00856812578f, 0.00913405884f,
+    0.00972121768f, 0.010329823f, 0.0109600937f, 0.0116122449f, 0.012286488f,
+    0.0129830325f, 0.0137020834f, 0.0144438436f, 0.0152085144f, 0.0159962941f,
+    0.0168073755f, 0.0176419541f, 0.01850022f, 0.0193823613f, 0.0202885624f,
+    0.0212190095f, 0.0221738853f, 0.0231533665f, 0.0241576321f, 0.0251868591f,
+    0.0262412224f, 0.0273208916f, 0.02842604f, 0.0295568351f, 0.0307134446f,
+    0.0318960324f, 0.0331047662f, 0.0343398079f, 0.0356013142f, 0.0368894488f,
+    0.0382043719f, 0.0395462364f, 0.0409151986f, 0.0423114114f, 0.043735031f,
+    0.045186203f, 0.0466650873f, 0.0481718257f, 0.0497065671f, 0.0512694567f,
+    0.0528606474f, 0.054480277f, 0.0561284907f, 0.0578054301f, 0.0595112368f,
+    0.0612460524f, 0.0630100146f, 0.064803265f, 0.0666259378f, 0.0684781671f,
+    0.0703600943f, 0.0722718537f, 0.0742135718f, 0.0761853829f, 0.078187421f,
+    0.0802198201f, 0.0822827071f, 0.0843762085f, 0.0865004584f, 0.0886555836f,
+    0.0908417106f, 0.0930589661f, 0.0953074694f, 0.097587347f, 0.0998987257f,
+    0.102241732f, 0.104616486f, 0.107023105f, 0.10946171f, 0.111932427f,
+    0.114435375f, 0.116970666f, 0.119538426f, 0.122138776f, 0.124771819f,
+    0.127437681f, 0.130136475f, 0.13286832f, 0.135633335f, 0.138431609f,
+    0.141263291f, 0.144128472f, 0.147027269f, 0.149959788f, 0.152926147f,
+    0.155926466f, 0.158960834f, 0.162029371f, 0.165132195f, 0.168269396f,
+    0.171441108f, 0.174647406f, 0.177888423f, 0.18116425f, 0.18447499f,
+    0.187820777f, 0.191201687f, 0.194617838f, 0.198069319f, 0.20155625f,
+    0.205078736f, 0.208636865f, 0.212230757f, 0.215860501f, 0.219526201f,
+    0.223227963f, 0.226965874f, 0.230740055f, 0.23455058f, 0.238397568f,
+    0.242281124f, 0.246201321f, 0.25015828f, 0.254152089f, 0.258182853f,
+    0.262250662f, 0.266355604f, 0.270497799f, 0.274677306f, 0.278894275f,
+    0.283148736f, 0.287440836f, 0.291770637f, 0.296138257f, 0.300543785f,
+    0.304987311f, 0.309468925f, 0.313988715f, 0.318546772f, 0.323143214f,
+    0.327778101f, 0.332451522f, 0.337163627f, 0.341914415f, 0.346704066f,
+    0.351532608f, 0.356400132f, 0.361306787f, 0.366252601f, 0.371237695f,
+    0.376262128f, 0.38132602f, 0.386429429f, 0.391572475f, 0.396755219f,
+    0.401977777f, 0.407240212f, 0.412542611f, 0.417885065f, 0.423267663f,
+    0.428690493f, 0.434153646f, 0.439657182f, 0.445201188f, 0.450785786f,
+    0.456411034f, 0.462076992f, 0.467783809f, 0.473531485f, 0.479320168f,
+    0.48514995f, 0.491020858f, 0.496932983f, 0.502886474f, 0.50888133f,
+    0.514917672f, 0.520995557f, 0.527115107f, 0.533276379f, 0.539479494f,
+    0.545724452f, 0.55201143f, 0.558340371f, 0.564711511f, 0.571124852f,
+    0.577580452f, 0.584078431f, 0.590618849f, 0.597201765f, 0.603827357f,
+    0.610495567f, 0.617206573f, 0.623960376f, 0.630757153f, 0.637596846f,
+    0.644479692f, 0.651405632f, 0.658374846f, 0.665387273f, 0.672443151f,
+    0.679542482f, 0.686685324f, 0.693871737f, 0.701101899f, 0.708375752f,
+    0.715693474f, 0.723055124f, 0.730460763f, 0.73791039f, 0.745404184f,
+    0.752942204f, 0.760524511f, 0.768151164f, 0.775822222f, 0.783537805f,
+    0.791297913f, 0.799102724f, 0.806952238f, 0.814846575f, 0.822785735f,
+    0.830769897f, 0.838799f, 0.846873224f, 0.854992628f, 0.863157213f,
+    0.871367097f, 0.8796224f, 0.887923121f, 0.896269381f, 0.904661179f,
+    0.913098633f, 0.921581864f, 0.930110872f, 0.938685715f, 0.947306514f,
+    0.955973327f, 0.964686275f, 0.973445296f, 0.982250571f, 0.991102099f,
+    1.0f
+};
+
+/* Piecewise linear approximation of the sRGB curve, mapping 32-bit float
+   values in range [2^-13, 1) directly to 8-bit sRGB values. The table is
+   indexed by exponent and highest three mantissa bits, each entry contains
+   bias in the upper 16 bits and scale in the lower 16 bits of a linear
+   function in the following eight mantissa bits. Based on "float_to_srgb8"
+   from https://gist.github.com/rygorous/2203834, with the coefficients
+   refitted to minimize maximal error against the exact curve. */
+constexpr UnsignedInt LinearToSrgbMin = (127 - 13) << 23;
+constexpr UnsignedInt LinearToSrgbAlmostOne = 0x3f7fffff;
+constexpr UnsignedInt LinearToSrgb[104]{
+    0x0073000d, 0x00770013, 0x0080000d, 0x0087000d, 0x008d000d, 0x0094000d,
+    0x009a000d, 0x00a1000d, 0x00a7001a, 0x00b4001a, 0x00c1001a, 0x00ce001a,
+    0x00da001a, 0x00e7001a, 0x00f00023, 0x0101001a, 0x010e0033, 0x01280033,
+    0x01410033, 0x015b0033, 0x01750033, 0x018f0033, 0x01a80033, 0x01c20033,
+    0x01d60078, 0x020f0067, 0x02430067, 0x027100a0, 0x02aa0067, 0x02d6007d,
+    0x03110067, 0x03440067, 0x0375010d, 0x03df00ce, 0x044600ce, 0x04a500e0,
+    0x051400ce, 0x057900ef, 0x05dd00bc, 0x063300cb, 0x06970158, 0x073a016e,
+    0x07e30130, 0x087a0121, 0x090b0112, 0x09940106, 0x0a1700fc, 0x0a8d0103,
+    0x0b0701ec, 0x0bf301b1, 0x0ccc0191, 0x0d8d019f, 0x0e55016f, 0x0f0d015e,
+    0x0fbc0150, 0x10630143, 0x11080261, 0x12380240, 0x1357021d, 0x14650204,
+    0x156501ee, 0x165a01d3, 0x174401be, 0x182101bf, 0x18fb0335, 0x1a9602fd,
+    0x1c1502d2, 0x1d7d02ad, 0x1ed4028d, 0x201a0270, 0x21520256, 0x227c0242,
+    0x239f0443, 0x25c103fd, 0x27bf03c4, 0x29a10392, 0x2b690368, 0x2d1d0341,
+    0x2ebe031f, 0x304c0302, 0x31d105ac, 0x34a90552, 0x3751050d, 0x39d504c0,
+    0x3c37048b, 0x3e7a045e, 0x40a80428, 0x42bd0401, 0x44c30797, 0x488a0722,
+    0x4c1c06b8, 0x4f740664, 0x52a20617, 0x55ab05cc, 0x5892058d, 0x5b580556,
+    0x5e0b0a26, 0x631c0980, 0x67dc08f0, 0x6c55087f, 0x70970811, 0x749b07c5,
+    0x787c076e, 0x7c30072d
+};
+
+inline UnsignedByte linearToSrgb(const Float value) {
+    FloatBits min, almostOne, bits;
+    min.u = LinearToSrgbMin;
+    almostOne.u = LinearToSrgbAlmostOne;
+
+    /* Written this way to convert NaN to zero */
+    bits.f = value > min.f ? value : min.f;
+    if(bits.f > almostOne.f) bits.f = almostOne.f;
+
+    const UnsignedInt entry = LinearToSrgb[(bits.u - LinearToSrgbMin) >> 20];
+    const UnsignedInt bias = (entry >> 16) << 9;
+    const UnsignedInt scale = entry & 0xffff;
+    return UnsignedByte((bias + scale*((bits.u >> 12) & 0xff)) >> 16);
+}
+
+#ifdef MAGNUM_MATH_PACKING_SSE2
+inline __m128i linearToSrgb(const __m128 value) {
+    /* _mm_max_ps() returns the second operand if the first is NaN */
+    const __m128i bits = _mm_castps_si128(_mm_min_ps(
+        _mm_max_ps(value, _mm_castsi128_ps(_mm_set1_epi32(LinearToSrgbMin))),
+        _mm_castsi128_ps(_mm_set1_epi32(LinearToSrgbAlmostOne))));
+
+    /* There's no gather in SSE2, fetching the entries one by one */
+    UnsignedInt indices[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(indices), _mm_srli_epi32(_mm_sub_epi32(bits, _mm_set1_epi32(LinearToSrgbMin)), 20));
+    const __m128i entry = _mm_setr_epi32(LinearToSrgb[indices[0]], LinearToSrgb[indices[1]], LinearToSrgb[indices[2]], LinearToSrgb[indices[3]]);
+
+    /* All scales in the table are less than 2^15, so the multiplication can
+       be done with a signed 16-bit multiply-add */
+    const __m128i bias = _mm_slli_epi32(_mm_srli_epi32(entry, 16), 9);
+    const __m128i scale = _mm_and_si128(entry, _mm_set1_epi32(0xffff));
+    const __m128i t = _mm_and_si128(_mm_srli_epi32(bits, 12), _mm_set1_epi32(0xff));
+    return _mm_srli_epi32(_mm_add_epi32(bias, _mm_madd_epi16(scale, t)), 16);
+}
+#endif
+
+}
+
+UnsignedShort packHalf(const Float value) {
+    FloatBits bits;
+    bits.f = value;
+    const UnsignedInt sign = bits.u & 0x80000000u;
+    return UnsignedShort(packSmallFloat<10>(bits.u ^ sign)|(sign >> 16));
+}
+
+Float unpackHalf(const UnsignedShort value) {
+    FloatBits bits;
+    bits.u = unpackSmallFloat<10>(value & 0x7fff)|((value & 0x8000) << 16);
+    return bits.f;
+}
+
+void packHalf(const Corrade::Containers::ArrayView<const Float> values, const Corrade::Containers::ArrayView<UnsignedShort> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::packHalf(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_PACKING_F16C
+    for(; i + 8 <= values.size(); i += 8) {
+        const __m128i a = _mm_cvtps_ph(_mm_loadu_ps(values.data() + i), _MM_FROUND_TO_NEAREST_INT);
+        const __m128i b = _mm_cvtps_ph(_mm_loadu_ps(values.data() + i + 4), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), _mm_unpacklo_epi64(a, b));
+    }
+    #endif
+    for(; i != values.size(); ++i)
+        out[i] = packHalf(values[i]);
+}
+
+void unpackHalf(const Corrade::Containers::ArrayView<const UnsignedShort> values, const Corrade::Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::unpackHalf(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_PACKING_F16C
+    for(; i + 8 <= values.size(); i += 8) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values.data() + i));
+        _mm_storeu_ps(out.data() + i, _mm_cvtph_ps(in));
+        _mm_storeu_ps(out.data() + i + 4, _mm_cvtph_ps(_mm_unpackhi_epi64(in, in)));
+    }
+    #endif
+    for(; i != values.size(); ++i)
+        out[i] = unpackHalf(values[i]);
+}
+
+void normalize(const Corrade::Containers::ArrayView<const UnsignedByte> values, const Corrade::Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::normalize(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_PACKING_SSE41
+    const __m128 max = _mm_set1_ps(255.0f);
+    for(; i + 4 <= values.size(); i += 4) {
+        Int in;
+        std::memcpy(&in, values.data() + i, 4);
+        _mm_storeu_ps(out.data() + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(in))), max));
+    }
+    #endif
+    for(; i != values.size(); ++i)
+        out[i] = Math::normalize<Float>(values[i]);
+}
+
+void normalize(const Corrade::Containers::ArrayView<const Byte> values, const Corrade::Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::normalize(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_PACKING_SSE41
+    const __m128 max = _mm_set1_ps(127.0f);
+    const __m128 min = _mm_set1_ps(-1.0f);
+    for(; i + 4 <= values.size(); i += 4) {
+        Int in;
+        std::memcpy(&in, values.data() + i, 4);
+        _mm_storeu_ps(out.data() + i, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(in))), max), min));
+    }
+    #endif
+    for(; i != values.size(); ++i)
+        out[i] = Math::normalize<Float>(values[i]);
+}
+
+void normalize(const Corrade::Containers::ArrayView<const UnsignedShort> values, const Corrade::Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::normalize(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_PACKING_SSE41
+    const __m128 max = _mm_set1_ps(65535.0f);
+    for(; i + 4 <= values.size(); i += 4) {
+        const __m128i in = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(values.data() + i));
+        _mm_storeu_ps(out.data() + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(in)), max));
+    }
+    #endif
+    for(; i != values.size(); ++i)
+        out[i] = Math::normalize<Float>(values[i]);
+}
+
+void normalize(const Corrade::Containers::ArrayView<const Short> values, const Corrade::Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::normalize(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_PACKING_SSE41
+    const __m128 max = _mm_set1_ps(32767.0f);
+    const __m128 min = _mm_set1_ps(-1.0f);
+    for(; i + 4 <= values.size(); i += 4) {
+        const __m128i in = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(values.data() + i));
+        _mm_storeu_ps(out.data() + i, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(in)), max), min));
+    }
+    #endif
+    for(; i != values.size(); ++i)
+        out[i] = Math::normalize<Float>(values[i]);
+}
+
+void denormalize(const Corrade::Containers::ArrayView<const Float> values, const Corrade::Containers::ArrayView<UnsignedByte> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::denormalize(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_PACKING_SSE41
+    const __m128 max = _mm_set1_ps(255.0f);
+    for(; i + 16 <= values.size(); i += 16) {
+        const __m128i a = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(values.data() + i), max));
+        const __m128i b = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(values.data() + i + 4), max));
+        const __m128i c = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(values.data() + i + 8), max));
+        const __m128i d = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(values.data() + i + 12), max));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+    #endif
+    for(; i != values.size(); ++i)
+        out[i] = Math::denormalize<UnsignedByte>(values[i]);
+}
+
+void denormalize(const Corrade::Containers::ArrayView<const Float> values, const Corrade::Containers::ArrayView<Byte> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::denormalize(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_PACKING_SSE41
+    const __m128 max = _mm_set1_ps(127.0f);
+    for(; i + 16 <= values.size(); i += 16) {
+        const __m128i a = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(values.data() + i), max));
+        const __m128i b = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(values.data() + i + 4), max));
+        const __m128i c = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(values.data() + i + 8), max));
+        const __m128i d = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(values.data() + i + 12), max));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+    #endif
+    for(; i != values.size(); ++i)
+        out[i] = Math::denormalize<Byte>(values[i]);
+}
+
+void denormalize(const Corrade::Containers::ArrayView<const Float> values, const Corrade::Containers::ArrayView<UnsignedShort> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::denormalize(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_PACKING_SSE41
+    const __m128 max = _mm_set1_ps(65535.0f);
+    for(; i + 8 <= values.size(); i += 8) {
+        const __m128i a = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(values.data() + i), max));
+        const __m128i b = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(values.data() + i + 4), max));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), _mm_packus_epi32(a, b));
+    }
+    #endif
+    for(; i != values.size(); ++i)
+        out[i] = Math::denormalize<UnsignedShort>(values[i]);
+}
+
+void denormalize(const Corrade::Containers::ArrayView<const Float> values, const Corrade::Containers::ArrayView<Short> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::denormalize(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_PACKING_SSE41
+    const __m128 max = _mm_set1_ps(32767.0f);
+    for(; i + 8 <= values.size(); i += 8) {
+        const __m128i a = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(values.data() + i), max));
+        const __m128i b = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(values.data() + i + 4), max));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), _mm_packs_epi32(a, b));
+    }
+    #endif
+    for(; i != values.size(); ++i)
+        out[i] = Math::denormalize<Short>(values[i]);
+}
+
+UnsignedInt packR11G11B10F(const Vector3<Float>& value) {
+    return packUnsignedSmallFloat11(value.x())|
+           (packUnsignedSmallFloat11(value.y()) << 11)|
+           (packUnsignedSmallFloat10(value.z()) << 22);
+}
+
+Vector3<Float> unpackR11G11B10F(const UnsignedInt value) {
+    return {unpackUnsignedSmallFloat(value & 0x7ff, 6),
+            unpackUnsignedSmallFloat((value >> 11) & 0x7ff, 6),
+            unpackUnsignedSmallFloat(value >> 22, 5)};
+}
+
+void packR11G11B10F(const Corrade::Containers::ArrayView<const Vector3<Float>> values, const Corrade::Containers::ArrayView<UnsignedInt> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::packR11G11B10F(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = packR11G11B10F(values[i]);
+}
+
+void unpackR11G11B10F(const Corrade::Containers::ArrayView<const UnsignedInt> values, const Corrade::Containers::ArrayView<Vector3<Float>> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::unpackR11G11B10F(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = unpackR11G11B10F(values[i]);
+}
+
+UnsignedInt packRGB10A2(const Vector4<Float>& value) {
+    return packUnorm(value.x(), 1023.0f)|
+           (packUnorm(value.y(), 1023.0f) << 10)|
+           (packUnorm(value.z(), 1023.0f) << 20)|
+           (packUnorm(value.w(), 3.0f) << 30);
+}
+
+Vector4<Float> unpackRGB10A2(const UnsignedInt value) {
+    return {(value & 0x3ff)/1023.0f,
+            ((value >> 10) & 0x3ff)/1023.0f,
+            ((value >> 20) & 0x3ff)/1023.0f,
+            (value >> 30)/3.0f};
+}
+
+void packRGB10A2(const Corrade::Containers::ArrayView<const Vector4<Float>> values, const Corrade::Containers::ArrayView<UnsignedInt> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::packRGB10A2(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_PACKING_SSE2
+    const __m128 max = _mm_set1_ps(1023.0f);
+    const __m128 maxAlpha = _mm_set1_ps(3.0f);
+    for(; i + 4 <= values.size(); i += 4) {
+        /* Transpose four vectors to have each component in one register */
+        __m128 r = _mm_loadu_ps(values[i].data());
+        __m128 g = _mm_loadu_ps(values[i + 1].data());
+        __m128 b = _mm_loadu_ps(values[i + 2].data());
+        __m128 a = _mm_loadu_ps(values[i + 3].data());
+        _MM_TRANSPOSE4_PS(r, g, b, a);
+
+        const __m128i packed = _mm_or_si128(
+            _mm_or_si128(packUnorm(r, max), _mm_slli_epi32(packUnorm(g, max), 10)),
+            _mm_or_si128(_mm_slli_epi32(packUnorm(b, max), 20), _mm_slli_epi32(packUnorm(a, maxAlpha), 30)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), packed);
+    }
+    #endif
+    for(; i != values.size(); ++i)
+        out[i] = packRGB10A2(values[i]);
+}
+
+void unpackRGB10A2(const Corrade::Containers::ArrayView<const UnsignedInt> values, const Corrade::Containers::ArrayView<Vector4<Float>> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::unpackRGB10A2(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = unpackRGB10A2(values[i]);
+}
+
+void fromSrgb(const Corrade::Containers::ArrayView<const Color3<UnsignedByte>> values, const Corrade::Containers::ArrayView<Color3<Float>> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::fromSrgb(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = {SrgbToLinear[values[i].r()], SrgbToLinear[values[i].g()], SrgbToLinear[values[i].b()]};
+}
+
+void fromSrgbAlpha(const Corrade::Containers::ArrayView<const Color4<UnsignedByte>> values, const Corrade::Containers::ArrayView<Color4<Float>> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::fromSrgbAlpha(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = {SrgbToLinear[values[i].r()], SrgbToLinear[values[i].g()], SrgbToLinear[values[i].b()], Math::normalize<Float>(values[i].a())};
+}
+
+void toSrgb(const Corrade::Containers::ArrayView<const Color3<Float>> values, const Corrade::Containers::ArrayView<Color3<UnsignedByte>> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::toSrgb(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    /* All channels are converted the same way, so the data can be processed
+       as a flat array of floats */
+    const Float* const in = values.data()->data();
+    UnsignedByte* const o = out.data()->data();
+    const std::size_t size = values.size()*3;
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_PACKING_SSE2
+    for(; i + 16 <= size; i += 16) {
+        const __m128i a = linearToSrgb(_mm_loadu_ps(in + i));
+        const __m128i b = linearToSrgb(_mm_loadu_ps(in + i + 4));
+        const __m128i c = linearToSrgb(_mm_loadu_ps(in + i + 8));
+        const __m128i d = linearToSrgb(_mm_loadu_ps(in + i + 12));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(o + i), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+    #endif
+    for(; i != size; ++i)
+        o[i] = linearToSrgb(in[i]);
+}
+
+void toSrgbAlpha(const Corrade::Containers::ArrayView<const Color4<Float>> values, const Corrade::Containers::ArrayView<Color4<UnsignedByte>> out) {
+    CORRADE_ASSERT(values.size() == out.size(),
+        "Math::toSrgbAlpha(): output view has wrong size, expected" << values.size() << "but got" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_PACKING_SSE2
+    /* Converting all four channels using the sRGB curve and then replacing
+       the alpha with a linear conversion */
+    const __m128i alphaMask = _mm_setr_epi32(0, 0, 0, -1);
+    const __m128 max = _mm_set1_ps(255.0f);
+    for(; i + 4 <= values.size(); i += 4) {
+        __m128i converted[4];
+        for(std::size_t j = 0; j != 4; ++j) {
+            const __m128 in = _mm_loadu_ps(values[i + j].data());
+            converted[j] = _mm_or_si128(_mm_andnot_si128(alphaMask, linearToSrgb(in)), _mm_and_si128(alphaMask, packUnorm(in, max)));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), _mm_packus_epi16(_mm_packs_epi32(converted[0], converted[1]), _mm_packs_epi32(converted[2], converted[3])));
+    }
+    #endif
+    for(; i != values.size(); ++i)
+        out[i] = {linearToSrgb(values[i].r()), linearToSrgb(values[i].g()), linearToSrgb(values[i].b()), UnsignedByte(packUnorm(values[i].a(), 255.0f))};
+}
+
+}}
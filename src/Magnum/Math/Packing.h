@@ -0,0 +1,252 @@
+#ifndef Magnum_Math_Packing_h
+#define Magnum_Math_Packing_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Functions @ref Magnum::Math::packHalf(), @ref Magnum::Math::unpackHalf(), @ref Magnum::Math::packR11G11B10F(), @ref Magnum::Math::unpackR11G11B10F(), @ref Magnum::Math::packRGB10A2(), @ref Magnum::Math::unpackRGB10A2(), @ref Magnum::Math::fromSrgb(), @ref Magnum::Math::fromSrgbAlpha(), @ref Magnum::Math::toSrgb(), @ref Magnum::Math::toSrgbAlpha()
+ */
+
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/visibility.h"
+#include "Magnum/Math/Math.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Pack 32-bit float value into 16-bit half-float representation
+
+Rounds to nearest, ties to even. Values larger than the largest representable
+half-float value are converted to infinity, NaN is converted to quiet NaN.
+@see @ref unpackHalf(),
+    @ref packHalf(Corrade::Containers::ArrayView<const Float>, Corrade::Containers::ArrayView<UnsignedShort>)
+*/
+UnsignedShort MAGNUM_EXPORT packHalf(Float value);
+
+/**
+@brief Unpack 16-bit half-float value into 32-bit float representation
+
+The conversion is exact.
+@see @ref packHalf(),
+    @ref unpackHalf(Corrade::Containers::ArrayView<const UnsignedShort>, Corrade::Containers::ArrayView<Float>)
+*/
+Float MAGNUM_EXPORT unpackHalf(UnsignedShort value);
+
+/**
+@brief Pack 32-bit float values into 16-bit half-float representation
+
+Equivalent to calling @ref packHalf(Float) on each item. If the compiler
+targets F16C instructions (e.g. with `-mf16c`) and @ref MAGNUM_TARGET_SSE is
+defined, eight values at a time are converted in hardware. Expects that both
+views have the same size.
+*/
+void MAGNUM_EXPORT packHalf(Corrade::Containers::ArrayView<const Float> values, Corrade::Containers::ArrayView<UnsignedShort> out);
+
+/**
+@brief Unpack 16-bit half-float values into 32-bit float representation
+
+Equivalent to calling @ref unpackHalf(UnsignedShort) on each item. See
+@ref packHalf(Corrade::Containers::ArrayView<const Float>, Corrade::Containers::ArrayView<UnsignedShort>)
+for information about hardware acceleration. Expects that both views have the
+same size.
+*/
+void MAGNUM_EXPORT unpackHalf(Corrade::Containers::ArrayView<const UnsignedShort> values, Corrade::Containers::ArrayView<Float> out);
+
+/**
+@brief Normalize integral values
+
+Equivalent to calling @ref normalize(const Integral&) "normalize<Float>()" on
+each item. If the compiler targets SSE4.1 instructions (e.g. with `-msse4.1`)
+and @ref MAGNUM_TARGET_SSE is defined, multiple values at a time are converted
+using SSE intrinsics. Expects that both views have the same size.
+@see @ref denormalize(Corrade::Containers::ArrayView<const Float>, Corrade::Containers::ArrayView<UnsignedByte>)
+*/
+void MAGNUM_EXPORT normalize(Corrade::Containers::ArrayView<const UnsignedByte> values, Corrade::Containers::ArrayView<Float> out);
+
+/** @overload */
+void MAGNUM_EXPORT normalize(Corrade::Containers::ArrayView<const Byte> values, Corrade::Containers::ArrayView<Float> out);
+
+/** @overload */
+void MAGNUM_EXPORT normalize(Corrade::Containers::ArrayView<const UnsignedShort> values, Corrade::Containers::ArrayView<Float> out);
+
+/** @overload */
+void MAGNUM_EXPORT normalize(Corrade::Containers::ArrayView<const Short> values, Corrade::Containers::ArrayView<Float> out);
+
+/**
+@brief Denormalize floating-point values
+
+Equivalent to calling @ref denormalize(const FloatingPoint&) "denormalize()"
+on each item, thus the same caveats about values outside of the normalized
+range apply. See @ref normalize(Corrade::Containers::ArrayView<const UnsignedByte>, Corrade::Containers::ArrayView<Float>)
+for information about hardware acceleration. Expects that both views have the
+same size.
+*/
+void MAGNUM_EXPORT denormalize(Corrade::Containers::ArrayView<const Float> values, Corrade::Containers::ArrayView<UnsignedByte> out);
+
+/** @overload */
+void MAGNUM_EXPORT denormalize(Corrade::Containers::ArrayView<const Float> values, Corrade::Containers::ArrayView<Byte> out);
+
+/** @overload */
+void MAGNUM_EXPORT denormalize(Corrade::Containers::ArrayView<const Float> values, Corrade::Containers::ArrayView<UnsignedShort> out);
+
+/** @overload */
+void MAGNUM_EXPORT denormalize(Corrade::Containers::ArrayView<const Float> values, Corrade::Containers::ArrayView<Short> out);
+
+/**
+@brief Pack 32-bit float vector into packed R11G11B10F representation
+
+The layout matches `GL_UNSIGNED_INT_10F_11F_11F_REV`, i.e. red component
+in the lowest 11 bits, green in the next 11 bits and blue in the highest 10
+bits. The components are unsigned floats with 5-bit exponent and 6- or 5-bit
+mantissa, rounded to nearest, ties to even. Negative values are converted to
+zero, values larger than the largest representable value are converted to
+infinity.
+@see @ref unpackR11G11B10F()
+*/
+UnsignedInt MAGNUM_EXPORT packR11G11B10F(const Vector3<Float>& value);
+
+/**
+@brief Unpack R11G11B10F value into 32-bit float vector
+
+The conversion is exact.
+@see @ref packR11G11B10F()
+*/
+Vector3<Float> MAGNUM_EXPORT unpackR11G11B10F(UnsignedInt value);
+
+/**
+@brief Pack 32-bit float vectors into packed R11G11B10F representation
+
+Equivalent to calling @ref packR11G11B10F(const Vector3<Float>&) on each item.
+Expects that both views have the same size.
+*/
+void MAGNUM_EXPORT packR11G11B10F(Corrade::Containers::ArrayView<const Vector3<Float>> values, Corrade::Containers::ArrayView<UnsignedInt> out);
+
+/**
+@brief Unpack R11G11B10F values into 32-bit float vectors
+
+Equivalent to calling @ref unpackR11G11B10F(UnsignedInt) on each item. Expects
+that both views have the same size.
+*/
+void MAGNUM_EXPORT unpackR11G11B10F(Corrade::Containers::ArrayView<const UnsignedInt> values, Corrade::Containers::ArrayView<Vector3<Float>> out);
+
+/**
+@brief Pack 32-bit float vector into packed RGB10A2 representation
+
+The layout matches `GL_UNSIGNED_INT_2_10_10_10_REV`, i.e. red component
+in the lowest 10 bits, followed by 10 bits of green, 10 bits of blue and alpha
+in the highest 2 bits. The components are clamped to @f$ [0, 1] @f$ range and
+rounded to nearest representable value.
+@see @ref unpackRGB10A2()
+*/
+UnsignedInt MAGNUM_EXPORT packRGB10A2(const Vector4<Float>& value);
+
+/**
+@brief Unpack RGB10A2 value into 32-bit float vector
+
+@see @ref packRGB10A2()
+*/
+Vector4<Float> MAGNUM_EXPORT unpackRGB10A2(UnsignedInt value);
+
+/**
+@brief Pack 32-bit float vectors into packed RGB10A2 representation
+
+Equivalent to calling @ref packRGB10A2(const Vector4<Float>&) on each item. If
+@ref MAGNUM_TARGET_SSE is defined and the compiler targets SSE2 instructions,
+four values at a time are converted using SSE intrinsics. Expects that both
+views have the same size.
+*/
+void MAGNUM_EXPORT packRGB10A2(Corrade::Containers::ArrayView<const Vector4<Float>> values, Corrade::Containers::ArrayView<UnsignedInt> out);
+
+/**
+@brief Unpack RGB10A2 values into 32-bit float vectors
+
+Equivalent to calling @ref unpackRGB10A2(UnsignedInt) on each item. Expects
+that both views have the same size.
+*/
+void MAGNUM_EXPORT unpackRGB10A2(Corrade::Containers::ArrayView<const UnsignedInt> values, Corrade::Containers::ArrayView<Vector4<Float>> out);
+
+/**
+@brief Convert 8-bit sRGB colors to linear RGB
+
+Equivalent to calling @ref Color3::fromSrgb() on each item, but instead of
+evaluating the sRGB curve, the values are taken from a 256-entry lookup table.
+The result is the exact curve value rounded to nearest representable float,
+differing from @ref Color3::fromSrgb() by at most one unit in the last place.
+Expects that both views have the same size.
+
+Note that the overloads differ only in view types, thus arrays need to be
+converted to views explicitly:
+@code
+Color3ub image[256*256];
+Color3 linear[256*256];
+Math::fromSrgb(Containers::arrayView(image), Containers::arrayView(linear));
+@endcode
+@see @ref toSrgb(Corrade::Containers::ArrayView<const Color3<Float>>, Corrade::Containers::ArrayView<Color3<UnsignedByte>>)
+*/
+void MAGNUM_EXPORT fromSrgb(Corrade::Containers::ArrayView<const Color3<UnsignedByte>> values, Corrade::Containers::ArrayView<Color3<Float>> out);
+
+/**
+@brief Convert 8-bit sRGB + alpha colors to linear RGBA
+
+Equivalent to calling @ref Color4::fromSrgbAlpha() on each item, alpha is
+kept linear. See @ref fromSrgb(Corrade::Containers::ArrayView<const Color3<UnsignedByte>>, Corrade::Containers::ArrayView<Color3<Float>>)
+for more information.
+@see @ref toSrgbAlpha(Corrade::Containers::ArrayView<const Color4<Float>>, Corrade::Containers::ArrayView<Color4<UnsignedByte>>)
+*/
+void MAGNUM_EXPORT fromSrgbAlpha(Corrade::Containers::ArrayView<const Color4<UnsignedByte>> values, Corrade::Containers::ArrayView<Color4<Float>> out);
+
+/**
+@brief Convert linear RGB colors to 8-bit sRGB
+
+Alternative to calling @ref Color3::toSrgb() "Color3::toSrgb<UnsignedByte>()"
+on each item. Instead of evaluating the sRGB curve, a piecewise linear
+approximation stored in a 104-entry table is used. Inputs are clamped to
+@f$ [0, 1] @f$ range, NaN is converted to zero. For all inputs the result
+differs from the correctly rounded value by at most one, the maximal absolute
+error compared to the exact curve is about @f$ 0.54 @f$ of the 8-bit quantization
+step (compared to @f$ 0.5 @f$ for correct rounding); about 0.04% of inputs in
+the @f$ [0, 1] @f$ range differ from the correctly rounded value. If
+@ref MAGNUM_TARGET_SSE is defined and the compiler targets SSE2 instructions,
+sixteen channels at a time are converted using SSE intrinsics. Expects that
+both views have the same size.
+@see @ref fromSrgb(Corrade::Containers::ArrayView<const Color3<UnsignedByte>>, Corrade::Containers::ArrayView<Color3<Float>>)
+*/
+void MAGNUM_EXPORT toSrgb(Corrade::Containers::ArrayView<const Color3<Float>> values, Corrade::Containers::ArrayView<Color3<UnsignedByte>> out);
+
+/**
+@brief Convert linear RGBA colors to 8-bit sRGB + alpha
+
+Alternative to calling @ref Color4::toSrgbAlpha() "Color4::toSrgbAlpha<UnsignedByte>()"
+on each item. Alpha is kept linear, clamped to @f$ [0, 1] @f$ range and rounded
+to nearest. See @ref toSrgb(Corrade::Containers::ArrayView<const Color3<Float>>, Corrade::Containers::ArrayView<Color3<UnsignedByte>>)
+for more information.
+@see @ref fromSrgbAlpha(Corrade::Containers::ArrayView<const Color4<UnsignedByte>>, Corrade::Containers::ArrayView<Color4<Float>>)
+*/
+void MAGNUM_EXPORT toSrgbAlpha(Corrade::Containers::ArrayView<const Color4<Float>> values, Corrade::Containers::ArrayView<Color4<UnsignedByte>> out);
+
+}}
+
+#endif
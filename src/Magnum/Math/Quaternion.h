@@ -60,6 +60,17 @@ namespace Implementation {
     template<class T> inline T angle(const Quaternion<T>& normalizedA, const Quaternion<T>& normalizedB) {
         return std::acos(dot(normalizedA, normalizedB));
     }
+
+    /* Used in slerp() and its batch variant (no assertions) */
+    template<class T> Quaternion<T> slerp(const Quaternion<T>& normalizedA, const Quaternion<T>& normalizedB, T t) {
+        const T cosHalfAngle = dot(normalizedA, normalizedB);
+
+        /* Avoid division by zero */
+        if(std::abs(cosHalfAngle) >= T(1)) return Quaternion<T>{normalizedA};
+
+        const T a = std::acos(cosHalfAngle);
+        return (std::sin((T(1) - t)*a)*normalizedA + std::sin(t*a)*normalizedB)/std::sin(a);
+    }
 }
 
 /** @relatesalso Quaternion
@@ -113,13 +124,7 @@ or one is a negation of the other, returns the first argument. @f[
 template<class T> inline Quaternion<T> slerp(const Quaternion<T>& normalizedA, const Quaternion<T>& normalizedB, T t) {
     CORRADE_ASSERT(normalizedA.isNormalized() && normalizedB.isNormalized(),
         "Math::slerp(): quaternions must be normalized", {});
-    const T cosHalfAngle = dot(normalizedA, normalizedB);
-
-    /* Avoid division by zero */
-    if(std::abs(cosHalfAngle) >= T(1)) return Quaternion<T>{normalizedA};
-
-    const T a = std::acos(cosHalfAngle);
-    return (std::sin((T(1) - t)*a)*normalizedA + std::sin(t*a)*normalizedB)/std::sin(a);
+    return Implementation::slerp(normalizedA, normalizedB, t);
 }
 
 /**
@@ -679,6 +679,71 @@ template<std::size_t cols, std::size_t rows, class T> template<std::size_t size>
     return out;
 }
 
+#ifndef DOXYGEN_GENERATING_OUTPUT
+/* SIMD versions of the above for 4x4 Float matrices. Each output column is a
+   linear combination of the columns of the left operand, summed in the same
+   order as in the generic case. */
+#ifdef MAGNUM_TARGET_SSE
+template<> template<> inline RectangularMatrix<4, 4, Float> RectangularMatrix<4, 4, Float>::operator*<4>(const RectangularMatrix<4, 4, Float>& other) const {
+    const __m128 a0 = _mm_loadu_ps(_data[0].data());
+    const __m128 a1 = _mm_loadu_ps(_data[1].data());
+    const __m128 a2 = _mm_loadu_ps(_data[2].data());
+    const __m128 a3 = _mm_loadu_ps(_data[3].data());
+
+    RectangularMatrix<4, 4, Float> out{NoInit};
+    for(std::size_t col = 0; col != 4; ++col) {
+        const Float* const b = other._data[col].data();
+        _mm_storeu_ps(out._data[col].data(), _mm_add_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(a0, _mm_set1_ps(b[0])),
+            _mm_mul_ps(a1, _mm_set1_ps(b[1]))),
+            _mm_mul_ps(a2, _mm_set1_ps(b[2]))),
+            _mm_mul_ps(a3, _mm_set1_ps(b[3]))));
+    }
+
+    return out;
+}
+
+template<> inline Vector<4, Float> RectangularMatrix<4, 4, Float>::operator*(const Vector<4, Float>& other) const {
+    Vector<4, Float> out{NoInit};
+    _mm_storeu_ps(out.data(), _mm_add_ps(_mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_loadu_ps(_data[0].data()), _mm_set1_ps(other[0])),
+        _mm_mul_ps(_mm_loadu_ps(_data[1].data()), _mm_set1_ps(other[1]))),
+        _mm_mul_ps(_mm_loadu_ps(_data[2].data()), _mm_set1_ps(other[2]))),
+        _mm_mul_ps(_mm_loadu_ps(_data[3].data()), _mm_set1_ps(other[3]))));
+    return out;
+}
+#elif defined(MAGNUM_TARGET_NEON)
+template<> template<> inline RectangularMatrix<4, 4, Float> RectangularMatrix<4, 4, Float>::operator*<4>(const RectangularMatrix<4, 4, Float>& other) const {
+    const float32x4_t a0 = vld1q_f32(_data[0].data());
+    const float32x4_t a1 = vld1q_f32(_data[1].data());
+    const float32x4_t a2 = vld1q_f32(_data[2].data());
+    const float32x4_t a3 = vld1q_f32(_data[3].data());
+
+    RectangularMatrix<4, 4, Float> out{NoInit};
+    for(std::size_t col = 0; col != 4; ++col) {
+        const Float* const b = other._data[col].data();
+        vst1q_f32(out._data[col].data(), vaddq_f32(vaddq_f32(vaddq_f32(
+            vmulq_n_f32(a0, b[0]),
+            vmulq_n_f32(a1, b[1])),
+            vmulq_n_f32(a2, b[2])),
+            vmulq_n_f32(a3, b[3])));
+    }
+
+    return out;
+}
+
+template<> inline Vector<4, Float> RectangularMatrix<4, 4, Float>::operator*(const Vector<4, Float>& other) const {
+    Vector<4, Float> out{NoInit};
+    vst1q_f32(out.data(), vaddq_f32(vaddq_f32(vaddq_f32(
+        vmulq_n_f32(vld1q_f32(_data[0].data()), other[0]),
+        vmulq_n_f32(vld1q_f32(_data[1].data()), other[1])),
+        vmulq_n_f32(vld1q_f32(_data[2].data()), other[2])),
+        vmulq_n_f32(vld1q_f32(_data[3].data()), other[3])));
+    return out;
+}
+#endif
+#endif
+
 template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<rows, cols, T> RectangularMatrix<cols, rows, T>::transposed() const {
     RectangularMatrix<rows, cols, T> out;
 
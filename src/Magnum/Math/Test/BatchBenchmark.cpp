@@ -0,0 +1,287 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Math/Bezier.h"
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct BatchBenchmark: Corrade::TestSuite::Tester {
+    explicit BatchBenchmark();
+
+    void transformPointsLoop();
+    void transformPoints();
+    void multiplyLoop();
+    void multiply();
+    void normalizeLoop();
+    void normalize();
+    void bezierValuesLoop();
+    void bezierValues();
+    void lerpQuaternionLoop();
+    void lerpQuaternion();
+    void skinLoop();
+    void skin();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Vector4<UnsignedInt> Vector4ui;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::DualQuaternion<Float> DualQuaternion;
+
+namespace {
+    enum: std::size_t {
+        Count = 1000,
+        Repeats = 100
+    };
+
+    const Matrix4 Transformation = Matrix4::translation({1.0f, -3.0f, 0.5f})*
+        Matrix4::rotation(Deg(35.0f), Vector3{1.0f, 1.0f, -1.0f}.normalized());
+
+    Corrade::Containers::Array<Vector3> points() {
+        Corrade::Containers::Array<Vector3> out{Count};
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = {Float(i), Float(i%7) - 3.0f, 1.0f + Float(i%3)};
+        return out;
+    }
+
+    Corrade::Containers::Array<Matrix4> matrices() {
+        Corrade::Containers::Array<Matrix4> out{Count};
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Matrix4::translation({Float(i), 0.0f, 1.0f})*Matrix4::rotationY(Deg(Float(i)));
+        return out;
+    }
+
+    Corrade::Containers::Array<CubicBezier3D<Float>> curves() {
+        Corrade::Containers::Array<CubicBezier3D<Float>> out{Count};
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = {Vector3{Float(i), 0.0f, 1.0f}, Vector3{1.0f, Float(i%7), 0.0f},
+                      Vector3{0.0f, 2.0f, Float(i%3)}, Vector3{-1.0f, 1.0f, Float(i)}};
+        return out;
+    }
+
+    Corrade::Containers::Array<Quaternion> quaternions(Float offset) {
+        Corrade::Containers::Array<Quaternion> out{Count};
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Quaternion::rotation(Deg(Float(i) + offset), Vector3{1.0f, 1.0f, -1.0f}.normalized());
+        return out;
+    }
+
+    /* Skeleton of 200 joints, each point influenced by four of them */
+    enum: std::size_t { JointCount = 200 };
+
+    Corrade::Containers::Array<DualQuaternion> joints() {
+        Corrade::Containers::Array<DualQuaternion> out{JointCount};
+        for(std::size_t i = 0; i != JointCount; ++i)
+            out[i] = DualQuaternion::translation({Float(i%5), 0.0f, Float(i%3)})*
+                DualQuaternion::rotation(Deg(Float(i)), Vector3::yAxis());
+        return out;
+    }
+
+    void influences(Corrade::Containers::Array<Vector4ui>& ids, Corrade::Containers::Array<Vector4>& weights) {
+        ids = Corrade::Containers::Array<Vector4ui>{Count};
+        weights = Corrade::Containers::Array<Vector4>{Count};
+        for(std::size_t i = 0; i != Count; ++i) {
+            ids[i] = {UnsignedInt(i%JointCount), UnsignedInt((i*7)%JointCount),
+                      UnsignedInt((i*13)%JointCount), UnsignedInt((i + 1)%JointCount)};
+            weights[i] = {0.4f, 0.3f, 0.2f, 0.1f};
+        }
+    }
+}
+
+BatchBenchmark::BatchBenchmark() {
+    addBenchmarks({&BatchBenchmark::transformPointsLoop,
+                   &BatchBenchmark::transformPoints,
+                   &BatchBenchmark::multiplyLoop,
+                   &BatchBenchmark::multiply,
+                   &BatchBenchmark::normalizeLoop,
+                   &BatchBenchmark::normalize,
+                   &BatchBenchmark::bezierValuesLoop,
+                   &BatchBenchmark::bezierValues,
+                   &BatchBenchmark::lerpQuaternionLoop,
+                   &BatchBenchmark::lerpQuaternion,
+                   &BatchBenchmark::skinLoop,
+                   &BatchBenchmark::skin}, 10);
+}
+
+/* The *Loop variants are the same operations done using the per-item API for
+   comparison. All operations are done in-place to avoid the compiler
+   optimizing the repeated runs away. */
+
+void BatchBenchmark::transformPointsLoop() {
+    Corrade::Containers::Array<Vector3> data = points();
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Count; ++i)
+            data[i] = Transformation.transformPoint(data[i]);
+    }
+
+    CORRADE_VERIFY(data[Count - 1].sum() != 0.0f);
+}
+
+void BatchBenchmark::transformPoints() {
+    Corrade::Containers::Array<Vector3> data = points();
+    CORRADE_BENCHMARK(Repeats) {
+        Math::transformPoints(Transformation, data, data);
+    }
+
+    CORRADE_VERIFY(data[Count - 1].sum() != 0.0f);
+}
+
+void BatchBenchmark::multiplyLoop() {
+    Corrade::Containers::Array<Matrix4> data = matrices();
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Count; ++i)
+            data[i] = Transformation*data[i];
+    }
+
+    CORRADE_VERIFY(data[Count - 1].toVector().sum() != 0.0f);
+}
+
+void BatchBenchmark::multiply() {
+    Corrade::Containers::Array<Matrix4> data = matrices();
+    CORRADE_BENCHMARK(Repeats) {
+        Math::multiply(Transformation, data, data);
+    }
+
+    CORRADE_VERIFY(data[Count - 1].toVector().sum() != 0.0f);
+}
+
+void BatchBenchmark::normalizeLoop() {
+    Corrade::Containers::Array<Vector3> data = points();
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Count; ++i)
+            data[i] = data[i].normalized();
+    }
+
+    CORRADE_VERIFY(data[Count - 1].sum() != 0.0f);
+}
+
+void BatchBenchmark::normalize() {
+    Corrade::Containers::Array<Vector3> data = points();
+    CORRADE_BENCHMARK(Repeats) {
+        Math::normalize(data, data);
+    }
+
+    CORRADE_VERIFY(data[Count - 1].sum() != 0.0f);
+}
+
+/* The output is fed back as the first control point */
+
+void BatchBenchmark::bezierValuesLoop() {
+    Corrade::Containers::Array<CubicBezier3D<Float>> data = curves();
+    Corrade::Containers::Array<Float> t(Count);
+    for(std::size_t i = 0; i != Count; ++i) t[i] = Float(i%100)/100.0f;
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Count; ++i)
+            data[i][0] = data[i].value(t[i]);
+    }
+
+    CORRADE_VERIFY(data[Count - 1][0].sum() != 0.0f);
+}
+
+void BatchBenchmark::bezierValues() {
+    Corrade::Containers::Array<CubicBezier3D<Float>> data = curves();
+    Corrade::Containers::Array<Float> t(Count);
+    for(std::size_t i = 0; i != Count; ++i) t[i] = Float(i%100)/100.0f;
+    Corrade::Containers::Array<Vector3> out{Count};
+    CORRADE_BENCHMARK(Repeats) {
+        Math::bezierValues(data, t, out);
+        for(std::size_t i = 0; i != Count; ++i)
+            data[i][0] = out[i];
+    }
+
+    CORRADE_VERIFY(data[Count - 1][0].sum() != 0.0f);
+}
+
+void BatchBenchmark::lerpQuaternionLoop() {
+    Corrade::Containers::Array<Quaternion> data = quaternions(0.0f);
+    Corrade::Containers::Array<Quaternion> target = quaternions(90.0f);
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Count; ++i)
+            data[i] = Math::lerp(data[i], target[i], 0.25f);
+    }
+
+    CORRADE_VERIFY(data[Count - 1].scalar() != 0.0f);
+}
+
+void BatchBenchmark::lerpQuaternion() {
+    Corrade::Containers::Array<Quaternion> data = quaternions(0.0f);
+    Corrade::Containers::Array<Quaternion> target = quaternions(90.0f);
+    CORRADE_BENCHMARK(Repeats) {
+        Math::lerp(data, target, 0.25f, data);
+    }
+
+    CORRADE_VERIFY(data[Count - 1].scalar() != 0.0f);
+}
+
+void BatchBenchmark::skinLoop() {
+    Corrade::Containers::Array<DualQuaternion> skeleton = joints();
+    Corrade::Containers::Array<Vector4ui> ids;
+    Corrade::Containers::Array<Vector4> weights;
+    influences(ids, weights);
+    Corrade::Containers::Array<Vector3> data = points();
+
+    /* Blending the joints using dual quaternion arithmetic */
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Count; ++i) {
+            const DualQuaternion& first = skeleton[ids[i][0]];
+            DualQuaternion blended = first*weights[i][0];
+            for(std::size_t k = 1; k != 4; ++k) {
+                const DualQuaternion& joint = skeleton[ids[i][k]];
+                blended += joint*(Math::dot(first.real(), joint.real()) < 0.0f ? -weights[i][k] : weights[i][k]);
+            }
+            const Quaternion real = blended.real()/blended.real().length();
+            const Quaternion dual = blended.dual()/blended.real().length();
+            data[i] = real.transformVectorNormalized(data[i]) + (dual*real.conjugated()).vector()*2.0f;
+        }
+    }
+
+    CORRADE_VERIFY(data[Count - 1].sum() != 0.0f);
+}
+
+void BatchBenchmark::skin() {
+    Corrade::Containers::Array<DualQuaternion> skeleton = joints();
+    Corrade::Containers::Array<Vector4ui> ids;
+    Corrade::Containers::Array<Vector4> weights;
+    influences(ids, weights);
+    Corrade::Containers::Array<Vector3> data = points();
+
+    CORRADE_BENCHMARK(Repeats) {
+        Math::skin(skeleton, ids, weights, data, data);
+    }
+
+    CORRADE_VERIFY(data[Count - 1].sum() != 0.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::BatchBenchmark)
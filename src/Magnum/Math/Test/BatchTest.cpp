@@ -0,0 +1,449 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Math/Bezier.h"
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct BatchTest: Corrade::TestSuite::Tester {
+    explicit BatchTest();
+
+    void transformPoints3D();
+    void transformPoints2D();
+    void transformVectors3D();
+    void transformVectors2D();
+    void transformInPlace();
+    void multiply();
+    void multiplyCommon();
+    void dot();
+    void normalize();
+    void lerp();
+    void bezierValues2D();
+    void bezierValues3D();
+    void lerpQuaternion();
+    void slerpQuaternion();
+    void sclerpDualQuaternion();
+    void skin();
+    void skinNormals();
+    void skinShortestPath();
+
+    void wrongSize();
+    void notNormalized();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Matrix3<Float> Matrix3;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Vector4<UnsignedInt> Vector4ui;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::DualQuaternion<Float> DualQuaternion;
+
+using Corrade::Containers::arrayView;
+
+namespace {
+    /* Seven items, so both the four-item blocks and the remainder are
+       tested */
+    const Vector2 Data2[]{
+        {1.0f, 2.0f}, {-3.0f, 0.5f}, {0.0f, 1.0f}, {7.5f, -2.0f},
+        {0.25f, 4.0f}, {-1.0f, -1.0f}, {3.0f, 0.0f}};
+    const Vector3 Data3[]{
+        {1.0f, 2.0f, 3.0f}, {-3.0f, 0.5f, 1.0f}, {0.0f, 1.0f, 0.0f},
+        {7.5f, -2.0f, 4.0f}, {0.25f, 4.0f, -8.0f}, {-1.0f, -1.0f, -1.0f},
+        {3.0f, 0.0f, 2.0f}};
+    const Vector4 Data4[]{
+        {1.0f, 2.0f, 3.0f, 4.0f}, {-3.0f, 0.5f, 1.0f, 2.0f},
+        {0.0f, 1.0f, 0.0f, 0.0f}, {7.5f, -2.0f, 4.0f, -1.0f},
+        {0.25f, 4.0f, -8.0f, 0.5f}, {-1.0f, -1.0f, -1.0f, -1.0f},
+        {3.0f, 0.0f, 2.0f, 6.0f}};
+
+    const Matrix3 Transformation2D = Matrix3::translation({1.0f, -3.0f})*
+        Matrix3::rotation(Deg(35.0f))*Matrix3::scaling({2.0f, 0.5f});
+    const Matrix4 Transformation3D = Matrix4::translation({1.0f, -3.0f, 0.5f})*
+        Matrix4::rotation(Deg(35.0f), Vector3{1.0f, 1.0f, -1.0f}.normalized())*
+        Matrix4::scaling({2.0f, 0.5f, 1.5f});
+
+    Quaternion quaternion(std::size_t i) {
+        return Quaternion::rotation(Deg(Float(i)*25.0f - 40.0f), Data3[i].normalized());
+    }
+
+    DualQuaternion dualQuaternion(std::size_t i) {
+        return DualQuaternion::translation(Data3[(i + 2)%7])*DualQuaternion{quaternion(i)};
+    }
+
+    /* Reference dual quaternion skinning, using quaternion multiplication
+       instead of the expanded formula */
+    Vector3 skinReference(const DualQuaternion* joints, const Vector4ui& ids, const Vector4& weights, const Vector3& point) {
+        Quaternion real = joints[ids[0]].real()*weights[0];
+        Quaternion dual = joints[ids[0]].dual()*weights[0];
+        for(std::size_t k = 1; k != 4; ++k) {
+            const Float sign = Math::dot(joints[ids[0]].real(), joints[ids[k]].real()) < 0.0f ? -1.0f : 1.0f;
+            real += joints[ids[k]].real()*weights[k]*sign;
+            dual += joints[ids[k]].dual()*weights[k]*sign;
+        }
+        const Float length = real.length();
+        real /= length;
+        dual /= length;
+        return real.transformVectorNormalized(point) + (dual*real.conjugated()).vector()*2.0f;
+    }
+
+    /* Three joints and seven points, each influenced by different joints */
+    const Vector4ui JointIds[]{
+        {0, 0, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {2, 1, 0, 0},
+        {0, 1, 2, 0}, {2, 2, 1, 0}, {1, 2, 0, 1}};
+    const Vector4 Weights[]{
+        {1.0f, 0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f, 0.0f},
+        {0.5f, 0.5f, 0.0f, 0.0f}, {0.75f, 0.25f, 0.0f, 0.0f},
+        {0.25f, 0.25f, 0.5f, 0.0f}, {0.2f, 0.3f, 0.5f, 0.0f},
+        {0.1f, 0.2f, 0.3f, 0.4f}};
+}
+
+BatchTest::BatchTest() {
+    addTests({&BatchTest::transformPoints3D,
+              &BatchTest::transformPoints2D,
+              &BatchTest::transformVectors3D,
+              &BatchTest::transformVectors2D,
+              &BatchTest::transformInPlace,
+              &BatchTest::multiply,
+              &BatchTest::multiplyCommon,
+              &BatchTest::dot,
+              &BatchTest::normalize,
+              &BatchTest::lerp,
+              &BatchTest::bezierValues2D,
+              &BatchTest::bezierValues3D,
+              &BatchTest::lerpQuaternion,
+              &BatchTest::slerpQuaternion,
+              &BatchTest::sclerpDualQuaternion,
+              &BatchTest::skin,
+              &BatchTest::skinNormals,
+              &BatchTest::skinShortestPath,
+
+              &BatchTest::wrongSize,
+              &BatchTest::notNormalized});
+}
+
+void BatchTest::transformPoints3D() {
+    Vector3 out[7];
+    Math::transformPoints(Transformation3D, arrayView(Data3), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Transformation3D.transformPoint(Data3[i]));
+}
+
+void BatchTest::transformPoints2D() {
+    Vector2 out[7];
+    Math::transformPoints(Transformation2D, arrayView(Data2), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Transformation2D.transformPoint(Data2[i]));
+}
+
+void BatchTest::transformVectors3D() {
+    Vector3 out[7];
+    Math::transformVectors(Transformation3D, arrayView(Data3), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Transformation3D.transformVector(Data3[i]));
+}
+
+void BatchTest::transformVectors2D() {
+    Vector2 out[7];
+    Math::transformVectors(Transformation2D, arrayView(Data2), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Transformation2D.transformVector(Data2[i]));
+}
+
+void BatchTest::transformInPlace() {
+    Vector3 data[7];
+    std::copy(std::begin(Data3), std::end(Data3), data);
+    Math::transformPoints(Transformation3D, arrayView(data), arrayView(data));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(data[i], Transformation3D.transformPoint(Data3[i]));
+}
+
+void BatchTest::multiply() {
+    Matrix4 a[7];
+    Matrix4 b[7];
+    for(std::size_t i = 0; i != 7; ++i) {
+        a[i] = Matrix4::translation(Data3[i])*Transformation3D;
+        b[i] = Matrix4::rotationX(Deg(15.0f*i))*Matrix4::scaling(Data3[6 - i]);
+    }
+
+    Matrix4 out[7];
+    Math::multiply(arrayView(a), arrayView(b), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], a[i]*b[i]);
+
+    Matrix3 a2[3]{Transformation2D, Matrix3::translation(Data2[1]), {}};
+    Matrix3 b2[3]{Matrix3::rotation(Deg(15.0f)), Transformation2D, Matrix3::scaling(Data2[3])};
+    Matrix3 out2[3];
+    Math::multiply(arrayView(a2), arrayView(b2), arrayView(out2));
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(out2[i], a2[i]*b2[i]);
+}
+
+void BatchTest::multiplyCommon() {
+    Matrix4 b[7];
+    for(std::size_t i = 0; i != 7; ++i)
+        b[i] = Matrix4::translation(Data3[i])*Matrix4::rotationX(Deg(15.0f*i));
+
+    Matrix4 out[7];
+    Math::multiply(Transformation3D, arrayView(b), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Transformation3D*b[i]);
+
+    /* In-place */
+    Math::multiply(Transformation3D, arrayView(b), arrayView(b));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(b[i], out[i]);
+
+    Matrix3 b2[3]{Matrix3::rotation(Deg(15.0f)), Transformation2D, Matrix3::scaling(Data2[3])};
+    Matrix3 out2[3];
+    Math::multiply(Transformation2D, arrayView(b2), arrayView(out2));
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(out2[i], Transformation2D*b2[i]);
+}
+
+void BatchTest::dot() {
+    Float out[7];
+
+    Math::dot(arrayView(Data2), arrayView(Data2), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Data2[i].dot());
+
+    Math::dot(arrayView(Data3), arrayView(Data3), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Data3[i].dot());
+
+    Math::dot(arrayView(Data4), arrayView(Data4), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Data4[i].dot());
+}
+
+void BatchTest::normalize() {
+    Vector2 out2[7];
+    Math::normalize(arrayView(Data2), arrayView(out2));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out2[i], Data2[i].normalized());
+
+    Vector3 out3[7];
+    Math::normalize(arrayView(Data3), arrayView(out3));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out3[i], Data3[i].normalized());
+
+    Vector4 out4[7];
+    Math::normalize(arrayView(Data4), arrayView(out4));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out4[i], Data4[i].normalized());
+}
+
+void BatchTest::lerp() {
+    Vector2 out2[6];
+    Math::lerp(arrayView(Data2, 6), arrayView(Data2 + 1, 6), 0.25f, arrayView(out2));
+    for(std::size_t i = 0; i != 6; ++i)
+        CORRADE_COMPARE(out2[i], Math::lerp(Data2[i], Data2[i + 1], 0.25f));
+
+    Vector3 out3[6];
+    Math::lerp(arrayView(Data3, 6), arrayView(Data3 + 1, 6), 0.25f, arrayView(out3));
+    for(std::size_t i = 0; i != 6; ++i)
+        CORRADE_COMPARE(out3[i], Math::lerp(Data3[i], Data3[i + 1], 0.25f));
+
+    Vector4 out4[6];
+    Math::lerp(arrayView(Data4, 6), arrayView(Data4 + 1, 6), 0.25f, arrayView(out4));
+    for(std::size_t i = 0; i != 6; ++i)
+        CORRADE_COMPARE(out4[i], Math::lerp(Data4[i], Data4[i + 1], 0.25f));
+}
+
+void BatchTest::bezierValues2D() {
+    QuadraticBezier2D<Float> curves[7];
+    Float t[7];
+    for(std::size_t i = 0; i != 7; ++i) {
+        curves[i] = {Data2[i], Data2[(i + 1)%7], Data2[(i + 3)%7]};
+        t[i] = Float(i)/6.0f;
+    }
+
+    Vector2 out[7];
+    Math::bezierValues(arrayView(curves), arrayView(t), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], curves[i].value(t[i]));
+}
+
+void BatchTest::bezierValues3D() {
+    CubicBezier3D<Float> curves[7];
+    Float t[7];
+    for(std::size_t i = 0; i != 7; ++i) {
+        curves[i] = {Data3[i], Data3[(i + 1)%7], Data3[(i + 3)%7], Data3[(i + 5)%7]};
+        t[i] = Float(i)/6.0f;
+    }
+
+    Vector3 out[7];
+    Math::bezierValues(arrayView(curves), arrayView(t), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], curves[i].value(t[i]));
+}
+
+void BatchTest::lerpQuaternion() {
+    Quaternion a[7], b[7];
+    for(std::size_t i = 0; i != 7; ++i) {
+        a[i] = quaternion(i);
+        b[i] = quaternion((i + 3)%7);
+    }
+
+    Quaternion out[7];
+    Math::lerp(arrayView(a), arrayView(b), 0.35f, arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Math::lerp(a[i], b[i], 0.35f));
+}
+
+void BatchTest::slerpQuaternion() {
+    Quaternion a[7], b[7];
+    for(std::size_t i = 0; i != 7; ++i) {
+        a[i] = quaternion(i);
+        b[i] = quaternion((i + 3)%7);
+    }
+
+    /* Degenerate case */
+    b[4] = a[4];
+
+    Quaternion out[7];
+    Math::slerp(arrayView(a), arrayView(b), 0.35f, arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Math::slerp(a[i], b[i], 0.35f));
+}
+
+void BatchTest::sclerpDualQuaternion() {
+    DualQuaternion a[7], b[7];
+    for(std::size_t i = 0; i != 7; ++i) {
+        a[i] = dualQuaternion(i);
+        b[i] = dualQuaternion((i + 3)%7);
+    }
+
+    /* Degenerate case */
+    b[4] = a[4];
+
+    DualQuaternion out[7];
+    Math::sclerp(arrayView(a), arrayView(b), 0.35f, arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Math::sclerp(a[i], b[i], 0.35f));
+}
+
+void BatchTest::skin() {
+    const DualQuaternion joints[]{dualQuaternion(1), dualQuaternion(3), dualQuaternion(5)};
+
+    Vector3 out[7];
+    Math::skin(arrayView(joints), arrayView(JointIds), arrayView(Weights), arrayView(Data3), arrayView(out));
+
+    /* Single joint is the same as transforming by it */
+    CORRADE_COMPARE(out[0], joints[0].transformPointNormalized(Data3[0]));
+    CORRADE_COMPARE(out[1], joints[1].transformPointNormalized(Data3[1]));
+
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], skinReference(joints, JointIds[i], Weights[i], Data3[i]));
+}
+
+void BatchTest::skinNormals() {
+    const DualQuaternion joints[]{dualQuaternion(1), dualQuaternion(3), dualQuaternion(5)};
+    Vector3 normals[7];
+    for(std::size_t i = 0; i != 7; ++i) normals[i] = Data3[(i + 1)%7].normalized();
+
+    Vector3 out[7], outNormals[7], outPoints[7];
+    Math::skin(arrayView(joints), arrayView(JointIds), arrayView(Weights), arrayView(Data3), arrayView(normals), arrayView(out), arrayView(outNormals));
+
+    /* Points are the same as without normals */
+    Math::skin(arrayView(joints), arrayView(JointIds), arrayView(Weights), arrayView(Data3), arrayView(outPoints));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], outPoints[i]);
+
+    /* Normals are only rotated */
+    CORRADE_COMPARE(outNormals[0], joints[0].rotation().transformVectorNormalized(normals[0]));
+    for(std::size_t i = 0; i != 7; ++i) {
+        CORRADE_COMPARE(outNormals[i].length(), 1.0f);
+        CORRADE_COMPARE(outNormals[i], skinReference(joints, JointIds[i], Weights[i], normals[i]) - skinReference(joints, JointIds[i], Weights[i], {}));
+    }
+}
+
+void BatchTest::skinShortestPath() {
+    /* The same transformation, but in the other hemisphere */
+    const DualQuaternion joints[]{dualQuaternion(2), -dualQuaternion(2)};
+
+    Vector4ui ids[5];
+    Vector4 weights[5];
+    for(std::size_t i = 0; i != 5; ++i) {
+        ids[i] = {0, 1, 1, 0};
+        weights[i] = {0.25f, 0.5f, 0.25f, 0.0f};
+    }
+
+    Vector3 out[5];
+    Math::skin(arrayView(joints), arrayView(ids), arrayView(weights), arrayView(Data3, 5), arrayView(out));
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_COMPARE(out[i], joints[0].transformPointNormalized(Data3[i]));
+}
+
+void BatchTest::wrongSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Vector3 points[6];
+    Float dots[6];
+    Math::transformPoints(Transformation3D, arrayView(Data3), arrayView(points));
+    Math::dot(arrayView(Data3), arrayView(Data3), arrayView(dots));
+
+    CORRADE_COMPARE(out.str(),
+        "Math::transformPoints(): output view has wrong size, expected 7 but got 6\n"
+        "Math::dot(): views don't have the same size, expected 7 but got 7 and 6\n");
+}
+
+void BatchTest::notNormalized() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Quaternion a[5], b[5], result[5];
+    DualQuaternion joints[2]{DualQuaternion{}, DualQuaternion{}};
+    Vector4ui ids[]{{0, 1, 2, 0}};
+    Vector4 weights[]{{1.0f, 0.0f, 0.0f, 0.0f}};
+    Vector3 points[1];
+    b[3] = Quaternion{{1.0f, 0.0f, 0.0f}, 1.0f};
+    Math::lerp(arrayView(a), arrayView(b), 0.5f, arrayView(result));
+    Math::skin(arrayView(joints), arrayView(ids), arrayView(weights), arrayView(points), arrayView(points));
+    joints[1] = DualQuaternion{Quaternion{{1.0f, 0.0f, 0.0f}, 1.0f}};
+    ids[0] = {0, 1, 1, 0};
+    Math::skin(arrayView(joints), arrayView(ids), arrayView(weights), arrayView(points), arrayView(points));
+
+    CORRADE_COMPARE(out.str(),
+        "Math::lerp(): quaternions must be normalized\n"
+        "Math::skin(): joint ID out of range for 2 joints at index 0\n"
+        "Math::skin(): joint 1 is not normalized\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::BatchTest)
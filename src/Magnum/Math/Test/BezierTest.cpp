@@ -40,6 +40,9 @@ typedef Math::Bezier<1, 2, Float> LinearBezier2D;
 typedef Math::QuadraticBezier2D<Float> QuadraticBezier2D;
 typedef Math::QuadraticBezier2D<Double> QuadraticBezier2Dd;
 typedef Math::CubicBezier2D<Float> CubicBezier2D;
+typedef Math::Range<2, Float> Range2D;
+
+using Corrade::Containers::arrayView;
 
 struct BezierTest : Corrade::TestSuite::Tester {
     explicit BezierTest();
@@ -61,6 +64,16 @@ struct BezierTest : Corrade::TestSuite::Tester {
     void subdivideQuadratic();
     void subdivideCubic();
 
+    void derivativeQuadratic();
+    void derivativeCubic();
+    void boundsLinear();
+    void boundsQuadratic();
+    void boundsCubic();
+    void boundsHigherOrder();
+    void arcLengths();
+    void arcLengthParameter();
+    void arcLengthParameterCurved();
+
     void debug();
     void configuration();
 };
@@ -83,6 +96,16 @@ BezierTest::BezierTest() {
               &BezierTest::subdivideQuadratic,
               &BezierTest::subdivideCubic,
 
+              &BezierTest::derivativeQuadratic,
+              &BezierTest::derivativeCubic,
+              &BezierTest::boundsLinear,
+              &BezierTest::boundsQuadratic,
+              &BezierTest::boundsCubic,
+              &BezierTest::boundsHigherOrder,
+              &BezierTest::arcLengths,
+              &BezierTest::arcLengthParameter,
+              &BezierTest::arcLengthParameterCurved,
+
               &BezierTest::debug,
               &BezierTest::configuration});
 }
@@ -226,6 +249,106 @@ void BezierTest::subdivideCubic() {
     CORRADE_COMPARE(right, (CubicBezier2D{Vector2{7.10938f, 6.57812f}, Vector2{13.4375f, 8.6875f}, Vector2{16.25f, -2.0f}, Vector2{5.0f, -20.0f}}));
 }
 
+void BezierTest::derivativeQuadratic() {
+    QuadraticBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{10.0f, 15.0f}, Vector2{20.0f, 4.0f}};
+
+    CORRADE_COMPARE(bezier.derivative(), (LinearBezier2D{Vector2{20.0f, 30.0f}, Vector2{20.0f, -22.0f}}));
+}
+
+void BezierTest::derivativeCubic() {
+    CubicBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{10.0f, 15.0f}, Vector2{20.0f, 4.0f}, Vector2{5.0f, -20.0f}};
+
+    QuadraticBezier2D derivative = bezier.derivative();
+    CORRADE_COMPARE(derivative, (QuadraticBezier2D{Vector2{30.0f, 45.0f}, Vector2{30.0f, -33.0f}, Vector2{-45.0f, -72.0f}}));
+
+    /* Tangent at the end points points to the neighbor control points */
+    CORRADE_COMPARE(derivative.value(0.0f), 3.0f*(bezier[1] - bezier[0]));
+    CORRADE_COMPARE(derivative.value(1.0f), 3.0f*(bezier[3] - bezier[2]));
+}
+
+void BezierTest::boundsLinear() {
+    LinearBezier2D bezier{Vector2{0.0f, 4.0f}, Vector2{20.0f, 0.0f}};
+
+    CORRADE_COMPARE(bezier.bounds(), (Range2D{{0.0f, 0.0f}, {20.0f, 4.0f}}));
+}
+
+void BezierTest::boundsQuadratic() {
+    QuadraticBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{10.0f, 15.0f}, Vector2{20.0f, 4.0f}};
+
+    /* Y has a maximum at t = 15/26, tighter than the control point */
+    CORRADE_COMPARE(bezier.bounds(), (Range2D{{0.0f, 0.0f}, {20.0f, 8.65385f}}));
+}
+
+void BezierTest::boundsCubic() {
+    CubicBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{10.0f, 15.0f}, Vector2{20.0f, 4.0f}, Vector2{5.0f, -20.0f}};
+
+    /* Maximum of both X and Y is inside the curve */
+    CORRADE_COMPARE(bezier.bounds(), (Range2D{{0.0f, -20.0f}, {12.6491f, 6.84205f}}));
+
+    /* Degenerate case with a linear derivative */
+    CubicBezier2D degenerate{Vector2{0.0f, 0.0f}, Vector2{1.0f, 3.0f}, Vector2{2.0f, 3.0f}, Vector2{3.0f, 0.0f}};
+    CORRADE_COMPARE(degenerate.bounds(), (Range2D{{0.0f, 0.0f}, {3.0f, 2.25f}}));
+}
+
+void BezierTest::boundsHigherOrder() {
+    Bezier<4, 2, Float> bezier{Vector2{0.0f, 0.0f}, Vector2{10.0f, 15.0f}, Vector2{20.0f, 4.0f}, Vector2{-5.0f, -20.0f}, Vector2{3.0f, 1.0f}};
+
+    /* Range of control points */
+    CORRADE_COMPARE(bezier.bounds(), (Range2D{{-5.0f, -20.0f}, {20.0f, 15.0f}}));
+}
+
+void BezierTest::arcLengths() {
+    LinearBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{3.0f, 4.0f}};
+
+    Float lengths[5];
+    bezier.arcLengths(lengths);
+    CORRADE_COMPARE(lengths[0], 0.0f);
+    CORRADE_COMPARE(lengths[1], 1.25f);
+    CORRADE_COMPARE(lengths[2], 2.5f);
+    CORRADE_COMPARE(lengths[3], 3.75f);
+    CORRADE_COMPARE(lengths[4], 5.0f);
+
+    /* Quarter-circle approximation, the length gets closer to pi/2 with more
+       samples */
+    CubicBezier2D arc{Vector2{1.0f, 0.0f}, Vector2{1.0f, 0.552285f}, Vector2{0.552285f, 1.0f}, Vector2{0.0f, 1.0f}};
+    Float coarse[3];
+    Float fine[65];
+    arc.arcLengths(coarse);
+    arc.arcLengths(fine);
+    CORRADE_VERIFY(coarse[2] < fine[64]);
+    CORRADE_VERIFY(Math::abs(fine[64] - Constants<Float>::piHalf()) < 0.001f);
+}
+
+void BezierTest::arcLengthParameter() {
+    LinearBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{3.0f, 4.0f}};
+
+    Float lengths[5];
+    bezier.arcLengths(lengths);
+    CORRADE_COMPARE(LinearBezier2D::arcLengthParameter(lengths, 0.0f), 0.0f);
+    CORRADE_COMPARE(LinearBezier2D::arcLengthParameter(lengths, 2.0f), 0.4f);
+    CORRADE_COMPARE(LinearBezier2D::arcLengthParameter(lengths, 3.75f), 0.75f);
+    CORRADE_COMPARE(LinearBezier2D::arcLengthParameter(lengths, 5.0f), 1.0f);
+
+    /* Clamped */
+    CORRADE_COMPARE(LinearBezier2D::arcLengthParameter(lengths, -1.0f), 0.0f);
+    CORRADE_COMPARE(LinearBezier2D::arcLengthParameter(lengths, 7.0f), 1.0f);
+}
+
+void BezierTest::arcLengthParameterCurved() {
+    /* Straight line, but with speed increasing along it, x = 2t + 8t^2 */
+    QuadraticBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{1.0f, 0.0f}, Vector2{10.0f, 0.0f}};
+    CORRADE_VERIFY(Math::abs(bezier.value(0.5f)[0] - 3.0f) < 0.0001f);
+
+    Float lengths[33];
+    bezier.arcLengths(lengths);
+
+    /* Parameter for half the length is not 0.5, but sampling there gives
+       the right point */
+    const Float t = QuadraticBezier2D::arcLengthParameter(lengths, 5.0f);
+    CORRADE_VERIFY(Math::abs(t - 0.675391f) < 0.001f);
+    CORRADE_VERIFY(Math::abs(bezier.value(t)[0] - 5.0f) < 0.01f);
+}
+
 void BezierTest::debug() {
     std::ostringstream out;
     Debug(&out) << CubicBezier2D{Vector2{0.0f, 1.0f}, Vector2{1.5f, -0.3f}, Vector2{2.1f, 0.5f}, Vector2{0.0f, 2.0f}};
@@ -59,6 +59,10 @@ struct ColorTest: Corrade::TestSuite::Tester {
     void hsvOverflow();
     void hsvAlpha();
 
+    void srgb();
+    void srgbIntegral();
+    void srgbAlpha();
+
     void swizzleType();
     void debug();
     void configuration();
@@ -102,6 +106,10 @@ ColorTest::ColorTest() {
               &ColorTest::hsvOverflow,
               &ColorTest::hsvAlpha,
 
+              &ColorTest::srgb,
+              &ColorTest::srgbIntegral,
+              &ColorTest::srgbAlpha,
+
               &ColorTest::swizzleType,
               &ColorTest::debug,
               &ColorTest::configuration});
@@ -357,6 +365,40 @@ void ColorTest::hsvAlpha() {
     CORRADE_COMPARE(Color4ub::fromHSV(230.0_degf, 0.749f, 0.427f), Color4ub(27, 40, 108, 255));
 }
 
+void ColorTest::srgb() {
+    CORRADE_COMPARE(Color3::fromSrgb({0.0f, 0.5f, 1.0f}), (Color3{0.0f, 0.214041f, 1.0f}));
+    CORRADE_COMPARE((Color3{0.0f, 0.214041f, 1.0f}).toSrgb(), (Vector3{0.0f, 0.5f, 1.0f}));
+
+    /* Linear part of the curve */
+    CORRADE_COMPARE(Color3::fromSrgb({0.02f, 0.0f, 0.04f}), (Color3{0.00154799f, 0.0f, 0.00309598f}));
+    CORRADE_COMPARE((Color3{0.00154799f, 0.0f, 0.00309598f}).toSrgb(), (Vector3{0.02f, 0.0f, 0.04f}));
+
+    /* Integral color types */
+    CORRADE_COMPARE(Color3ub::fromSrgb({0.0f, 0.5f, 1.0f}), (Color3ub{0, 54, 255}));
+    CORRADE_COMPARE((Color3ub{0, 54, 255}).toSrgb(), (Vector3{0.0f, 0.497533f, 1.0f}));
+}
+
+void ColorTest::srgbIntegral() {
+    CORRADE_COMPARE(Color3::fromSrgb(Math::Vector3<UnsignedByte>{0x33, 0xb2, 0x7f}), (Color3{0.0331048f, 0.445201f, 0.212231f}));
+    CORRADE_COMPARE(Color3::fromSrgb(0x33b27f_rgb), (Color3{0.0331048f, 0.445201f, 0.212231f}));
+
+    /* Rounded, not truncated */
+    CORRADE_COMPARE((Color3{0.0331048f, 0.445201f, 0.212231f}).toSrgb<UnsignedByte>(), (Math::Vector3<UnsignedByte>{0x33, 0xb2, 0x7f}));
+    CORRADE_COMPARE((Color3{0.0331f, 0.4452f, 0.2122f}).toSrgb<UnsignedByte>(), (Math::Vector3<UnsignedByte>{0x33, 0xb2, 0x7f}));
+}
+
+void ColorTest::srgbAlpha() {
+    CORRADE_COMPARE(Color4::fromSrgbAlpha({0.0f, 0.5f, 1.0f, 0.25f}), (Color4{0.0f, 0.214041f, 1.0f, 0.25f}));
+    CORRADE_COMPARE(Color4::fromSrgb({0.0f, 0.5f, 1.0f}, 0.25f), (Color4{0.0f, 0.214041f, 1.0f, 0.25f}));
+    CORRADE_COMPARE(Color4::fromSrgb({0.0f, 0.5f, 1.0f}), (Color4{0.0f, 0.214041f, 1.0f, 1.0f}));
+    CORRADE_COMPARE((Color4{0.0f, 0.214041f, 1.0f, 0.25f}).toSrgbAlpha(), (Vector4{0.0f, 0.5f, 1.0f, 0.25f}));
+
+    /* Integral types, alpha is kept linear */
+    CORRADE_COMPARE(Color4::fromSrgbAlpha(0x33b27f80_rgba), (Color4{0.0331048f, 0.445201f, 0.212231f, 0.501961f}));
+    CORRADE_COMPARE((Color4{0.0331048f, 0.445201f, 0.212231f, 0.501961f}).toSrgbAlpha<UnsignedByte>(), (Math::Vector4<UnsignedByte>{0x33, 0xb2, 0x7f, 0x80}));
+    CORRADE_COMPARE(Color4ub::fromSrgbAlpha({0.0f, 0.5f, 1.0f, 0.25f}), (Color4ub{0, 54, 255, 63}));
+}
+
 void ColorTest::swizzleType() {
     constexpr Color3 origColor3;
     constexpr Color4ub origColor4;
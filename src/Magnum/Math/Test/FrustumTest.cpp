@@ -0,0 +1,185 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Frustum.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct FrustumTest: Corrade::TestSuite::Tester {
+    explicit FrustumTest();
+
+    void construct();
+    void constructDefault();
+    void constructConversion();
+    void constructCopy();
+    void fromMatrix();
+
+    void data();
+    void compare();
+
+    void debug();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Frustum<Float> Frustum;
+typedef Math::Frustum<Double> Frustumd;
+
+FrustumTest::FrustumTest() {
+    addTests({&FrustumTest::construct,
+              &FrustumTest::constructDefault,
+              &FrustumTest::constructConversion,
+              &FrustumTest::constructCopy,
+              &FrustumTest::fromMatrix,
+
+              &FrustumTest::data,
+              &FrustumTest::compare,
+
+              &FrustumTest::debug});
+}
+
+void FrustumTest::construct() {
+    const Frustum frustum{
+        {-1.0f, 0.0f, 1.0f, 2.0f},
+        {1.0f, 0.0f, 1.0f, 2.0f},
+        {0.0f, -1.0f, 1.0f, 2.0f},
+        {0.0f, 1.0f, 1.0f, 2.0f},
+        {0.0f, 0.0f, -1.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f, 0.0f}};
+
+    CORRADE_COMPARE(frustum.left(), (Vector4{-1.0f, 0.0f, 1.0f, 2.0f}));
+    CORRADE_COMPARE(frustum.right(), (Vector4{1.0f, 0.0f, 1.0f, 2.0f}));
+    CORRADE_COMPARE(frustum.bottom(), (Vector4{0.0f, -1.0f, 1.0f, 2.0f}));
+    CORRADE_COMPARE(frustum.top(), (Vector4{0.0f, 1.0f, 1.0f, 2.0f}));
+    CORRADE_COMPARE(frustum.near(), (Vector4{0.0f, 0.0f, -1.0f, 1.0f}));
+    CORRADE_COMPARE(frustum.far(), (Vector4{0.0f, 0.0f, 1.0f, 0.0f}));
+}
+
+void FrustumTest::constructDefault() {
+    const Frustum frustum;
+
+    CORRADE_COMPARE(frustum, Frustum::fromMatrix(Matrix4{}));
+    CORRADE_COMPARE(frustum.left(), (Vector4{1.0f, 0.0f, 0.0f, 1.0f}));
+    CORRADE_COMPARE(frustum.far(), (Vector4{0.0f, 0.0f, -1.0f, 1.0f}));
+}
+
+void FrustumTest::constructConversion() {
+    const Frustumd a{
+        {-1.0, 0.0, 1.0, 2.0},
+        {1.0, 0.0, 1.0, 2.0},
+        {0.0, -1.0, 1.0, 2.0},
+        {0.0, 1.0, 1.0, 2.0},
+        {0.0, 0.0, -1.0, 1.0},
+        {0.0, 0.0, 1.0, 0.0}};
+    const Frustum b{a};
+
+    CORRADE_COMPARE(b, (Frustum{
+        {-1.0f, 0.0f, 1.0f, 2.0f},
+        {1.0f, 0.0f, 1.0f, 2.0f},
+        {0.0f, -1.0f, 1.0f, 2.0f},
+        {0.0f, 1.0f, 1.0f, 2.0f},
+        {0.0f, 0.0f, -1.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f, 0.0f}}));
+
+    /* Implicit conversion is not allowed */
+    CORRADE_VERIFY(!(std::is_convertible<Frustumd, Frustum>::value));
+}
+
+void FrustumTest::constructCopy() {
+    const Frustum a{
+        {-1.0f, 0.0f, 1.0f, 2.0f},
+        {1.0f, 0.0f, 1.0f, 2.0f},
+        {0.0f, -1.0f, 1.0f, 2.0f},
+        {0.0f, 1.0f, 1.0f, 2.0f},
+        {0.0f, 0.0f, -1.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f, 0.0f}};
+    const Frustum b{a};
+
+    CORRADE_COMPARE(b, a);
+}
+
+void FrustumTest::fromMatrix() {
+    /* 90° field of view, so the side planes are at 45° */
+    const Frustum frustum = Frustum::fromMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f));
+    const Float s = Constants<Float>::sqrt2()/2.0f;
+
+    CORRADE_COMPARE(frustum.left(), (Vector4{s, 0.0f, -s, 0.0f}));
+    CORRADE_COMPARE(frustum.right(), (Vector4{-s, 0.0f, -s, 0.0f}));
+    CORRADE_COMPARE(frustum.bottom(), (Vector4{0.0f, s, -s, 0.0f}));
+    CORRADE_COMPARE(frustum.top(), (Vector4{0.0f, -s, -s, 0.0f}));
+    CORRADE_COMPARE(frustum.near(), (Vector4{0.0f, 0.0f, -1.0f, -1.0f}));
+    CORRADE_COMPARE(frustum.far(), (Vector4{0.0f, 0.0f, 1.0f, 100.0f}));
+
+    /* Transformed camera, the planes move with it */
+    const Frustum transformed = Frustum::fromMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f)*Matrix4::translation({0.0f, 0.0f, 5.0f}));
+    CORRADE_COMPARE(transformed.near(), (Vector4{0.0f, 0.0f, -1.0f, -6.0f}));
+    CORRADE_COMPARE(transformed.far(), (Vector4{0.0f, 0.0f, 1.0f, 105.0f}));
+}
+
+void FrustumTest::data() {
+    Frustum frustum;
+    frustum[1] = {-1.0f, 0.0f, 0.0f, 3.0f};
+    frustum.top().w() = 5.0f;
+
+    CORRADE_COMPARE(frustum.right(), (Vector4{-1.0f, 0.0f, 0.0f, 3.0f}));
+    CORRADE_COMPARE(frustum[3], (Vector4{0.0f, -1.0f, 0.0f, 5.0f}));
+    CORRADE_COMPARE(frustum.data()[4], -1.0f);
+    CORRADE_COMPARE(frustum.data()[7], 3.0f);
+
+    constexpr Frustum cfrustum;
+    constexpr Vector4 near = cfrustum.near();
+    constexpr Vector4 far = cfrustum[5];
+    CORRADE_COMPARE(near, (Vector4{0.0f, 0.0f, 1.0f, 1.0f}));
+    CORRADE_COMPARE(far, (Vector4{0.0f, 0.0f, -1.0f, 1.0f}));
+}
+
+void FrustumTest::compare() {
+    const Frustum a;
+    Frustum b;
+    CORRADE_VERIFY(a == b);
+
+    b.near().w() = 0.5f;
+    CORRADE_VERIFY(a != b);
+}
+
+void FrustumTest::debug() {
+    std::ostringstream o;
+    Debug(&o) << Frustum{};
+    CORRADE_COMPARE(o.str(), "Frustum({1, 0, 0, 1},\n"
+                             "        {-1, 0, 0, 1},\n"
+                             "        {0, 1, 0, 1},\n"
+                             "        {0, -1, 0, 1},\n"
+                             "        {0, 0, 1, 1},\n"
+                             "        {0, 0, -1, 1})\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::FrustumTest)
@@ -0,0 +1,184 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct MatrixBenchmark: Corrade::TestSuite::Tester {
+    explicit MatrixBenchmark();
+
+    void multiply3();
+    void multiply4();
+    void transformPoint4();
+
+    void determinant3();
+    void determinant4();
+
+    void invert3();
+    void invert4();
+    void invert4Double();
+    void invertRigid3();
+    void invertRigid4();
+};
+
+typedef Math::Matrix3<Float> Matrix3;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Matrix4<Double> Matrix4d;
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector3<Double> Vector3d;
+
+namespace {
+    enum: std::size_t { Repeats = 100000 };
+
+    const Matrix3 Data3 = Matrix3::translation({1.0f, -3.0f})*
+                          Matrix3::rotation(Rad<Float>{0.3f});
+    const Matrix4 Data4 = Matrix4::translation({1.0f, -3.0f, 0.5f})*
+                          Matrix4::rotation(Rad<Float>{0.3f}, Vector3{1.0f, 1.0f, -1.0f}.normalized());
+    const Matrix4d Data4d = Matrix4d::translation({1.0, -3.0, 0.5})*
+                            Matrix4d::rotation(Rad<Double>{0.3}, Vector3d{1.0, 1.0, -1.0}.normalized());
+}
+
+MatrixBenchmark::MatrixBenchmark() {
+    addBenchmarks({&MatrixBenchmark::multiply3,
+                   &MatrixBenchmark::multiply4,
+                   &MatrixBenchmark::transformPoint4,
+
+                   &MatrixBenchmark::determinant3,
+                   &MatrixBenchmark::determinant4,
+
+                   &MatrixBenchmark::invert3,
+                   &MatrixBenchmark::invert4,
+                   &MatrixBenchmark::invert4Double,
+                   &MatrixBenchmark::invertRigid3,
+                   &MatrixBenchmark::invertRigid4}, 10);
+}
+
+/* The results are always fed back as an input to avoid the compiler
+   optimizing the whole loop away. The repeated operations accumulate
+   rounding errors, so the final check only verifies that the value was
+   used. */
+
+void MatrixBenchmark::multiply3() {
+    Matrix3 a = Data3;
+    CORRADE_BENCHMARK(Repeats) {
+        a = a*Data3;
+    }
+
+    CORRADE_VERIFY(a.toVector().sum() != 0.0f);
+}
+
+void MatrixBenchmark::multiply4() {
+    Matrix4 a = Data4;
+    CORRADE_BENCHMARK(Repeats) {
+        a = a*Data4;
+    }
+
+    CORRADE_VERIFY(a.toVector().sum() != 0.0f);
+}
+
+void MatrixBenchmark::transformPoint4() {
+    Vector3 a{1.0f, 2.0f, 3.0f};
+    CORRADE_BENCHMARK(Repeats) {
+        a = Data4.transformPoint(a);
+    }
+
+    CORRADE_VERIFY(a.sum() != 0.0f);
+}
+
+void MatrixBenchmark::determinant3() {
+    /* The determinant of a rigid transformation is 1, so this is a fixed
+       point */
+    Matrix3 a = Data3;
+    CORRADE_BENCHMARK(Repeats) {
+        a[2][2] = a.determinant();
+    }
+
+    CORRADE_COMPARE(a[2][2], 1.0f);
+}
+
+void MatrixBenchmark::determinant4() {
+    /* The determinant of a rigid transformation is 1, so this is a fixed
+       point */
+    Matrix4 a = Data4;
+    CORRADE_BENCHMARK(Repeats) {
+        a[3][3] = a.determinant();
+    }
+
+    CORRADE_COMPARE(a[3][3], 1.0f);
+}
+
+void MatrixBenchmark::invert3() {
+    Matrix3 a = Data3;
+    CORRADE_BENCHMARK(Repeats) {
+        a = a.inverted();
+    }
+
+    CORRADE_VERIFY(a.toVector().sum() != 0.0f);
+}
+
+void MatrixBenchmark::invert4() {
+    Matrix4 a = Data4;
+    CORRADE_BENCHMARK(Repeats) {
+        a = a.inverted();
+    }
+
+    CORRADE_VERIFY(a.toVector().sum() != 0.0f);
+}
+
+void MatrixBenchmark::invert4Double() {
+    Matrix4d a = Data4d;
+    CORRADE_BENCHMARK(Repeats) {
+        a = a.inverted();
+    }
+
+    CORRADE_VERIFY(a.toVector().sum() != 0.0);
+}
+
+void MatrixBenchmark::invertRigid3() {
+    Matrix3 a = Data3;
+    CORRADE_BENCHMARK(Repeats) {
+        a = a.invertedRigid();
+    }
+
+    CORRADE_VERIFY(a.toVector().sum() != 0.0f);
+}
+
+void MatrixBenchmark::invertRigid4() {
+    Matrix4 a = Data4;
+    CORRADE_BENCHMARK(Repeats) {
+        a = a.invertedRigid();
+    }
+
+    CORRADE_VERIFY(a.toVector().sum() != 0.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::MatrixBenchmark)
@@ -71,8 +71,13 @@ struct MatrixTest: Corrade::TestSuite::Tester {
 
     void trace();
     void ij();
+    void multiply4();
     void determinant();
+    void determinant3();
+    void determinant4();
     void inverted();
+    void inverted3();
+    void invertedDouble();
     void invertedOrthogonal();
 
     void subclassTypes();
@@ -84,10 +89,14 @@ struct MatrixTest: Corrade::TestSuite::Tester {
 
 typedef Matrix<4, Float> Matrix4x4;
 typedef Matrix<4, Int> Matrix4x4i;
+typedef Matrix<4, Double> Matrix4x4d;
 typedef Matrix<3, Float> Matrix3x3;
+typedef Matrix<3, Int> Matrix3x3i;
 typedef Vector<4, Float> Vector4;
 typedef Vector<4, Int> Vector4i;
+typedef Vector<4, Double> Vector4d;
 typedef Vector<3, Float> Vector3;
+typedef Vector<3, Int> Vector3i;
 typedef Math::Constants<Float> Constants;
 
 MatrixTest::MatrixTest() {
@@ -103,8 +112,13 @@ MatrixTest::MatrixTest() {
 
               &MatrixTest::trace,
               &MatrixTest::ij,
+              &MatrixTest::multiply4,
               &MatrixTest::determinant,
+              &MatrixTest::determinant3,
+              &MatrixTest::determinant4,
               &MatrixTest::inverted,
+              &MatrixTest::inverted3,
+              &MatrixTest::invertedDouble,
               &MatrixTest::invertedOrthogonal,
 
               &MatrixTest::subclassTypes,
@@ -266,6 +280,31 @@ void MatrixTest::ij() {
     CORRADE_COMPARE(original.ij(1, 2), skipped);
 }
 
+void MatrixTest::multiply4() {
+    /* Float 4x4 multiplication has a SIMD-accelerated variant, compare it to
+       the generic integer one */
+    Matrix4x4i a(Vector4i(3,  5, 8, 4),
+                 Vector4i(4,  4, 7, 3),
+                 Vector4i(7, -1, 8, 0),
+                 Vector4i(9,  4, 5, 9));
+    Matrix4x4i b(Vector4i( 1, -2,  0,  3),
+                 Vector4i( 2,  1, -1,  0),
+                 Vector4i( 0,  4,  2, -3),
+                 Vector4i(-1,  0,  5,  2));
+    Vector4i c(2, -1, 3, 1);
+
+    Matrix4x4i expected(Vector4i(22,  9,  9,  25),
+                        Vector4i( 3, 15, 15,  11),
+                        Vector4i( 3,  2, 29, -15),
+                        Vector4i(50, -2, 42,  14));
+    Vector4i expectedVector(32, 7, 38, 14);
+
+    CORRADE_COMPARE(a*b, expected);
+    CORRADE_COMPARE(a*c, expectedVector);
+    CORRADE_COMPARE(Matrix4x4(a)*Matrix4x4(b), Matrix4x4(expected));
+    CORRADE_COMPARE(Matrix4x4(a)*Vector4(c), Vector4(expectedVector));
+}
+
 void MatrixTest::determinant() {
     Matrix<5, Int> m(
         Vector<5, Int>(1, 2, 2, 1,  0),
@@ -278,6 +317,30 @@ void MatrixTest::determinant() {
     CORRADE_COMPARE(m.determinant(), -2);
 }
 
+void MatrixTest::determinant3() {
+    Matrix3x3i m(Vector3i(1, 2,  2),
+                 Vector3i(2, 3, -2),
+                 Vector3i(3, 1,  5));
+
+    CORRADE_COMPARE(m.determinant(), -29);
+}
+
+void MatrixTest::determinant4() {
+    Matrix4x4i m(Vector4i(1, 2, 2,  1),
+                 Vector4i(2, 3, 2, -2),
+                 Vector4i(1, 1, 1,  0),
+                 Vector4i(3, 1, 0,  1));
+
+    CORRADE_COMPARE(m.determinant(), -6);
+
+    Matrix4x4 n(Vector4(3.0f,  5.0f, 8.0f, 4.0f),
+                Vector4(4.0f,  4.0f, 7.0f, 3.0f),
+                Vector4(7.0f, -1.0f, 8.0f, 0.0f),
+                Vector4(9.0f,  4.0f, 5.0f, 9.0f));
+
+    CORRADE_COMPARE(n.determinant(), -412.0f);
+}
+
 void MatrixTest::inverted() {
     Matrix4x4 m(Vector4(3.0f,  5.0f, 8.0f, 4.0f),
                 Vector4(4.0f,  4.0f, 7.0f, 3.0f),
@@ -295,6 +358,38 @@ void MatrixTest::inverted() {
     CORRADE_COMPARE(_inverse*m, Matrix4x4());
 }
 
+void MatrixTest::inverted3() {
+    Matrix3x3 m(Vector3(3.0f,  5.0f, 8.0f),
+                Vector3(4.0f,  4.0f, 7.0f),
+                Vector3(7.0f, -1.0f, 8.0f));
+
+    Matrix3x3 inverse(Vector3(-39/54.0f,  48/54.0f,  -3/54.0f),
+                      Vector3(-17/54.0f,  32/54.0f, -11/54.0f),
+                      Vector3( 32/54.0f, -38/54.0f,   8/54.0f));
+
+    Matrix3x3 _inverse = m.inverted();
+
+    CORRADE_COMPARE(_inverse, inverse);
+    CORRADE_COMPARE(_inverse*m, Matrix3x3());
+}
+
+void MatrixTest::invertedDouble() {
+    /* Float version might take a SIMD path, verify it gives the same result
+       as the scalar one */
+    Matrix4x4d m(Vector4d(3.0,  5.0, 8.0, 4.0),
+                 Vector4d(4.0,  4.0, 7.0, 3.0),
+                 Vector4d(7.0, -1.0, 8.0, 0.0),
+                 Vector4d(9.0,  4.0, 5.0, 9.0));
+
+    Matrix4x4d inverse(Vector4d(-60/103.0,   71/103.0,  -4/103.0,  3/103.0),
+                       Vector4d(-66/103.0,  109/103.0, -25/103.0, -7/103.0),
+                       Vector4d(177/412.0,  -97/206.0,  53/412.0, -7/206.0),
+                       Vector4d(259/412.0, -185/206.0,  31/412.0, 27/206.0));
+
+    CORRADE_COMPARE(m.inverted(), inverse);
+    CORRADE_COMPARE(Matrix4x4(m).inverted(), Matrix4x4(inverse));
+}
+
 void MatrixTest::invertedOrthogonal() {
     std::ostringstream o;
     Error redirectError{&o};
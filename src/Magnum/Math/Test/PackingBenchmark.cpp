@@ -0,0 +1,157 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct PackingBenchmark: Corrade::TestSuite::Tester {
+    explicit PackingBenchmark();
+
+    void halfLoop();
+    void half();
+    void normalizedLoop();
+    void normalized();
+    void srgbLoop();
+    void srgb();
+};
+
+typedef Math::Color3<Float> Color3;
+typedef Math::Color3<UnsignedByte> Color3ub;
+
+namespace {
+    enum: std::size_t {
+        Count = 4096,
+        Repeats = 100
+    };
+
+    Corrade::Containers::Array<Float> floats() {
+        Corrade::Containers::Array<Float> out(Count);
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Float(i%256)/255.0f;
+        return out;
+    }
+
+    Corrade::Containers::Array<Color3> colors() {
+        Corrade::Containers::Array<Color3> out{Count};
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Color3{Float(i%256)/255.0f, Float(i%7)/6.0f, Float(i%3)/2.0f};
+        return out;
+    }
+}
+
+PackingBenchmark::PackingBenchmark() {
+    addBenchmarks({&PackingBenchmark::halfLoop,
+                   &PackingBenchmark::half,
+                   &PackingBenchmark::normalizedLoop,
+                   &PackingBenchmark::normalized,
+                   &PackingBenchmark::srgbLoop,
+                   &PackingBenchmark::srgb}, 10);
+}
+
+/* The *Loop variants are the same operations done using the per-item API for
+   comparison. Each repeat converts the data there and back again, otherwise
+   the compiler could optimize the repeated runs away. */
+
+void PackingBenchmark::halfLoop() {
+    Corrade::Containers::Array<Float> data = floats();
+    Corrade::Containers::Array<UnsignedShort> packed(Count);
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Count; ++i)
+            packed[i] = Math::packHalf(data[i]);
+        for(std::size_t i = 0; i != Count; ++i)
+            data[i] = Math::unpackHalf(packed[i]);
+    }
+
+    CORRADE_COMPARE(data[255], 1.0f);
+}
+
+void PackingBenchmark::half() {
+    Corrade::Containers::Array<Float> data = floats();
+    Corrade::Containers::Array<UnsignedShort> packed(Count);
+    CORRADE_BENCHMARK(Repeats) {
+        Math::packHalf(data, packed);
+        Math::unpackHalf(packed, data);
+    }
+
+    CORRADE_COMPARE(data[255], 1.0f);
+}
+
+void PackingBenchmark::normalizedLoop() {
+    Corrade::Containers::Array<Float> data = floats();
+    Corrade::Containers::Array<UnsignedByte> packed(Count);
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Count; ++i)
+            packed[i] = Math::denormalize<UnsignedByte>(data[i]);
+        for(std::size_t i = 0; i != Count; ++i)
+            data[i] = Math::normalize<Float>(packed[i]);
+    }
+
+    CORRADE_COMPARE(data[255], 1.0f);
+}
+
+void PackingBenchmark::normalized() {
+    Corrade::Containers::Array<Float> data = floats();
+    Corrade::Containers::Array<UnsignedByte> packed(Count);
+    CORRADE_BENCHMARK(Repeats) {
+        Math::denormalize(data, packed);
+        Math::normalize(packed, data);
+    }
+
+    CORRADE_COMPARE(data[255], 1.0f);
+}
+
+void PackingBenchmark::srgbLoop() {
+    Corrade::Containers::Array<Color3> data = colors();
+    Corrade::Containers::Array<Color3ub> packed{Count};
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Count; ++i)
+            packed[i] = Color3ub{data[i].toSrgb<UnsignedByte>()};
+        for(std::size_t i = 0; i != Count; ++i)
+            data[i] = Color3::fromSrgb(packed[i]);
+    }
+
+    CORRADE_COMPARE(data[255].r(), 1.0f);
+}
+
+void PackingBenchmark::srgb() {
+    Corrade::Containers::Array<Color3> data = colors();
+    Corrade::Containers::Array<Color3ub> packed{Count};
+    CORRADE_BENCHMARK(Repeats) {
+        Math::toSrgb(data, packed);
+        Math::fromSrgb(packed, data);
+    }
+
+    CORRADE_COMPARE(data[255].r(), 1.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::PackingBenchmark)
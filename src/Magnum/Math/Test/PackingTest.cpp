@@ -0,0 +1,368 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct PackingTest: Corrade::TestSuite::Tester {
+    explicit PackingTest();
+
+    void packHalf();
+    void unpackHalf();
+    void halfRoundTrip();
+    void halfBatch();
+
+    void normalizeBatch();
+    void denormalizeBatch();
+
+    void packR11G11B10F();
+    void unpackR11G11B10F();
+    void r11g11b10fRoundTrip();
+    void r11g11b10fBatch();
+
+    void packRGB10A2();
+    void unpackRGB10A2();
+    void rgb10a2Batch();
+
+    void fromSrgb();
+    void fromSrgbAlpha();
+    void toSrgb();
+    void toSrgbAlpha();
+    void toSrgbError();
+
+    void wrongSize();
+};
+
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Color3<Float> Color3;
+typedef Math::Color3<UnsignedByte> Color3ub;
+typedef Math::Color4<Float> Color4;
+typedef Math::Color4<UnsignedByte> Color4ub;
+
+using Corrade::Containers::arrayView;
+
+PackingTest::PackingTest() {
+    addTests({&PackingTest::packHalf,
+              &PackingTest::unpackHalf,
+              &PackingTest::halfRoundTrip,
+              &PackingTest::halfBatch,
+
+              &PackingTest::normalizeBatch,
+              &PackingTest::denormalizeBatch,
+
+              &PackingTest::packR11G11B10F,
+              &PackingTest::unpackR11G11B10F,
+              &PackingTest::r11g11b10fRoundTrip,
+              &PackingTest::r11g11b10fBatch,
+
+              &PackingTest::packRGB10A2,
+              &PackingTest::unpackRGB10A2,
+              &PackingTest::rgb10a2Batch,
+
+              &PackingTest::fromSrgb,
+              &PackingTest::fromSrgbAlpha,
+              &PackingTest::toSrgb,
+              &PackingTest::toSrgbAlpha,
+              &PackingTest::toSrgbError,
+
+              &PackingTest::wrongSize});
+}
+
+void PackingTest::packHalf() {
+    CORRADE_COMPARE(Math::packHalf(0.0f), 0x0000);
+    CORRADE_COMPARE(Math::packHalf(-0.0f), 0x8000);
+    CORRADE_COMPARE(Math::packHalf(1.0f), 0x3c00);
+    CORRADE_COMPARE(Math::packHalf(-2.0f), 0xc000);
+    CORRADE_COMPARE(Math::packHalf(0.1f), 0x2e66);
+    CORRADE_COMPARE(Math::packHalf(65504.0f), 0x7bff);
+
+    /* Rounding to nearest even */
+    CORRADE_COMPARE(Math::packHalf(1.0f + 1.0f/2048.0f), 0x3c00);
+    CORRADE_COMPARE(Math::packHalf(1.0f + 3.0f/2048.0f), 0x3c02);
+
+    /* Denormals */
+    CORRADE_COMPARE(Math::packHalf(5.96046448e-8f), 0x0001);
+    CORRADE_COMPARE(Math::packHalf(-6.09755516e-5f), 0x83ff);
+    CORRADE_COMPARE(Math::packHalf(1.0e-8f), 0x0000);
+
+    /* Too large values, infinity, NaN */
+    CORRADE_COMPARE(Math::packHalf(65520.0f), 0x7c00);
+    CORRADE_COMPARE(Math::packHalf(1.0e10f), 0x7c00);
+    CORRADE_COMPARE(Math::packHalf(-Constants<Float>::inf()), 0xfc00);
+    CORRADE_COMPARE(Math::packHalf(Constants<Float>::nan()) & 0x7e00, 0x7e00);
+}
+
+void PackingTest::unpackHalf() {
+    CORRADE_COMPARE(Math::unpackHalf(0x0000), 0.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0x3c00), 1.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0xc000), -2.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0x3555), 0.333251953125f);
+    CORRADE_COMPARE(Math::unpackHalf(0x7bff), 65504.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0x0001), 5.96046448e-8f);
+    CORRADE_COMPARE(Math::unpackHalf(0x7c00), Constants<Float>::inf());
+    CORRADE_COMPARE(Math::unpackHalf(0xfc00), -Constants<Float>::inf());
+    CORRADE_VERIFY(Math::unpackHalf(0x7e00) != Math::unpackHalf(0x7e00));
+}
+
+void PackingTest::halfRoundTrip() {
+    /* All values except NaNs should survive the round trip */
+    for(UnsignedInt i = 0; i != 65536; ++i) {
+        if((i & 0x7c00) == 0x7c00 && (i & 0x03ff)) continue;
+        if(Math::packHalf(Math::unpackHalf(UnsignedShort(i))) != i) {
+            CORRADE_COMPARE(Math::packHalf(Math::unpackHalf(UnsignedShort(i))), i);
+        }
+    }
+}
+
+void PackingTest::halfBatch() {
+    /* 19 values to test both the 8-item blocks and the remainder */
+    const Float values[]{0.0f, -0.0f, 1.0f, -2.0f, 0.1f, 65504.0f,
+        1.0f + 1.0f/2048.0f, 1.0f + 3.0f/2048.0f, 5.96046448e-8f,
+        -6.09755516e-5f, 1.0e-8f, 65520.0f, 1.0e10f, -Constants<Float>::inf(),
+        0.333f, -1234.5f, 3.0e-5f, 7.0f, -0.0001f};
+
+    UnsignedShort packed[19];
+    Math::packHalf(arrayView(values), arrayView(packed));
+    for(std::size_t i = 0; i != 19; ++i)
+        CORRADE_COMPARE(packed[i], Math::packHalf(values[i]));
+
+    Float unpacked[19];
+    Math::unpackHalf(arrayView(packed), arrayView(unpacked));
+    for(std::size_t i = 0; i != 19; ++i)
+        CORRADE_COMPARE(unpacked[i], Math::unpackHalf(packed[i]));
+}
+
+void PackingTest::normalizeBatch() {
+    const UnsignedByte unsignedBytes[]{0, 1, 127, 128, 254, 255, 42};
+    const Byte bytes[]{-128, -127, -1, 0, 1, 126, 127};
+    const UnsignedShort unsignedShorts[]{0, 1, 32767, 32768, 65534, 65535, 1337};
+    const Short shorts[]{-32768, -32767, -1, 0, 1, 32766, 32767};
+    Float out[7];
+
+    Math::normalize(arrayView(unsignedBytes), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Math::normalize<Float>(unsignedBytes[i]));
+
+    Math::normalize(arrayView(bytes), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Math::normalize<Float>(bytes[i]));
+
+    Math::normalize(arrayView(unsignedShorts), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Math::normalize<Float>(unsignedShorts[i]));
+
+    Math::normalize(arrayView(shorts), arrayView(out));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(out[i], Math::normalize<Float>(shorts[i]));
+}
+
+void PackingTest::denormalizeBatch() {
+    const Float unsignedValues[]{0.0f, 0.1f, 0.25f, 0.5f, 0.75f, 0.999f, 1.0f};
+    const Float signedValues[]{-1.0f, -0.5f, -0.1f, 0.0f, 0.25f, 0.999f, 1.0f};
+
+    UnsignedByte unsignedBytes[7];
+    Math::denormalize(arrayView(unsignedValues), arrayView(unsignedBytes));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(unsignedBytes[i], Math::denormalize<UnsignedByte>(unsignedValues[i]));
+
+    Byte bytes[7];
+    Math::denormalize(arrayView(signedValues), arrayView(bytes));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(bytes[i], Math::denormalize<Byte>(signedValues[i]));
+
+    UnsignedShort unsignedShorts[7];
+    Math::denormalize(arrayView(unsignedValues), arrayView(unsignedShorts));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(unsignedShorts[i], Math::denormalize<UnsignedShort>(unsignedValues[i]));
+
+    Short shorts[7];
+    Math::denormalize(arrayView(signedValues), arrayView(shorts));
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(shorts[i], Math::denormalize<Short>(signedValues[i]));
+}
+
+void PackingTest::packR11G11B10F() {
+    CORRADE_COMPARE(Math::packR11G11B10F({1.0f, 0.5f, 2.0f}), 0x801c03c0);
+    CORRADE_COMPARE(Math::packR11G11B10F({0.0f, 0.0f, 0.0f}), 0x00000000);
+
+    /* Negative values are clamped to zero, too large to infinity */
+    CORRADE_COMPARE(Math::packR11G11B10F({-1.0f, 1.0e10f, Constants<Float>::inf()}), 0xf83e0000);
+}
+
+void PackingTest::unpackR11G11B10F() {
+    CORRADE_COMPARE(Math::unpackR11G11B10F(0x801c03c0), (Vector3{1.0f, 0.5f, 2.0f}));
+    CORRADE_COMPARE(Math::unpackR11G11B10F(0xf83e0000), (Vector3{0.0f, Constants<Float>::inf(), Constants<Float>::inf()}));
+}
+
+void PackingTest::r11g11b10fRoundTrip() {
+    /* All non-NaN values of 11-bit and 10-bit floats */
+    for(UnsignedInt i = 0; i <= 0x7c0; ++i) {
+        const UnsignedInt packed = i|(i << 11)|((i >> 1) << 22);
+        if(Math::packR11G11B10F(Math::unpackR11G11B10F(packed)) != packed) {
+            CORRADE_COMPARE(Math::packR11G11B10F(Math::unpackR11G11B10F(packed)), packed);
+        }
+    }
+}
+
+void PackingTest::r11g11b10fBatch() {
+    const Vector3 values[]{{1.0f, 0.5f, 2.0f}, {-1.0f, 1.0e10f, 0.001f},
+                           {65000.0f, 0.3f, 17.0f}};
+    UnsignedInt packed[3];
+    Math::packR11G11B10F(arrayView(values), arrayView(packed));
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(packed[i], Math::packR11G11B10F(values[i]));
+
+    Vector3 unpacked[3];
+    Math::unpackR11G11B10F(arrayView(packed), arrayView(unpacked));
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(unpacked[i], Math::unpackR11G11B10F(packed[i]));
+}
+
+void PackingTest::packRGB10A2() {
+    CORRADE_COMPARE(Math::packRGB10A2({1.0f, 0.0f, 0.5f, 1.0f}), 0xe00003ff);
+
+    /* Values outside of the range are clamped */
+    CORRADE_COMPARE(Math::packRGB10A2({-1.0f, 2.0f, 0.0f, 0.5f}), 0x800ffc00);
+}
+
+void PackingTest::unpackRGB10A2() {
+    CORRADE_COMPARE(Math::unpackRGB10A2(0xe00003ff), (Vector4{1.0f, 0.0f, 0.500489f, 1.0f}));
+    CORRADE_COMPARE(Math::unpackRGB10A2(0x800ffc00), (Vector4{0.0f, 1.0f, 0.0f, 0.666667f}));
+}
+
+void PackingTest::rgb10a2Batch() {
+    /* Five values to test both the four-item blocks and the remainder */
+    const Vector4 values[]{{1.0f, 0.0f, 0.5f, 1.0f}, {-1.0f, 2.0f, 0.0f, 0.5f},
+                           {0.1f, 0.2f, 0.3f, 0.4f}, {0.9f, 0.8f, 0.7f, 0.0f},
+                           {0.25f, 0.75f, 0.333f, 0.667f}};
+    UnsignedInt packed[5];
+    Math::packRGB10A2(arrayView(values), arrayView(packed));
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_COMPARE(packed[i], Math::packRGB10A2(values[i]));
+
+    Vector4 unpacked[5];
+    Math::unpackRGB10A2(arrayView(packed), arrayView(unpacked));
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_COMPARE(unpacked[i], Math::unpackRGB10A2(packed[i]));
+}
+
+void PackingTest::fromSrgb() {
+    Color3ub values[256];
+    for(std::size_t i = 0; i != 256; ++i)
+        values[i] = Color3ub{UnsignedByte(i), UnsignedByte(255 - i), UnsignedByte(i*7)};
+
+    Color3 out[256];
+    Math::fromSrgb(arrayView(values), arrayView(out));
+    for(std::size_t i = 0; i != 256; ++i)
+        CORRADE_COMPARE(out[i], Color3::fromSrgb(values[i]));
+}
+
+void PackingTest::fromSrgbAlpha() {
+    const Color4ub values[]{{0x33, 0xb2, 0x7f, 0x80}, {0, 255, 1, 0}, {254, 3, 128, 255}};
+
+    Color4 out[3];
+    Math::fromSrgbAlpha(arrayView(values), arrayView(out));
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(out[i], Color4::fromSrgbAlpha(values[i]));
+}
+
+void PackingTest::toSrgb() {
+    /* 23 colors to test both the 16-channel blocks and the remainder */
+    Color3 values[23];
+    for(std::size_t i = 0; i != 20; ++i)
+        values[i] = Color3{Float(i)/19.0f, 1.0f - Float(i)/19.0f, Float(i*i)/361.0f};
+    /* Out-of-range values are clamped, NaN is converted to zero */
+    values[20] = Color3{-1.0f, 2.0f, Constants<Float>::nan()};
+    values[21] = Color3{0.0001f, 0.0031308f, 0.5f};
+    values[22] = Color3{0.215861f, 0.0f, 1.0f};
+
+    Color3ub out[23];
+    Math::toSrgb(arrayView(values), arrayView(out));
+    CORRADE_COMPARE(out[20], (Color3ub{0, 255, 0}));
+    CORRADE_COMPARE(out[22], (Color3ub{128, 0, 255}));
+    for(std::size_t i = 0; i != 20; ++i) {
+        const Math::Vector3<UnsignedByte> expected = values[i].toSrgb<UnsignedByte>();
+        for(std::size_t j = 0; j != 3; ++j)
+            CORRADE_VERIFY(Math::abs(Int(out[i][j]) - Int(expected[j])) <= 1);
+    }
+}
+
+void PackingTest::toSrgbAlpha() {
+    const Color4 values[]{{0.0f, 0.5f, 1.0f, 0.25f}, {-1.0f, 2.0f, 0.1f, 2.0f},
+                          {0.215861f, 0.0f, 1.0f, 0.5f}, {0.3f, 0.01f, 0.7f, -1.0f},
+                          {0.215861f, 0.0331048f, 0.445201f, 0.501961f}};
+
+    Color4ub out[5];
+    Math::toSrgbAlpha(arrayView(values), arrayView(out));
+    CORRADE_COMPARE(out[1], (Color4ub{0, 255, 89, 255}));
+    CORRADE_COMPARE(out[2], (Color4ub{128, 0, 255, 128}));
+    CORRADE_COMPARE(out[3], (Color4ub{149, 25, 218, 0}));
+    CORRADE_COMPARE(out[4], (Color4ub{0x80, 0x33, 0xb2, 0x80}));
+}
+
+void PackingTest::toSrgbError() {
+    /* Sample the whole [0, 1] range and verify the documented maximal error.
+       Processing 65536 colors, thus both the vectorized and scalar code is
+       tested. */
+    constexpr std::size_t count = 65536;
+    Corrade::Containers::Array<Color3> values{count};
+    for(std::size_t i = 0; i != count; ++i) {
+        Float value = Float(i*3)/Float(count*3);
+        values[i] = Color3{value, value + 1.0f/Float(count*3), value + 2.0f/Float(count*3)};
+    }
+
+    Corrade::Containers::Array<Color3ub> out{count};
+    Math::toSrgb(values, out);
+
+    Double maxError{};
+    for(std::size_t i = 0; i != count; ++i) for(std::size_t j = 0; j != 3; ++j) {
+        const Double exact = 255.0*Implementation::toSrgb(Double(values[i][j]));
+        maxError = Math::max(maxError, Math::abs(out[i][j] - exact));
+    }
+    CORRADE_VERIFY(maxError < 0.541);
+}
+
+void PackingTest::wrongSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const Float values[3]{};
+    UnsignedShort packed[2];
+    Math::packHalf(arrayView(values), arrayView(packed));
+
+    CORRADE_COMPARE(out.str(), "Math::packHalf(): output view has wrong size, expected 3 but got 2\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::PackingTest)
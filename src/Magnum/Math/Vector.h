@@ -46,6 +46,12 @@
 #include <Corrade/Utility/Macros.h>
 #endif
 
+#ifdef MAGNUM_TARGET_SSE
+#include <xmmintrin.h>
+#elif defined(MAGNUM_TARGET_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace Magnum { namespace Math {
 
 namespace Implementation {
@@ -1360,6 +1366,90 @@ template<std::size_t size, class T> inline T Vector<size, T>::max() const {
     return out;
 }
 
+#ifndef DOXYGEN_GENERATING_OUTPUT
+/* SIMD versions of the above for four-component Float vectors. These are
+   explicit specializations of the member functions, so the class layout (and
+   thus alignment requirements) stay the same as in the generic case and only
+   unaligned loads and stores are used. */
+#ifdef MAGNUM_TARGET_SSE
+template<> inline Vector<4, Float> Vector<4, Float>::operator-() const {
+    Vector<4, Float> out{NoInit};
+    _mm_storeu_ps(out._data, _mm_xor_ps(_mm_loadu_ps(_data), _mm_set1_ps(-0.0f)));
+    return out;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator+=(const Vector<4, Float>& other) {
+    _mm_storeu_ps(_data, _mm_add_ps(_mm_loadu_ps(_data), _mm_loadu_ps(other._data)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator-=(const Vector<4, Float>& other) {
+    _mm_storeu_ps(_data, _mm_sub_ps(_mm_loadu_ps(_data), _mm_loadu_ps(other._data)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator*=(const Float number) {
+    _mm_storeu_ps(_data, _mm_mul_ps(_mm_loadu_ps(_data), _mm_set1_ps(number)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator/=(const Float number) {
+    _mm_storeu_ps(_data, _mm_div_ps(_mm_loadu_ps(_data), _mm_set1_ps(number)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator*=(const Vector<4, Float>& other) {
+    _mm_storeu_ps(_data, _mm_mul_ps(_mm_loadu_ps(_data), _mm_loadu_ps(other._data)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator/=(const Vector<4, Float>& other) {
+    _mm_storeu_ps(_data, _mm_div_ps(_mm_loadu_ps(_data), _mm_loadu_ps(other._data)));
+    return *this;
+}
+#elif defined(MAGNUM_TARGET_NEON)
+template<> inline Vector<4, Float> Vector<4, Float>::operator-() const {
+    Vector<4, Float> out{NoInit};
+    vst1q_f32(out._data, vnegq_f32(vld1q_f32(_data)));
+    return out;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator+=(const Vector<4, Float>& other) {
+    vst1q_f32(_data, vaddq_f32(vld1q_f32(_data), vld1q_f32(other._data)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator-=(const Vector<4, Float>& other) {
+    vst1q_f32(_data, vsubq_f32(vld1q_f32(_data), vld1q_f32(other._data)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator*=(const Float number) {
+    vst1q_f32(_data, vmulq_n_f32(vld1q_f32(_data), number));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator*=(const Vector<4, Float>& other) {
+    vst1q_f32(_data, vmulq_f32(vld1q_f32(_data), vld1q_f32(other._data)));
+    return *this;
+}
+
+/* ARMv7 NEON has only a reciprocal estimate, which is not precise enough, so
+   division uses the generic implementation there */
+#ifdef __aarch64__
+template<> inline Vector<4, Float>& Vector<4, Float>::operator/=(const Float number) {
+    vst1q_f32(_data, vdivq_f32(vld1q_f32(_data), vdupq_n_f32(number)));
+    return *this;
+}
+
+template<> inline Vector<4, Float>& Vector<4, Float>::operator/=(const Vector<4, Float>& other) {
+    vst1q_f32(_data, vdivq_f32(vld1q_f32(_data), vld1q_f32(other._data)));
+    return *this;
+}
+#endif
+#endif
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
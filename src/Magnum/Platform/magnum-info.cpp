@@ -253,6 +253,15 @@ MagnumInfo::MagnumInfo(const Arguments& arguments): Platform::WindowlessApplicat
     #ifdef MAGNUM_BUILD_MULTITHREADED
     Debug() << "    MAGNUM_BUILD_MULTITHREADED";
     #endif
+    #ifdef MAGNUM_BUILD_SIMD
+    Debug() << "    MAGNUM_BUILD_SIMD";
+    #endif
+    #ifdef MAGNUM_TARGET_SSE
+    Debug() << "    MAGNUM_TARGET_SSE";
+    #endif
+    #ifdef MAGNUM_TARGET_NEON
+    Debug() << "    MAGNUM_TARGET_NEON";
+    #endif
     #ifdef MAGNUM_TARGET_GLES
     Debug() << "    MAGNUM_TARGET_GLES";
     #endif
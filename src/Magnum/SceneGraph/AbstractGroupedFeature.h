@@ -79,7 +79,7 @@ template<UnsignedInt dimensions, class Derived, class T> class AbstractGroupedFe
          * Adds the feature to the object and to group, if specified.
          * @see @ref FeatureGroup::add()
          */
-        explicit AbstractGroupedFeature(AbstractObject<dimensions, T>& object, FeatureGroup<dimensions, Derived, T>* group = nullptr): AbstractFeature<dimensions, T>(object), _group(nullptr) {
+        explicit AbstractGroupedFeature(AbstractObject<dimensions, T>& object, FeatureGroup<dimensions, Derived, T>* group = nullptr): AbstractFeature<dimensions, T>(object), _group(nullptr), _groupIndex{} {
             if(group) group->add(static_cast<Derived&>(*this));
         }
 
@@ -105,6 +105,7 @@ template<UnsignedInt dimensions, class Derived, class T> class AbstractGroupedFe
 
     private:
         FeatureGroup<dimensions, Derived, T>* _group;
+        std::size_t _groupIndex;
 };
 
 /**
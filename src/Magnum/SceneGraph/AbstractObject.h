@@ -30,6 +30,7 @@
  */
 
 #include <functional>
+#include <utility>
 #include <vector>
 #include <Corrade/Containers/LinkedList.h>
 
@@ -43,6 +44,18 @@
 
 namespace Magnum { namespace SceneGraph {
 
+namespace Implementation {
+    /* Dirty marks recorded during parallel animation steps instead of being
+       done directly, as marking an object dirty modifies state shared by the
+       whole scene. Each entry is an object and a function marking it dirty,
+       see AnimableGroup::step(). */
+    typedef std::vector<std::pair<void*, void(*)(void*)>> DeferredDirtyMarks;
+
+    /* Where the current thread records the dirty marks, nullptr if objects
+       are marked dirty directly */
+    MAGNUM_SCENEGRAPH_EXPORT DeferredDirtyMarks*& deferredDirtyMarks();
+}
+
 /**
 @brief Base for objects
 
@@ -201,7 +214,22 @@ template<UnsignedInt dimensions, class T> class AbstractObject
          *      when possible.
          */
         std::vector<MatrixType> transformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& initialTransformationMatrix = MatrixType()) const {
-            return doTransformationMatrices(objects, initialTransformationMatrix);
+            std::vector<MatrixType> transformationMatrices;
+            doTransformationMatrices(objects, initialTransformationMatrix, transformationMatrices);
+            return transformationMatrices;
+        }
+
+        /**
+         * @brief Transformation matrices of given set of objects relative to this object into existing storage
+         *
+         * Same as @ref transformationMatrices(), but the result is written
+         * into @p transformationMatrices, reusing its capacity. Together with
+         * scratch storage kept in the @ref Scene, repeated calls for the
+         * same set of objects don't allocate any memory. Used by
+         * @ref Camera::draw().
+         */
+        void transformationMatricesInto(std::vector<MatrixType>& transformationMatrices, const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& initialTransformationMatrix = MatrixType()) const {
+            doTransformationMatrices(objects, initialTransformationMatrix, transformationMatrices);
         }
 
         /*@}*/
@@ -263,6 +291,20 @@ template<UnsignedInt dimensions, class T> class AbstractObject
          */
         void setClean() { doSetClean(); }
 
+        /**
+         * @brief Clean absolute transformations of all dirty objects in the scene
+         *
+         * Equivalent to calling @ref setClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>&)
+         * with all dirty objects in the scene this object is part of. The
+         * scene keeps track of its dirty objects, so the cost is proportional
+         * to count of objects which changed since the last clean and not to
+         * count of all objects in the scene. If the object is not part of
+         * any scene, the function does nothing.
+         * @see @ref scenegraph-features-caching, @ref setDirty(),
+         *      @ref isDirty()
+         */
+        void setSceneClean() { doSetSceneClean(); }
+
         /*@}*/
 
     private:
@@ -271,12 +313,13 @@ template<UnsignedInt dimensions, class T> class AbstractObject
 
         virtual MatrixType doTransformationMatrix() const = 0;
         virtual MatrixType doAbsoluteTransformationMatrix() const = 0;
-        virtual std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& initialTransformationMatrix) const = 0;
+        virtual void doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& initialTransformationMatrix, std::vector<MatrixType>& transformationMatrices) const = 0;
 
         virtual bool doIsDirty() const = 0;
         virtual void doSetDirty() = 0;
         virtual void doSetClean() = 0;
         virtual void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) = 0;
+        virtual void doSetSceneClean() = 0;
 };
 
 /**
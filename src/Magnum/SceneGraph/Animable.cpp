@@ -29,6 +29,21 @@
 
 namespace Magnum { namespace SceneGraph {
 
+namespace Implementation {
+
+namespace {
+    #if !defined(CORRADE_GCC47_COMPATIBILITY) && !defined(CORRADE_TARGET_APPLE)
+    thread_local
+    #else
+    __thread
+    #endif
+    DeferredDirtyMarks* currentDeferredDirtyMarks = nullptr;
+}
+
+DeferredDirtyMarks*& deferredDirtyMarks() { return currentDeferredDirtyMarks; }
+
+}
+
 Debug& operator<<(Debug& debug, AnimationState value) {
     switch(value) {
         /* LCOV_EXCL_START */
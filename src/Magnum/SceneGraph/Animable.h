@@ -321,6 +321,10 @@ template<UnsignedInt dimensions, class T> class Animable: public AbstractGrouped
         bool _repeated;
         UnsignedShort _repeatCount;
         UnsignedShort repeats;
+
+        /* Group in which active list the animable is and position in it */
+        AnimableGroup<dimensions, T>* _activeGroup;
+        std::size_t _activeIndex;
 };
 
 /**
@@ -29,16 +29,21 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Animable.h and @ref AnimableGroup.h
  */
 
+#include <algorithm>
+
 #include "Magnum/Timeline.h"
 #include "Magnum/Math/Constants.h"
 #include "Magnum/SceneGraph/AnimableGroup.h"
 #include "Magnum/SceneGraph/Animable.h"
+#include "Magnum/SceneGraph/ThreadPool.h"
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>(object, group), _duration(0.0f), startTime(Constants::inf()), pauseTime(-Constants::inf()), previousState(AnimationState::Stopped), currentState(AnimationState::Stopped), _repeated(false), _repeatCount(0), repeats(0) {}
+template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>(object, group), _duration(0.0f), startTime(Constants::inf()), pauseTime(-Constants::inf()), previousState(AnimationState::Stopped), currentState(AnimationState::Stopped), _repeated(false), _repeatCount(0), repeats(0), _activeGroup(nullptr), _activeIndex(0) {}
 
-template<UnsignedInt dimensions, class T> Animable<dimensions, T>::~Animable() {}
+template<UnsignedInt dimensions, class T> Animable<dimensions, T>::~Animable() {
+    if(_activeGroup) _activeGroup->deactivate(*this);
+}
 
 template<UnsignedInt dimensions, class T> Animable<dimensions, T>& Animable<dimensions, T>::setState(AnimationState state) {
     if(currentState == state) return *this;
@@ -47,9 +52,9 @@ template<UnsignedInt dimensions, class T> Animable<dimensions, T>& Animable<dime
     if(previousState == AnimationState::Stopped && state == AnimationState::Paused)
         return *this;
 
-    /* Wake up the group in case no animations are running */
-    animables()->wakeUp = true;
+    /* Let the group process the state change in next step */
     currentState = state;
+    if(AnimableGroup<dimensions, T>* group = animables()) group->activate(*this);
     return *this;
 }
 
@@ -61,81 +66,238 @@ template<UnsignedInt dimensions, class T> const AnimableGroup<dimensions, T>* An
     return static_cast<const AnimableGroup<dimensions, T>*>(AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>::group());
 }
 
-template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::step(const Float time, const Float delta) {
-    if(!_runningCount && !wakeUp) return;
-    wakeUp = false;
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>::~AnimableGroup() {
+    for(Animable<dimensions, T>* animable: _active)
+        if(animable) animable->_activeGroup = nullptr;
+}
 
-    for(std::size_t i = 0; i != AnimableGroup<dimensions, T>::size(); ++i) {
-        Animable<dimensions, T>& animable = (*this)[i];
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::activate(Animable<dimensions, T>& animable) {
+    if(animable._activeGroup == this) return;
 
-        /* The animation was stopped recently, just decrease count of running
-           animations if the animation was running before */
-        if(animable.previousState != AnimationState::Stopped && animable.currentState == AnimationState::Stopped) {
-            if(animable.previousState == AnimationState::Running)
-                --_runningCount;
-            animable.previousState = AnimationState::Stopped;
-            animable.animationStopped();
-            continue;
+    /* The animable was moved from another group */
+    if(animable._activeGroup) animable._activeGroup->deactivate(animable);
 
-        /* The animation was paused recently, set pause time to previous frame time */
-        } else if(animable.previousState == AnimationState::Running && animable.currentState == AnimationState::Paused) {
-            animable.previousState = AnimationState::Paused;
-            animable.pauseTime = time;
-            --_runningCount;
-            animable.animationPaused();
-            continue;
+    /* Running animable wasn't in the list only if it was moved from another
+       group, count it here */
+    if(animable.previousState == AnimationState::Running) ++_runningCount;
 
-        /* Skip the rest for not running animations */
-        } else if(animable.currentState != AnimationState::Running) {
-            CORRADE_INTERNAL_ASSERT(animable.previousState == animable.currentState);
-            continue;
+    animable._activeGroup = this;
+    animable._activeIndex = _active.size();
+    _active.push_back(&animable);
+}
+
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>& AnimableGroup<dimensions, T>::add(Animable<dimensions, T>& animable) {
+    FeatureGroup<dimensions, Animable<dimensions, T>, T>::add(animable);
+
+    /* Let the next step decide if the animable needs to be processed */
+    activate(animable);
+    return *this;
+}
 
-        /* The animation was started recently, set start time to previous frame
-           time, reset repeat count */
-        } else if(animable.previousState == AnimationState::Stopped) {
-            animable.previousState = AnimationState::Running;
-            animable.startTime = time;
-            animable.repeats = 0;
-            ++_runningCount;
-            animable.animationStarted();
-
-        /* The animation was resumed recently, add pause duration to start time */
-        } else if(animable.previousState == AnimationState::Paused) {
-            animable.previousState = AnimationState::Running;
-            animable.startTime += time - animable.pauseTime;
-            ++_runningCount;
-            animable.animationResumed();
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::deactivate(Animable<dimensions, T>& animable) {
+    CORRADE_INTERNAL_ASSERT(animable._activeGroup == this);
+
+    /* Only mark the entry as removed, as this might get called from inside
+       step() and the list can't be reordered there. It gets removed in next
+       step(). */
+    _active[animable._activeIndex] = nullptr;
+    animable._activeGroup = nullptr;
+    if(animable.previousState == AnimationState::Running) --_runningCount;
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::step(const Float time, const Float delta) {
+    /* In parallel mode the animation steps and callbacks are only recorded
+       here and executed after all state changes are processed */
+    const bool parallel = _threadPool && _threadPool->threadCount() > 1;
+    _deferredSteps.clear();
+    _deferredCallbacks.clear();
+
+    /* Process the animables in the order they are in the group */
+    sortActive(0);
+
+    /* Animables activated while stepping are appended after the ones that
+       were active before. The ones that are after the currently processed
+       animable in the group are merged into the walk, the same as if the
+       whole group was iterated, the others wait for the next step. Animables
+       that are not active anymore are replaced with null, the list gets
+       compacted in the next step. */
+    const std::size_t end = _active.size();
+    std::size_t activated = end, sorted = end;
+    std::size_t lastGroupIndex = 0;
+    for(std::size_t i = 0; i <= end; ++i) {
+        Animable<dimensions, T>* const animable = i != end ? _active[i] : nullptr;
+        if(i != end && (!animable || animable->animables() != this)) {
+            if(animable) stepAnimable(*animable, time, delta, parallel);
+            continue;
         }
 
-        CORRADE_INTERNAL_ASSERT(animable.previousState == AnimationState::Running);
-
-        /* Animation time exceeded duration */
-        if(animable._duration != 0.0f && time-animable.startTime > animable._duration) {
-            /* Not repeated or repeat count exceeded, stop */
-            if(!animable._repeated || animable.repeats+1 == animable._repeatCount) {
-                animable.previousState = AnimationState::Stopped;
-                animable.currentState = AnimationState::Stopped;
-                --_runningCount;
-                animable.animationStopped();
-                continue;
+        /* Process the activated animables that are before this one in the
+           group, or all remaining after the last one */
+        const std::size_t nextGroupIndex = animable ? AnimableGroup<dimensions, T>::groupIndex(*animable) : ~std::size_t{};
+        while(activated != _active.size()) {
+            if(sorted != _active.size()) {
+                sortActive(activated);
+                sorted = _active.size();
             }
 
-            /* Increase repeat count and add duration to startTime */
-            ++animable.repeats;
-            animable.startTime += animable._duration;
+            Animable<dimensions, T>* const next = _active[activated];
+            if(next && next->animables() == this) {
+                const std::size_t groupIndex = AnimableGroup<dimensions, T>::groupIndex(*next);
+                if(groupIndex >= nextGroupIndex) break;
+                ++activated;
+                if(groupIndex <= lastGroupIndex) continue;
+                lastGroupIndex = groupIndex;
+            } else ++activated;
+            if(next) stepAnimable(*next, time, delta, parallel);
         }
 
-        /* Animation is still running, perform animation step */
-        CORRADE_ASSERT(time-animable.startTime >= 0.0f,
-            "SceneGraph::AnimableGroup::step(): animation was started in future - probably wrong time passed", );
-        CORRADE_ASSERT(delta >= 0.0f,
-            "SceneGraph::AnimableGroup::step(): negative delta passed", );
-        animable.animationStep(time - animable.startTime, delta);
+        if(!animable) break;
+        lastGroupIndex = nextGroupIndex;
+        stepAnimable(*animable, time, delta, parallel);
+    }
+
+    if(parallel) {
+        /* Animation steps are independent of each other. Marking objects
+           dirty isn't, as the scene tracks them in a shared list, so each
+           chunk records the objects it moved and they are marked dirty
+           afterwards on this thread, in the same order as serially. */
+        constexpr std::size_t ChunkSize = 32;
+        const std::size_t chunkCount = (_deferredSteps.size() + ChunkSize - 1)/ChunkSize;
+        if(_deferredDirtyMarks.size() < chunkCount) _deferredDirtyMarks.resize(chunkCount);
+        _threadPool->parallelFor(_deferredSteps.size(), ChunkSize, [this, delta](std::size_t begin, std::size_t end) {
+            Implementation::DeferredDirtyMarks*& marks = Implementation::deferredDirtyMarks();
+            Implementation::DeferredDirtyMarks* const previous = marks;
+            marks = &_deferredDirtyMarks[begin/ChunkSize];
+            for(std::size_t i = begin; i != end; ++i)
+                _deferredSteps[i].animable->animationStep(_deferredSteps[i].time, delta);
+            marks = previous;
+        });
+
+        for(std::size_t i = 0; i != chunkCount; ++i) {
+            for(const auto& mark: _deferredDirtyMarks[i])
+                mark.second(mark.first);
+            _deferredDirtyMarks[i].clear();
+        }
+
+        /* Callbacks are called on this thread in the original order */
+        for(const auto& deferredCallback: _deferredCallbacks)
+            (deferredCallback.first->*deferredCallback.second)();
     }
 
     CORRADE_INTERNAL_ASSERT((_runningCount <= AnimableGroup<dimensions, T>::size()));
 }
 
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::sortActive(const std::size_t begin) {
+    /* Drop entries of deactivated animables */
+    std::size_t out = begin;
+    for(std::size_t i = begin; i != _active.size(); ++i)
+        if(_active[i]) _active[out++] = _active[i];
+    _active.resize(out);
+
+    /* Animables activated since last step are at the end and features
+       removed from the group could reorder the rest, sort by the group
+       position only if needed */
+    const auto groupOrder = [](const Animable<dimensions, T>* a, const Animable<dimensions, T>* b) {
+        return AnimableGroup<dimensions, T>::groupIndex(*a) < AnimableGroup<dimensions, T>::groupIndex(*b);
+    };
+    if(!std::is_sorted(_active.begin() + begin, _active.end(), groupOrder))
+        std::sort(_active.begin() + begin, _active.end(), groupOrder);
+
+    for(std::size_t i = begin; i != _active.size(); ++i)
+        _active[i]->_activeIndex = i;
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::stepAnimable(Animable<dimensions, T>& animable, const Float time, const Float delta, const bool parallel) {
+    /* The animable was removed from the group */
+    if(animable.animables() != this) {
+        if(animable.previousState == AnimationState::Running)
+            --_runningCount;
+        dropActive(animable);
+        return;
+    }
+
+    /* The animation was stopped recently, just decrease count of running
+       animations if the animation was running before */
+    if(animable.previousState != AnimationState::Stopped && animable.currentState == AnimationState::Stopped) {
+        if(animable.previousState == AnimationState::Running)
+            --_runningCount;
+        animable.previousState = AnimationState::Stopped;
+        dropActive(animable);
+        callback(parallel, animable, &Animable<dimensions, T>::animationStopped);
+        return;
+
+    /* The animation was paused recently, set pause time to previous frame time */
+    } else if(animable.previousState == AnimationState::Running && animable.currentState == AnimationState::Paused) {
+        animable.previousState = AnimationState::Paused;
+        animable.pauseTime = time;
+        --_runningCount;
+        dropActive(animable);
+        callback(parallel, animable, &Animable<dimensions, T>::animationPaused);
+        return;
+
+    /* Remove not running animations from the list */
+    } else if(animable.currentState != AnimationState::Running) {
+        CORRADE_INTERNAL_ASSERT(animable.previousState == animable.currentState);
+        dropActive(animable);
+        return;
+
+    /* The animation was started recently, set start time to previous frame
+       time, reset repeat count */
+    } else if(animable.previousState == AnimationState::Stopped) {
+        animable.previousState = AnimationState::Running;
+        animable.startTime = time;
+        animable.repeats = 0;
+        ++_runningCount;
+        callback(parallel, animable, &Animable<dimensions, T>::animationStarted);
+
+    /* The animation was resumed recently, add pause duration to start time */
+    } else if(animable.previousState == AnimationState::Paused) {
+        animable.previousState = AnimationState::Running;
+        animable.startTime += time - animable.pauseTime;
+        ++_runningCount;
+        callback(parallel, animable, &Animable<dimensions, T>::animationResumed);
+    }
+
+    CORRADE_INTERNAL_ASSERT(animable.previousState == AnimationState::Running);
+
+    /* Animation time exceeded duration */
+    if(animable._duration != 0.0f && time-animable.startTime > animable._duration) {
+        /* Not repeated or repeat count exceeded, stop */
+        if(!animable._repeated || animable.repeats+1 == animable._repeatCount) {
+            animable.previousState = AnimationState::Stopped;
+            animable.currentState = AnimationState::Stopped;
+            --_runningCount;
+            dropActive(animable);
+            callback(parallel, animable, &Animable<dimensions, T>::animationStopped);
+            return;
+        }
+
+        /* Increase repeat count and add duration to startTime */
+        ++animable.repeats;
+        animable.startTime += animable._duration;
+    }
+
+    /* Animation is still running, perform animation step */
+    CORRADE_ASSERT(time-animable.startTime >= 0.0f,
+        "SceneGraph::AnimableGroup::step(): animation was started in future - probably wrong time passed", );
+    CORRADE_ASSERT(delta >= 0.0f,
+        "SceneGraph::AnimableGroup::step(): negative delta passed", );
+    if(parallel) _deferredSteps.push_back({&animable, time - animable.startTime});
+    else animable.animationStep(time - animable.startTime, delta);
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::dropActive(Animable<dimensions, T>& animable) {
+    /* Unlike deactivate() this doesn't touch the running count, which is
+       updated by the caller */
+    _active[animable._activeIndex] = nullptr;
+    animable._activeGroup = nullptr;
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::callback(const bool deferred, Animable<dimensions, T>& animable, void(Animable<dimensions, T>::*function)()) {
+    if(deferred) _deferredCallbacks.emplace_back(&animable, function);
+    else (animable.*function)();
+}
+
 }}
 
 #endif
@@ -29,6 +29,10 @@
  * @brief Class @ref Magnum::SceneGraph::AnimableGroup, alias @ref Magnum::SceneGraph::BasicAnimableGroup2D, @ref Magnum::SceneGraph::BasicAnimableGroup3D, typedef @ref Magnum::SceneGraph::AnimableGroup2D, @ref Magnum::SceneGraph::AnimableGroup3D
  */
 
+#include <utility>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
 #include "Magnum/SceneGraph/FeatureGroup.h"
 #include "Magnum/SceneGraph/visibility.h"
 
@@ -48,7 +52,9 @@ template<UnsignedInt dimensions, class T> class AnimableGroup: public FeatureGro
         /**
          * @brief Constructor
          */
-        explicit AnimableGroup(): _runningCount(0), wakeUp(false) {}
+        explicit AnimableGroup(): _runningCount(0), _threadPool(nullptr) {}
+
+        ~AnimableGroup();
 
         /**
          * @brief Count of running animations
@@ -57,19 +63,92 @@ template<UnsignedInt dimensions, class T> class AnimableGroup: public FeatureGro
          */
         std::size_t runningCount() const { return _runningCount; }
 
+        /**
+         * @brief Add animable to the group
+         * @return Reference to self (for method chaining)
+         *
+         * Running animation moved from another group continues running in
+         * this group. See @ref FeatureGroup::add() for more information.
+         */
+        AnimableGroup<dimensions, T>& add(Animable<dimensions, T>& animable);
+
+        /** @brief Thread pool used for animation steps */
+        ThreadPool* threadPool() const { return _threadPool; }
+
+        /**
+         * @brief Set thread pool used for animation steps
+         * @return Reference to self (for method chaining)
+         *
+         * If set to a pool with more than one thread, @ref step() calls
+         * @ref Animable::animationStep() of all running animations in
+         * parallel. The implementations are then expected to not depend on
+         * each other. Each of them can transform its own object, but
+         * shouldn't modify other shared state such as the scene hierarchy.
+         * Objects transformed in the steps are marked dirty only after all
+         * steps are done, serially and in the same order as the steps, so
+         * @ref AbstractObject::isDirty() and absolute transformations queried
+         * inside a step don't reflect the changes done in this step yet.
+         * The pool is not owned by the group and has to be alive for as long
+         * as it is set. Set to `nullptr` to do all steps serially. Default is
+         * `nullptr`.
+         * @see @ref step()
+         */
+        AnimableGroup<dimensions, T>& setThreadPool(ThreadPool* pool) {
+            _threadPool = pool;
+            return *this;
+        }
+
         /**
          * @brief Perform animation step
          * @param time      Absolute time (e.g. @ref Timeline::previousFrameTime())
          * @param delta     Time delta for current frame (e.g. @ref Timeline::previousFrameDuration())
          *
-         * If there are no running animations the function does nothing.
+         * Only running animations and animations with changed state are
+         * processed, so the cost doesn't depend on count of stopped or paused
+         * animations in the group. If there are no such animations the
+         * function does nothing. The animables are processed in the order
+         * they are in the group, the same as if the whole group was iterated.
+         * State changes done from inside the animation callbacks are
+         * processed in the same call for animables that are after the
+         * current one in the group, e.g. an animation started from
+         * @ref Animable::animationStopped() of a previous one continues
+         * without a gap. Changes of the current and previous animables are
+         * processed in the next call.
+         *
+         * If a thread pool is set using @ref setThreadPool(), the animation
+         * steps are done in parallel. The state change callbacks such as
+         * @ref Animable::animationStarted() are then called on the calling
+         * thread after all animation steps are done, in the same order as
+         * they would be called serially. Animables shouldn't be destroyed
+         * from these callbacks in that case and state changes done from them
+         * are all processed in the next call.
          * @see @ref runningCount()
          */
         void step(Float time, Float delta);
 
     private:
+        void activate(Animable<dimensions, T>& animable);
+        void deactivate(Animable<dimensions, T>& animable);
+        void sortActive(std::size_t begin);
+        void stepAnimable(Animable<dimensions, T>& animable, Float time, Float delta, bool parallel);
+        void dropActive(Animable<dimensions, T>& animable);
+        void callback(bool deferred, Animable<dimensions, T>& animable, void(Animable<dimensions, T>::*function)());
+
         std::size_t _runningCount;
-        bool wakeUp;
+        ThreadPool* _threadPool;
+
+        /* Running animables and animables with changed state, null entries
+           are removed animables which weren't cleaned up yet */
+        std::vector<Animable<dimensions, T>*> _active;
+
+        /* Work recorded for parallel step, kept to avoid reallocations */
+        struct DeferredStep {
+            Animable<dimensions, T>* animable;
+            Float time;
+        };
+        std::vector<DeferredStep> _deferredSteps;
+        std::vector<std::pair<Animable<dimensions, T>*, void(Animable<dimensions, T>::*)()>> _deferredCallbacks;
+        std::vector<Implementation::DeferredDirtyMarks> _deferredDirtyMarks;
 };
 
 /**
@@ -0,0 +1,81 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Camera.h"
+
+#include <cstring>
+#include <utility>
+
+namespace Magnum { namespace SceneGraph { namespace Implementation {
+
+void radixSort(std::vector<DrawSortItem>& items, std::vector<DrawSortItem>& scratch) {
+    const std::size_t count = items.size();
+    if(count < 2) return;
+    scratch.resize(count);
+
+    /* Histograms of all eight bytes of the key in one pass */
+    std::size_t histograms[8][256]{};
+    for(const DrawSortItem& item: items)
+        for(std::size_t pass = 0; pass != 8; ++pass)
+            ++histograms[pass][(item.key >> 8*pass) & 0xff];
+
+    for(std::size_t pass = 0; pass != 8; ++pass) {
+        std::size_t* const histogram = histograms[pass];
+
+        /* Skip the pass if all keys have the same byte, which is common for
+           the unused upper bits of the key */
+        if(histogram[(items[0].key >> 8*pass) & 0xff] == count) continue;
+
+        /* Convert counts to offsets */
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i != 256; ++i) {
+            const std::size_t histogramCount = histogram[i];
+            histogram[i] = offset;
+            offset += histogramCount;
+        }
+
+        for(const DrawSortItem& item: items)
+            scratch[histogram[(item.key >> 8*pass) & 0xff]++] = item;
+
+        std::swap(items, scratch);
+    }
+}
+
+UnsignedLong drawSortKey(const UnsignedInt key, const bool transparent, Float depth) {
+    /* Bit representation of positive floats has the same ordering as the
+       values, drop the lowest bit to fit into 31 bits */
+    if(!(depth > 0.0f)) depth = 0.0f;
+    UnsignedInt depthBits;
+    std::memcpy(&depthBits, &depth, 4);
+    depthBits >>= 1;
+
+    /* Opaque drawables first, sorted by key and then front-to-back */
+    if(!transparent) return UnsignedLong(key) << 31 | depthBits;
+
+    /* Transparent drawables after, sorted back-to-front and then by key */
+    return 1ull << 63 | UnsignedLong(~depthBits & 0x7fffffffu) << 32 | key;
+}
+
+}}}
@@ -29,6 +29,9 @@
  * @brief Class @ref Magnum::SceneGraph::Camera, enum @ref Magnum::SceneGraph::AspectRatioPolicy, alias @ref Magnum::SceneGraph::BasicCamera2D, @ref Magnum::SceneGraph::BasicCamera3D, typedef @ref Magnum::SceneGraph::Camera2D, @ref Magnum::SceneGraph::Camera3D
  */
 
+#include <functional>
+#include <vector>
+
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/SceneGraph/AbstractFeature.h"
@@ -54,6 +57,17 @@ enum class AspectRatioPolicy: UnsignedByte {
 
 namespace Implementation {
     template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRatioFix(AspectRatioPolicy aspectRatioPolicy, const Math::Vector2<T>& projectionScale, const Vector2i& viewport);
+
+    struct DrawSortItem {
+        UnsignedLong key;
+        UnsignedInt index;
+    };
+
+    /* Stable radix sort by key, the scratch is used as temporary storage so
+       it can be reused between calls */
+    MAGNUM_SCENEGRAPH_EXPORT void radixSort(std::vector<DrawSortItem>& items, std::vector<DrawSortItem>& scratch);
+
+    MAGNUM_SCENEGRAPH_EXPORT UnsignedLong drawSortKey(UnsignedInt key, bool transparent, Float depth);
 }
 
 /**
@@ -235,10 +249,161 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         /**
          * @brief Draw
          *
-         * Draws given group of drawables.
+         * Draws given group of drawables in the order they are in the group.
+         * Drawables with a bounding sphere that is completely outside of the
+         * view volume are culled, see @ref Drawable documentation for more
+         * information. If there are any such drawables, all dirty objects in
+         * the scene are cleaned using @ref AbstractObject::setSceneClean()
+         * first. The spheres are tested in batches before computing the
+         * transformations of the visible drawables.
+         *
+         * If sorting is enabled, the visible drawables are drawn sorted by
+         * @ref Drawable::sortKey() and distance from the camera instead, see
+         * @ref SceneGraph-Drawable-draw-sorting for more information. If
+         * instancing is enabled, consecutive drawables with the same
+         * @ref Drawable::instanceKey() are drawn with a single call to
+         * @ref Drawable::drawInstanced(). Detail levels of visible drawables
+         * are selected before drawing, see @ref SceneGraph-Drawable-lod.
+         *
+         * All temporary memory is kept in the camera and the scene between
+         * draws, so once the count of drawables stops growing, drawing
+         * doesn't do any heap allocations.
+         * @see @ref drawnCount(), @ref culledCount(),
+         *      @ref setSortingEnabled(), @ref setInstancingEnabled()
          */
         virtual void draw(DrawableGroup<dimensions, T>& group);
 
+        /**
+         * @brief Draw drawables from a spatial index
+         *
+         * Draws drawables in given index that intersect the camera view
+         * volume. The index is used for culling instead of testing bounding
+         * spheres of all drawables, the drawables are drawn in unspecified
+         * order unless sorting is enabled. Otherwise the drawing is done the
+         * same way as in @ref draw(DrawableGroup<dimensions, T>&). See
+         * @ref SceneGraph-SpatialIndex-usage for more information.
+         */
+        void draw(DrawableIndex<dimensions, T>& index);
+
+        /**
+         * @brief Whether the drawables are sorted in @ref draw()
+         *
+         * @see @ref setSortingEnabled()
+         */
+        bool isSortingEnabled() const { return _sortingEnabled; }
+
+        /**
+         * @brief Enable or disable sorting of drawables in @ref draw()
+         * @return Reference to self (for method chaining)
+         *
+         * Disabled by default. The drawables are sorted using radix sort,
+         * the memory needed for it is kept between draws.
+         * @see @ref stateChangeCount(), @ref avoidedStateChangeCount()
+         */
+        Camera<dimensions, T>& setSortingEnabled(bool enabled) {
+            _sortingEnabled = enabled;
+            return *this;
+        }
+
+        /**
+         * @brief Whether the drawables are instanced in @ref draw()
+         *
+         * @see @ref setInstancingEnabled()
+         */
+        bool isInstancingEnabled() const { return _instancingEnabled; }
+
+        /**
+         * @brief Enable or disable instancing of drawables in @ref draw()
+         * @return Reference to self (for method chaining)
+         *
+         * Disabled by default. See @ref SceneGraph-Drawable-instancing for
+         * more information.
+         * @see @ref drawCallCount()
+         */
+        Camera<dimensions, T>& setInstancingEnabled(bool enabled) {
+            _instancingEnabled = enabled;
+            return *this;
+        }
+
+        /**
+         * @brief Hysteresis of detail level selection in @ref draw()
+         *
+         * @see @ref setLodHysteresis()
+         */
+        T lodHysteresis() const { return _lodHysteresis; }
+
+        /**
+         * @brief Set hysteresis of detail level selection in @ref draw()
+         * @return Reference to self (for method chaining)
+         *
+         * Drawable switches to a different detail level only if its projected
+         * size crosses the threshold by more than given fraction of the
+         * threshold, e.g. with `0.1` a drawable at level `0` switches to level
+         * `1` only when its size gets below 90% of the first threshold and
+         * back only when it gets above 110% of it. Default is `0`. See
+         * @ref SceneGraph-Drawable-lod for more information.
+         */
+        Camera<dimensions, T>& setLodHysteresis(T hysteresis) {
+            _lodHysteresis = hysteresis;
+            return *this;
+        }
+
+        /**
+         * @brief Count of drawables drawn with given detail level in last @ref draw()
+         *
+         * Drawables without detail levels are counted as level `0`. Returns
+         * `0` for levels that weren't drawn at all.
+         * @see @ref Drawable::lod()
+         */
+        std::size_t lodDrawnCount(UnsignedInt lod) const {
+            return lod < _lodDrawnCounts.size() ? _lodDrawnCounts[lod] : 0;
+        }
+
+        /**
+         * @brief Count of drawables drawn in last @ref draw()
+         *
+         * @see @ref culledCount()
+         */
+        std::size_t drawnCount() const { return _drawnCount; }
+
+        /**
+         * @brief Count of drawables culled in last @ref draw()
+         *
+         * @see @ref drawnCount()
+         */
+        std::size_t culledCount() const { return _culledCount; }
+
+        /**
+         * @brief Count of draw calls in last @ref draw()
+         *
+         * Count of calls to @ref Drawable::draw() and
+         * @ref Drawable::drawInstanced(). Equal to @ref drawnCount() if
+         * instancing is not enabled.
+         * @see @ref setInstancingEnabled()
+         */
+        std::size_t drawCallCount() const { return _drawCallCount; }
+
+        /**
+         * @brief Count of state changes in last @ref draw()
+         *
+         * Count of consecutively drawn drawables with different
+         * @ref Drawable::sortKey(). If the key is composed of IDs of GPU
+         * state, this approximates the count of state binds done when
+         * drawing.
+         * @see @ref avoidedStateChangeCount()
+         */
+        std::size_t stateChangeCount() const { return _stateChangeCount; }
+
+        /**
+         * @brief Count of state changes avoided in last @ref draw()
+         *
+         * Difference between @ref stateChangeCount() when drawing in the
+         * order of the group and when drawing sorted. Zero if sorting is not
+         * enabled.
+         * @see @ref setSortingEnabled()
+         */
+        std::size_t avoidedStateChangeCount() const { return _avoidedStateChangeCount; }
+
     private:
         /** Recalculates camera matrix */
         void cleanInverted(const MatrixTypeFor<dimensions, T>& invertedAbsoluteTransformationMatrix) override {
@@ -246,6 +411,7 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         }
 
         void fixAspectRatio();
+        void drawVisible(AbstractObject<dimensions, T>& scene);
 
         MatrixTypeFor<dimensions, T> _rawProjectionMatrix;
         AspectRatioPolicy _aspectRatioPolicy;
@@ -254,6 +420,19 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         MatrixTypeFor<dimensions, T> _cameraMatrix;
 
         Vector2i _viewport;
+        std::size_t _drawnCount, _culledCount, _stateChangeCount,
+            _avoidedStateChangeCount, _drawCallCount;
+        T _lodHysteresis;
+        bool _sortingEnabled, _instancingEnabled;
+        std::vector<Implementation::DrawSortItem> _sortItems, _sortScratch;
+        std::vector<MatrixTypeFor<dimensions, T>> _instanceTransformations;
+        std::vector<VectorTypeFor<dimensions, T>> _centers;
+        std::vector<T> _radii;
+        std::vector<UnsignedInt> _visibleMask;
+        std::vector<std::reference_wrapper<Drawable<dimensions, T>>> _drawables;
+        std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> _objects;
+        std::vector<MatrixTypeFor<dimensions, T>> _transformations;
+        std::vector<std::size_t> _lodDrawnCounts;
 };
 
 /**
@@ -29,9 +29,15 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Camera.h
  */
 
+#include <algorithm>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Frustum.h"
 #include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Geometry/Intersection.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/SpatialIndex.h"
 
 namespace Magnum { namespace SceneGraph {
 
@@ -53,9 +59,105 @@ template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRat
         Math::Vector2<T>(T(1), relativeAspectRatio.x()/relativeAspectRatio.y()), T(1)));
 }
 
+/* View volume for culling bounding spheres, created from the
+   projection*camera matrix, so the spheres can be tested in scene
+   coordinates */
+template<UnsignedInt dimensions, class T> struct CullingVolume;
+
+template<class T> struct CullingVolume<2, T> {
+    explicit CullingVolume(const Math::Matrix3<T>& m) {
+        /* Normalized lines (a, b, c) of the four sides, a point is inside
+           if ax + by + c >= 0 for all of them */
+        const Math::Vector3<T> lines[]{m.row(2) + m.row(0), m.row(2) - m.row(0),
+                                       m.row(2) + m.row(1), m.row(2) - m.row(1)};
+        for(std::size_t i = 0; i != 4; ++i)
+            _lines[i] = lines[i]/lines[i].xy().length();
+    }
+
+    /* Sets bit i of the mask if sphere i is at least partially inside */
+    void cull(const std::vector<Math::Vector2<T>>& centers, const std::vector<T>& radii, std::vector<UnsignedInt>& visibleMask) const {
+        for(std::size_t i = 0; i != centers.size(); ++i) {
+            bool visible = true;
+            for(const Math::Vector3<T>& line: _lines) if(Math::dot(line.xy(), centers[i]) + line.z() < -radii[i]) {
+                visible = false;
+                break;
+            }
+
+            if(visible) visibleMask[i/32] |= 1u << (i%32);
+        }
+    }
+
+    private:
+        Math::Vector3<T> _lines[4];
+};
+
+template<class T> struct CullingVolume<3, T> {
+    explicit CullingVolume(const Math::Matrix4<T>& m): _frustum{Math::Frustum<T>::fromMatrix(m)} {}
+
+    void cull(const std::vector<Math::Vector3<T>>& centers, const std::vector<T>& radii, std::vector<UnsignedInt>& visibleMask) const {
+        for(std::size_t i = 0; i != centers.size(); ++i)
+            if(Math::Geometry::Intersection::sphereFrustum(centers[i], radii[i], _frustum))
+                visibleMask[i/32] |= 1u << (i%32);
+    }
+
+    private:
+        Math::Frustum<T> _frustum;
+};
+
+/* Distance from the camera used for sorting, there's no depth in 2D */
+template<class T> inline Float drawDepth(const Math::Matrix3<T>&) { return 0.0f; }
+template<class T> inline Float drawDepth(const Math::Matrix4<T>& transformationMatrix) {
+    return Float(-transformationMatrix.translation().z());
+}
+
+/* Diameter of a sphere projected to the screen as a fraction of the viewport
+   height. Infinite if the center is behind the camera. */
+template<class T> inline T projectedSize(const Math::Matrix3<T>& projectionMatrix, const Math::Vector2<T>& center, const T radius) {
+    const T w = Math::dot(projectionMatrix.row(2), Math::Vector3<T>{center, T(1)});
+    return w > T(0) ? radius*Math::abs(projectionMatrix[1].y())/w : Math::Constants<T>::inf();
+}
+template<class T> inline T projectedSize(const Math::Matrix4<T>& projectionMatrix, const Math::Vector3<T>& center, const T radius) {
+    const T w = Math::dot(projectionMatrix.row(3), Math::Vector4<T>{center, T(1)});
+    return w > T(0) ? radius*Math::abs(projectionMatrix[1].y())/w : Math::Constants<T>::inf();
+}
+
+/* Detail level for given projected size. The level changes from the current
+   one only if the size crosses the threshold by more than the hysteresis. */
+template<class T> UnsignedInt selectLod(const Containers::ArrayView<const T> thresholds, UnsignedInt current, const T size, const T hysteresis) {
+    UnsignedInt lod = 0;
+    while(lod != thresholds.size() && size < thresholds[lod]) ++lod;
+
+    while(current < lod && size < thresholds[current]*(T(1) - hysteresis)) ++current;
+    while(current > lod && size > thresholds[current - 1]*(T(1) + hysteresis)) --current;
+    return current;
+}
+
+/* Drawables in the index intersecting the view volume given by the
+   projection and camera matrix */
+template<class T> void queryViewVolume(DrawableIndex<2, T>& index, const Math::Matrix3<T>& matrix, std::vector<std::reference_wrapper<Drawable<2, T>>>& drawables) {
+    /* Bounding box of the view rectangle in scene coordinates */
+    const Math::Matrix3<T> inverted = matrix.inverted();
+    Math::Vector2<T> min{Math::Constants<T>::inf()}, max{-Math::Constants<T>::inf()};
+    for(const Math::Vector2<T>& corner: {Math::Vector2<T>{T(-1), T(-1)}, Math::Vector2<T>{T(1), T(-1)}, Math::Vector2<T>{T(-1), T(1)}, Math::Vector2<T>{T(1), T(1)}}) {
+        const Math::Vector2<T> transformed = inverted.transformPoint(corner);
+        min = Math::min(min, transformed);
+        max = Math::max(max, transformed);
+    }
+
+    index.queryBox({min, max}, drawables);
+}
+template<class T> void queryViewVolume(DrawableIndex<3, T>& index, const Math::Matrix4<T>& matrix, std::vector<std::reference_wrapper<Drawable<3, T>>>& drawables) {
+    index.queryFrustum(Math::Frustum<T>::fromMatrix(matrix), drawables);
+}
+
+/* Float spheres are culled in batches, with SSE if available */
+template<> inline void CullingVolume<3, Float>::cull(const std::vector<Vector3>& centers, const std::vector<Float>& radii, std::vector<UnsignedInt>& visibleMask) const {
+    Math::Geometry::Intersection::sphereFrustumMask({centers.data(), centers.size()}, {radii.data(), radii.size()}, _frustum, {visibleMask.data(), visibleMask.size()});
 }
 
-template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved) {
+}
+
+template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved), _drawnCount{}, _culledCount{}, _stateChangeCount{}, _avoidedStateChangeCount{}, _drawCallCount{}, _lodHysteresis{}, _sortingEnabled{}, _instancingEnabled{} {
     AbstractFeature<dimensions, T>::setCachedTransformations(CachedTransformation::InvertedAbsolute);
 }
 
@@ -86,20 +188,142 @@ template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(Drawa
     AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object().scene();
     CORRADE_ASSERT(scene, "Camera::draw(): cannot draw when camera is not part of any scene", );
 
+    /* Gather bounding spheres of drawables that can be culled. All the
+       temporary storage is kept between draws so drawing doesn't allocate
+       once it reaches a steady state. */
+    _centers.clear();
+    _radii.clear();
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        if(!group[i].hasBoundingSphere()) continue;
+
+        /* The spheres are updated when cleaning the objects, clean all that
+           moved since last time (including the camera) */
+        if(_centers.empty()) AbstractFeature<dimensions, T>::object().setSceneClean();
+
+        _centers.push_back(group[i].absoluteBoundingSphereCenter());
+        _radii.push_back(group[i].absoluteBoundingSphereRadius());
+    }
+
     /* Compute camera matrix */
     AbstractFeature<dimensions, T>::object().setClean();
 
-    /* Compute transformations of all objects in the group relative to the camera */
-    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
-    objects.reserve(group.size());
-    for(std::size_t i = 0; i != group.size(); ++i)
-        objects.push_back(group[i].object());
-    std::vector<MatrixTypeFor<dimensions, T>> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
-
-    /* Perform the drawing */
-    for(std::size_t i = 0; i != transformations.size(); ++i)
-        group[i].draw(transformations[i], *this);
+    /* Cull the spheres against the view volume in scene coordinates */
+    _visibleMask.assign((_centers.size() + 31)/32, 0);
+    if(!_centers.empty())
+        Implementation::CullingVolume<dimensions, T>{_projectionMatrix*_cameraMatrix}.cull(_centers, _radii, _visibleMask);
+
+    /* Compute transformations of all visible objects in the group relative to
+       the camera, keeping the order of the group */
+    std::vector<std::reference_wrapper<Drawable<dimensions, T>>>& drawables = _drawables;
+    drawables.clear();
+    _objects.clear();
+    for(std::size_t i = 0, sphere = 0; i != group.size(); ++i) {
+        if(group[i].hasBoundingSphere() && !(_visibleMask[sphere/32] & (1u << (sphere%32)))) {
+            ++sphere;
+            continue;
+        }
+        if(group[i].hasBoundingSphere()) ++sphere;
+
+        drawables.push_back(group[i]);
+        _objects.push_back(group[i].object());
+    }
+    _drawnCount = drawables.size();
+    _culledCount = group.size() - drawables.size();
+
+    drawVisible(*scene);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableIndex<dimensions, T>& index) {
+    AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object().scene();
+    CORRADE_ASSERT(scene, "Camera::draw(): cannot draw when camera is not part of any scene", );
+
+    /* Compute camera matrix, then let the index find drawables intersecting
+       the view volume. The query cleans all objects that moved since last
+       time, so the drawable bounding spheres are up-to-date as well. */
+    AbstractFeature<dimensions, T>::object().setClean();
+    Implementation::queryViewVolume(index, _projectionMatrix*_cameraMatrix, _drawables);
+
+    _objects.clear();
+    for(Drawable<dimensions, T>& drawable: _drawables)
+        _objects.push_back(drawable.object());
+    _drawnCount = _drawables.size();
+    _culledCount = index.size() - _drawables.size();
+
+    drawVisible(*scene);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::drawVisible(AbstractObject<dimensions, T>& scene) {
+    std::vector<std::reference_wrapper<Drawable<dimensions, T>>>& drawables = _drawables;
+    std::vector<MatrixTypeFor<dimensions, T>>& transformations = _transformations;
+    scene.transformationMatricesInto(transformations, _objects, _cameraMatrix);
+
+    /* Select detail levels of visible drawables in a single pass, using the
+       transformations relative to the camera */
+    std::fill(_lodDrawnCounts.begin(), _lodDrawnCounts.end(), 0);
+    for(std::size_t i = 0; i != drawables.size(); ++i) {
+        Drawable<dimensions, T>& drawable = drawables[i];
+        if(!drawable._lodThresholds.empty() && drawable.hasBoundingSphere()) {
+            const T size = Implementation::projectedSize(_projectionMatrix, transformations[i].transformPoint(drawable.boundingSphereCenter()), drawable.absoluteBoundingSphereRadius());
+            drawable._lod = Implementation::selectLod(drawable.lodThresholds(), drawable._lod, size, _lodHysteresis);
+        }
+
+        if(drawable._lod >= _lodDrawnCounts.size())
+            _lodDrawnCounts.resize(drawable._lod + 1);
+        ++_lodDrawnCounts[drawable._lod];
+    }
+
+    _stateChangeCount = 0;
+    for(std::size_t i = 1; i < drawables.size(); ++i)
+        if(drawables[i].get().sortKey() != drawables[i - 1].get().sortKey())
+            ++_stateChangeCount;
+
+    /* Sort by the key and depth. The sort is stable, so drawables with the
+       same key and depth are still in group order. */
+    _sortItems.resize(drawables.size());
+    if(_sortingEnabled) {
+        for(std::size_t i = 0; i != drawables.size(); ++i) {
+            const Drawable<dimensions, T>& drawable = drawables[i];
+            _sortItems[i] = {Implementation::drawSortKey(drawable.sortKey(), drawable.isTransparent(), Implementation::drawDepth(transformations[i])), UnsignedInt(i)};
+        }
+        Implementation::radixSort(_sortItems, _sortScratch);
+
+        const std::size_t unsortedStateChangeCount = _stateChangeCount;
+        _stateChangeCount = 0;
+        for(std::size_t i = 1; i < _sortItems.size(); ++i)
+            if(drawables[_sortItems[i].index].get().sortKey() != drawables[_sortItems[i - 1].index].get().sortKey())
+                ++_stateChangeCount;
+        _avoidedStateChangeCount = unsortedStateChangeCount > _stateChangeCount ?
+            unsortedStateChangeCount - _stateChangeCount : 0;
+
+    /* Otherwise draw in group order */
+    } else {
+        _avoidedStateChangeCount = 0;
+        for(std::size_t i = 0; i != drawables.size(); ++i)
+            _sortItems[i] = {0, UnsignedInt(i)};
+    }
+
+    /* Perform the drawing. If instancing is enabled, consecutive drawables
+       with the same instance key and detail level are drawn with a single
+       call. */
+    _drawCallCount = 0;
+    for(std::size_t i = 0; i != _sortItems.size(); ++i, ++_drawCallCount) {
+        Drawable<dimensions, T>& drawable = drawables[_sortItems[i].index];
+        const UnsignedLong instanceKey = drawable.instanceKey();
+        std::size_t end = i + 1;
+        if(_instancingEnabled && instanceKey) while(end != _sortItems.size() && drawables[_sortItems[end].index].get().instanceKey() == instanceKey && drawables[_sortItems[end].index].get().lod() == drawable.lod())
+            ++end;
+
+        if(end - i == 1) {
+            drawable.draw(transformations[_sortItems[i].index], *this);
+            continue;
+        }
+
+        _instanceTransformations.clear();
+        for(std::size_t j = i; j != end; ++j)
+            _instanceTransformations.push_back(transformations[_sortItems[j].index]);
+        drawable.drawInstanced({_instanceTransformations.data(), _instanceTransformations.size()}, *this);
+        i = end - 1;
+    }
 }
 
 }}
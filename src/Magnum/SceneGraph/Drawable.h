@@ -29,6 +29,11 @@
  * @brief Class @ref Magnum::SceneGraph::Drawable, @ref Magnum::SceneGraph::DrawableGroup, alias @ref Magnum::SceneGraph::BasicDrawable2D, @ref Magnum::SceneGraph::BasicDrawable3D, @ref Magnum::SceneGraph::BasicDrawableGroup2D, @ref Magnum::SceneGraph::BasicDrawableGroup3D, typedef @ref Magnum::SceneGraph::Drawable2D, @ref Magnum::SceneGraph::Drawable3D, @ref Magnum::SceneGraph::DrawableGroup2D, @ref Magnum::SceneGraph::DrawableGroup3D
  */
 
+#include <initializer_list>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Math/Range.h"
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -155,6 +160,141 @@ void MyApplication::drawEvent() {
 }
 @endcode
 
+## Frustum culling
+
+Drawables which have a bounding sphere set using @ref setBoundingSphere() or
+@ref setBoundingBox() are culled in @ref Camera::draw() --- if the sphere is
+completely outside of the camera frustum, the transformation matrix of the
+drawable isn't computed and @ref draw() isn't called for it. Drawables without
+a bounding sphere are always drawn.
+@code
+(new RedCube(&scene, &drawables))
+    ->setBoundingSphere({}, 1.0f);
+@endcode
+
+The sphere transformed to the scene is cached using
+@ref scenegraph-features-caching "transformation caching", so it is
+recalculated only when the object moves. If you reimplement @ref clean() in a
+subclass, call the implementation of this class from it as well.
+
+@anchor SceneGraph-Drawable-draw-sorting
+## Draw sorting
+
+If sorting is enabled using @ref Camera::setSortingEnabled(), the drawables
+are drawn sorted by @ref sortKey() instead of in the order they are in the
+group, so the drawables sharing the same state can be drawn together. Opaque
+drawables are drawn first, sorted by the key and then front-to-back, which
+makes use of early depth test. Drawables marked using @ref setTransparent()
+are drawn after them back-to-front and only then by the key. How the key is
+formed is up to the application, for example it can be composed of shader,
+material and mesh IDs in decreasing significance:
+@code
+drawable->setSortKey(shaderId << 24 | materialId << 12 | meshId);
+@endcode
+
+@anchor SceneGraph-Drawable-instancing
+## Instancing
+
+Drawables which share the same mesh and shader and differ only in
+transformation can be drawn with a single instanced draw call. Set the same
+nonzero @ref setInstanceKey() for them, for example composed of shader and
+mesh IDs, reimplement @ref drawInstanced() and enable instancing using
+@ref Camera::setInstancingEnabled(). Consecutively drawn drawables with the
+same key are then drawn with single @ref drawInstanced() call on the first of
+them. Combine it with draw sorting with the same key to make sure such
+drawables are drawn consecutively.
+
+In the following example the per-instance transformations are uploaded to a
+@ref BufferRing, which rotates through several buffers and orphans their
+storage, so the driver doesn't need to wait until draws from previous frames
+finish. There is one mesh for each buffer in the ring, differing only in the
+buffer attached using @ref Mesh::addVertexBufferInstanced():
+@code
+struct TreeResources {
+    explicit TreeResources(): instanceBuffers{3} {
+        for(std::size_t i = 0; i != instanceBuffers.count(); ++i) {
+            meshes[i].setPrimitive(MeshPrimitive::Triangles)
+                .setCount(36)
+                .addVertexBuffer(vertices, 0, TreeShader::Position{})
+                .addVertexBufferInstanced(instanceBuffers[i], 1, 0, TreeShader::TransformationMatrix{});
+        }
+    }
+
+    TreeShader shader;
+    Buffer vertices;
+    BufferRing instanceBuffers;
+    Mesh meshes[3];
+};
+
+class Tree: public Object3D, public SceneGraph::Drawable3D {
+    public:
+        explicit Tree(Object3D* parent, SceneGraph::DrawableGroup3D* group, TreeResources& resources): Object3D{parent}, SceneGraph::Drawable3D{*this, group}, _resources(resources) {
+            const UnsignedInt key = _resources.shader.id() << 16 | _resources.vertices.id();
+            setSortKey(key).setInstanceKey(key);
+        }
+
+    private:
+        void draw(const Matrix4& transformationMatrix, Camera3D& camera) override {
+            drawInstanced({&transformationMatrix, 1}, camera);
+        }
+
+        void drawInstanced(Containers::ArrayView<const Matrix4> transformationMatrices, Camera3D& camera) override {
+            const std::size_t id = _resources.instanceBuffers.setData(transformationMatrices, BufferUsage::StreamDraw);
+            _resources.shader.setProjectionMatrix(camera.projectionMatrix());
+            _resources.meshes[id]
+                .setInstanceCount(transformationMatrices.size())
+                .draw(_resources.shader);
+        }
+
+        TreeResources& _resources;
+};
+
+Camera3D camera;
+camera.setSortingEnabled(true)
+    .setInstancingEnabled(true);
+@endcode
+
+@anchor SceneGraph-Drawable-lod
+## Level of detail
+
+Drawables with more detail levels can let @ref Camera::draw() select the
+level based on the size of their bounding sphere on the screen. Set
+thresholds between the levels using @ref setLodThresholds(), as a fraction of
+the viewport height in decreasing order. Level `0` is the most detailed one and
+it is selected when the projected sphere diameter is at least the first
+threshold, level `1` when it's between the first and second threshold and so
+on. The levels are selected in a single pass for all visible drawables using
+the transformations and projection the camera already computed, the selected
+level is then available through @ref lod() in the @ref draw() implementation.
+The scene graph doesn't know about meshes, so what the level means is up to
+the drawable, for example it can select one of several @ref MeshView "MeshViews"
+of the same mesh:
+@code
+class Rock: public Object3D, public SceneGraph::Drawable3D {
+    public:
+        explicit Rock(Object3D* parent, SceneGraph::DrawableGroup3D* group, RockResources& resources): Object3D{parent}, SceneGraph::Drawable3D{*this, group}, _resources(resources) {
+            setBoundingSphere({}, 1.0f)
+                .setLodThresholds({0.2f, 0.05f});
+        }
+
+    private:
+        void draw(const Matrix4& transformationMatrix, Camera3D& camera) override {
+            _resources.shader.setTransformationMatrix(transformationMatrix)
+                .setProjectionMatrix(camera.projectionMatrix());
+            _resources.lods[lod()].draw(_resources.shader);
+        }
+
+        RockResources& _resources;
+};
+@endcode
+
+Drawables without a bounding sphere or without thresholds always use level
+`0`. To avoid flickering between two levels when the size is close to the
+threshold, set hysteresis using @ref Camera::setLodHysteresis(). If instancing
+is enabled, only drawables with the same level are drawn together. Count of
+drawables drawn with given level in last draw is available through
+@ref Camera::lodDrawnCount().
+
 ## Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -194,6 +334,154 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
             return AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>::group();
         }
 
+        /**
+         * @brief Whether the drawable has a bounding sphere
+         *
+         * @see @ref setBoundingSphere()
+         */
+        bool hasBoundingSphere() const { return _boundingSphereRadius >= T(0); }
+
+        /** @brief Bounding sphere center relative to the object */
+        VectorTypeFor<dimensions, T> boundingSphereCenter() const { return _boundingSphereCenter; }
+
+        /**
+         * @brief Bounding sphere radius
+         *
+         * Negative if the drawable doesn't have a bounding sphere.
+         */
+        T boundingSphereRadius() const { return _boundingSphereRadius; }
+
+        /**
+         * @brief Set bounding sphere
+         * @param center    Sphere center relative to the object
+         * @param radius    Sphere radius. Negative value removes the
+         *      bounding sphere.
+         * @return Reference to self (for method chaining)
+         *
+         * The sphere is expected to enclose everything drawn in @ref draw().
+         * If set, the drawable is culled in @ref Camera::draw() when it's
+         * outside of the camera frustum. Enables caching of absolute
+         * transformation for the feature.
+         * @see @ref setBoundingBox()
+         */
+        Drawable<dimensions, T>& setBoundingSphere(const VectorTypeFor<dimensions, T>& center, T radius);
+
+        /**
+         * @brief Set bounding box
+         * @return Reference to self (for method chaining)
+         *
+         * Sets bounding sphere enclosing given box relative to the object.
+         * See @ref setBoundingSphere() for more information.
+         */
+        Drawable<dimensions, T>& setBoundingBox(const RangeTypeFor<dimensions, T>& box) {
+            return setBoundingSphere(box.center(), (box.size()/T(2)).length());
+        }
+
+        /**
+         * @brief Sort key
+         *
+         * @see @ref setSortKey()
+         */
+        UnsignedInt sortKey() const { return _sortKey; }
+
+        /**
+         * @brief Set sort key
+         * @return Reference to self (for method chaining)
+         *
+         * Used by @ref Camera::draw() if sorting is enabled. Drawables with
+         * the same key are expected to share the same GPU state. Default is
+         * `0`. See @ref SceneGraph-Drawable-draw-sorting for more information.
+         */
+        Drawable<dimensions, T>& setSortKey(UnsignedInt key) {
+            _sortKey = key;
+            return *this;
+        }
+
+        /** @brief Whether the drawable is transparent */
+        bool isTransparent() const { return _transparent; }
+
+        /**
+         * @brief Set the drawable as transparent
+         * @return Reference to self (for method chaining)
+         *
+         * Transparent drawables are drawn after opaque ones and sorted
+         * back-to-front if sorting is enabled in @ref Camera::draw(). Default
+         * is `false`.
+         */
+        Drawable<dimensions, T>& setTransparent(bool transparent) {
+            _transparent = transparent;
+            return *this;
+        }
+
+        /**
+         * @brief Instance key
+         *
+         * @see @ref setInstanceKey()
+         */
+        UnsignedLong instanceKey() const { return _instanceKey; }
+
+        /**
+         * @brief Set instance key
+         * @return Reference to self (for method chaining)
+         *
+         * Drawables with the same nonzero key are expected to differ only in
+         * transformation, so they can be drawn together using
+         * @ref drawInstanced(). Default is `0`, which means the drawable is
+         * never instanced. See @ref SceneGraph-Drawable-instancing for more
+         * information.
+         */
+        Drawable<dimensions, T>& setInstanceKey(UnsignedLong key) {
+            _instanceKey = key;
+            return *this;
+        }
+
+        /**
+         * @brief Count of detail levels
+         *
+         * One more than count of thresholds set using
+         * @ref setLodThresholds().
+         */
+        UnsignedInt lodCount() const { return _lodThresholds.size() + 1; }
+
+        /** @brief Thresholds between detail levels */
+        Containers::ArrayView<const T> lodThresholds() const {
+            return {_lodThresholds.data(), _lodThresholds.size()};
+        }
+
+        /**
+         * @brief Set thresholds between detail levels
+         * @return Reference to self (for method chaining)
+         *
+         * The thresholds are sizes of the bounding sphere diameter projected
+         * to the screen, as a fraction of the viewport height. They are
+         * expected to be positive and in decreasing order. Setting `N`
+         * thresholds makes the drawable have `N + 1` detail levels. Default
+         * is no thresholds, which means the drawable has just one level.
+         * Resets current level to `0`. Used by @ref Camera::draw() only if
+         * the drawable has a bounding sphere. See
+         * @ref SceneGraph-Drawable-lod for more information.
+         */
+        Drawable<dimensions, T>& setLodThresholds(Containers::ArrayView<const T> thresholds);
+
+        /** @overload */
+        Drawable<dimensions, T>& setLodThresholds(std::initializer_list<T> thresholds) {
+            return setLodThresholds(Containers::ArrayView<const T>{thresholds.begin(), thresholds.size()});
+        }
+
+        /**
+         * @brief Detail level
+         *
+         * Level selected in last @ref Camera::draw(), `0` being the most
+         * detailed one. Always less than @ref lodCount().
+         */
+        UnsignedInt lod() const { return _lod; }
+
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        /* Bounding sphere relative to the scene, used by Camera */
+        VectorTypeFor<dimensions, T> absoluteBoundingSphereCenter() const { return _absoluteBoundingSphereCenter; }
+        T absoluteBoundingSphereRadius() const { return _absoluteBoundingSphereRadius; }
+        #endif
+
         /**
          * @brief Draw the object using given camera
          * @param transformationMatrix  Object transformation relative to camera
@@ -203,6 +491,40 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
          * @ref SceneGraph::Camera::projectionMatrix() "Camera::projectionMatrix()".
          */
         virtual void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) = 0;
+
+        /**
+         * @brief Draw more instances of the object using given camera
+         * @param transformationMatrices    Transformations of all instances
+         *      relative to camera
+         * @param camera                    Camera
+         *
+         * Called by @ref Camera::draw() on the first of consecutive drawables
+         * with the same @ref instanceKey() if instancing is enabled. Default
+         * implementation calls @ref draw() for each transformation.
+         */
+        virtual void drawInstanced(Containers::ArrayView<const MatrixTypeFor<dimensions, T>> transformationMatrices, Camera<dimensions, T>& camera);
+
+    protected:
+        /**
+         * @brief Clean data based on absolute transformation
+         *
+         * Recalculates the bounding sphere relative to the scene, if the
+         * drawable has any. Be sure to call this implementation if you
+         * reimplement the function in a subclass.
+         */
+        void clean(const MatrixTypeFor<dimensions, T>& absoluteTransformationMatrix) override;
+
+    private:
+        /* Camera selects the detail level */
+        friend Camera<dimensions, T>;
+
+        VectorTypeFor<dimensions, T> _boundingSphereCenter,
+            _absoluteBoundingSphereCenter;
+        T _boundingSphereRadius, _absoluteBoundingSphereRadius;
+        std::vector<T> _lodThresholds;
+        UnsignedLong _instanceKey;
+        UnsignedInt _sortKey, _lod;
+        bool _transparent;
 };
 
 /**
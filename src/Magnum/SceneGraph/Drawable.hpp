@@ -29,11 +29,61 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Drawable.h
  */
 
+#include <cmath>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
 #include "Magnum/SceneGraph/Drawable.h"
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> Drawable<dimensions, T>::Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables) {}
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>::Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables), _boundingSphereRadius{T(-1)}, _absoluteBoundingSphereRadius{T(-1)}, _instanceKey{}, _sortKey{}, _lod{}, _transparent{} {}
+
+template<UnsignedInt dimensions, class T> void Drawable<dimensions, T>::drawInstanced(Containers::ArrayView<const MatrixTypeFor<dimensions, T>> transformationMatrices, Camera<dimensions, T>& camera) {
+    for(const MatrixTypeFor<dimensions, T>& transformationMatrix: transformationMatrices)
+        draw(transformationMatrix, camera);
+}
+
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>& Drawable<dimensions, T>::setBoundingSphere(const VectorTypeFor<dimensions, T>& center, const T radius) {
+    _boundingSphereCenter = center;
+    _boundingSphereRadius = radius;
+
+    if(radius >= T(0)) {
+        this->setCachedTransformations(this->cachedTransformations()|CachedTransformation::Absolute);
+
+        /* The object might be already clean, so clean() wouldn't be called
+           until it's marked dirty again */
+        clean(this->object().absoluteTransformationMatrix());
+    }
+
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>& Drawable<dimensions, T>::setLodThresholds(const Containers::ArrayView<const T> thresholds) {
+    for(std::size_t i = 0; i != thresholds.size(); ++i) {
+        CORRADE_ASSERT(thresholds[i] > T(0) && (!i || thresholds[i] < thresholds[i - 1]),
+            "SceneGraph::Drawable::setLodThresholds(): expected positive thresholds in decreasing order", *this);
+    }
+
+    _lodThresholds.assign(thresholds.begin(), thresholds.end());
+    _lod = 0;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> void Drawable<dimensions, T>::clean(const MatrixTypeFor<dimensions, T>& absoluteTransformationMatrix) {
+    if(_boundingSphereRadius < T(0)) return;
+
+    _absoluteBoundingSphereCenter = absoluteTransformationMatrix.transformPoint(_boundingSphereCenter);
+
+    /* Scale the radius with the largest scaling of all axes */
+    const auto rotationScaling = absoluteTransformationMatrix.rotationScaling();
+    T scaling{};
+    for(std::size_t i = 0; i != dimensions; ++i)
+        scaling = Math::max(scaling, rotationScaling[i].dot());
+    _absoluteBoundingSphereRadius = _boundingSphereRadius*std::sqrt(scaling);
+}
 
 }}
 
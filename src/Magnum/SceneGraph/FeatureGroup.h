@@ -48,16 +48,35 @@ template<UnsignedInt dimensions, class T> class AbstractFeatureGroup {
     explicit AbstractFeatureGroup();
     virtual ~AbstractFeatureGroup();
 
-    void add(AbstractFeature<dimensions, T>& feature);
-    void remove(AbstractFeature<dimensions, T>& feature);
-
-    std::vector<std::reference_wrapper<AbstractFeature<dimensions, T>>> features;
+    std::size_t add(AbstractFeature<dimensions, T>& feature);
+    void remove(std::size_t index);
+
+    /* Removed features are null until the group is compacted if the order
+       is preserved. Compaction is done lazily from const accessors. */
+    mutable std::vector<AbstractFeature<dimensions, T>*> features;
+    mutable std::size_t removedCount;
+    bool orderPreserved;
 };
 
 /**
 @brief Group of features
 
 See @ref AbstractGroupedFeature for more information.
+
+@anchor SceneGraph-FeatureGroup-removal
+## Feature removal
+
+Each feature remembers its position in the group, so both @ref add() and
+@ref remove() are done in constant time. By default the removed feature is
+replaced with the last feature in the group, which changes the order of the
+features. If the order is significant (e.g. for drawing transparent
+objects), enable @ref setOrderPreserved(). The removed features are then only
+marked and the group is compacted in one pass on next access, so removing
+many features at once is still done in linear time.
+
+Because of the lazy compaction, the group shouldn't be accessed from
+multiple threads at once after removing features with order preservation
+enabled, even if the access is read-only.
 @see @ref scenegraph, @ref BasicFeatureGroup2D, @ref BasicFeatureGroup3D,
     @ref FeatureGroup2D, @ref FeatureGroup3D
 */
@@ -76,24 +95,46 @@ template<UnsignedInt dimensions, class Feature, class T> class FeatureGroup: pub
 
         /** @brief Whether the group is empty */
         bool isEmpty() const {
+            compact();
             return AbstractFeatureGroup<dimensions, T>::features.empty();
         }
 
         /** @brief Count of features in the group */
         std::size_t size() const {
+            compact();
             return AbstractFeatureGroup<dimensions, T>::features.size();
         }
 
         /** @brief Feature at given index */
         Feature& operator[](std::size_t index) {
-            return static_cast<Feature&>(AbstractFeatureGroup<dimensions, T>::features[index].get());
+            compact();
+            return static_cast<Feature&>(*AbstractFeatureGroup<dimensions, T>::features[index]);
         }
 
         /** @overload */
         const Feature& operator[](std::size_t index) const {
-            return static_cast<Feature&>(AbstractFeatureGroup<dimensions, T>::features[index].get());
+            compact();
+            return static_cast<Feature&>(*AbstractFeatureGroup<dimensions, T>::features[index]);
+        }
+
+        /**
+         * @brief Whether order of the features is preserved on removal
+         *
+         * @see @ref setOrderPreserved()
+         */
+        bool isOrderPreserved() const {
+            return AbstractFeatureGroup<dimensions, T>::orderPreserved;
         }
 
+        /**
+         * @brief Set whether order of the features is preserved on removal
+         * @return Reference to self (for method chaining)
+         *
+         * Disabled by default. See @ref SceneGraph-FeatureGroup-removal for more
+         * information.
+         */
+        FeatureGroup<dimensions, Feature, T>& setOrderPreserved(bool preserved);
+
         /**
          * @brief Add feature to the group
          * @return Reference to self (for method chaining)
@@ -107,10 +148,27 @@ template<UnsignedInt dimensions, class Feature, class T> class FeatureGroup: pub
          * @brief Remove feature from the group
          * @return Reference to self (for method chaining)
          *
-         * The feature must be part of the group.
+         * The feature must be part of the group. Unless
+         * @ref setOrderPreserved() is enabled, the last feature in the group
+         * is moved to the place of the removed one.
          * @see @ref add()
          */
         FeatureGroup<dimensions, Feature, T>& remove(Feature& feature);
+
+    protected:
+        /* Position of the feature in the group. The relative order of
+           features is preserved also while removed features in an
+           order-preserving group weren't compacted yet. */
+        static std::size_t groupIndex(const Feature& feature) {
+            return feature._groupIndex;
+        }
+
+    private:
+        void compact() const {
+            if(AbstractFeatureGroup<dimensions, T>::removedCount) compactInternal();
+        }
+
+        void compactInternal() const;
 };
 
 /**
@@ -158,7 +216,14 @@ template<class Feature> using FeatureGroup3D = BasicFeatureGroup3D<Feature, Floa
 #endif
 
 template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions, Feature, T>::~FeatureGroup() {
-    for(auto i: AbstractFeatureGroup<dimensions, T>::features) static_cast<Feature&>(i.get())._group = nullptr;
+    for(AbstractFeature<dimensions, T>* i: AbstractFeatureGroup<dimensions, T>::features)
+        if(i) static_cast<Feature*>(i)->_group = nullptr;
+}
+
+template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions, Feature, T>& FeatureGroup<dimensions, Feature, T>::setOrderPreserved(const bool preserved) {
+    compact();
+    AbstractFeatureGroup<dimensions, T>::orderPreserved = preserved;
+    return *this;
 }
 
 template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions, Feature, T>& FeatureGroup<dimensions, Feature, T>::add(Feature& feature) {
@@ -167,7 +232,7 @@ template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions
         feature._group->remove(feature);
 
     /* Crossreference the feature and group together */
-    AbstractFeatureGroup<dimensions, T>::add(feature);
+    feature._groupIndex = AbstractFeatureGroup<dimensions, T>::add(feature);
     feature._group = this;
     return *this;
 }
@@ -176,11 +241,30 @@ template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions
     CORRADE_ASSERT(feature._group == this,
         "SceneGraph::AbstractFeatureGroup::remove(): feature is not part of this group", *this);
 
-    AbstractFeatureGroup<dimensions, T>::remove(feature);
+    std::vector<AbstractFeature<dimensions, T>*>& features = AbstractFeatureGroup<dimensions, T>::features;
+    const std::size_t index = feature._groupIndex;
+    AbstractFeatureGroup<dimensions, T>::remove(index);
+
+    /* Update index of the feature that was moved in place of this one */
+    if(!AbstractFeatureGroup<dimensions, T>::orderPreserved && index < features.size())
+        static_cast<Feature*>(features[index])->_groupIndex = index;
+
     feature._group = nullptr;
     return *this;
 }
 
+template<UnsignedInt dimensions, class Feature, class T> void FeatureGroup<dimensions, Feature, T>::compactInternal() const {
+    std::vector<AbstractFeature<dimensions, T>*>& features = AbstractFeatureGroup<dimensions, T>::features;
+    std::size_t out = 0;
+    for(AbstractFeature<dimensions, T>* i: features) if(i) {
+        static_cast<Feature*>(i)->_groupIndex = out;
+        features[out++] = i;
+    }
+
+    features.resize(out);
+    AbstractFeatureGroup<dimensions, T>::removedCount = 0;
+}
+
 #if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
 extern template class MAGNUM_SCENEGRAPH_EXPORT AbstractFeatureGroup<2, Float>;
 extern template class MAGNUM_SCENEGRAPH_EXPORT AbstractFeatureGroup<3, Float>;
@@ -29,22 +29,29 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FeatureGroup.h
  */
 
-#include <algorithm>
-
 #include "Magnum/SceneGraph/FeatureGroup.h"
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> AbstractFeatureGroup<dimensions, T>::AbstractFeatureGroup() = default;
+template<UnsignedInt dimensions, class T> AbstractFeatureGroup<dimensions, T>::AbstractFeatureGroup(): removedCount{}, orderPreserved{} {}
 template<UnsignedInt dimensions, class T> AbstractFeatureGroup<dimensions, T>::~AbstractFeatureGroup() = default;
 
-template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions, T>::add(AbstractFeature<dimensions, T>& feature) {
-    features.push_back(feature);
+template<UnsignedInt dimensions, class T> std::size_t AbstractFeatureGroup<dimensions, T>::add(AbstractFeature<dimensions, T>& feature) {
+    features.push_back(&feature);
+    return features.size() - 1;
 }
 
-template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions, T>::remove(AbstractFeature<dimensions, T>& feature) {
-    features.erase(std::find_if(features.begin(), features.end(),
-        [&feature](AbstractFeature<dimensions, T>& f) { return &f == &feature; }));
+template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions, T>::remove(const std::size_t index) {
+    /* Mark the feature as removed, compaction is done on next access */
+    if(orderPreserved) {
+        features[index] = nullptr;
+        ++removedCount;
+
+    /* Move the last feature in place of the removed one */
+    } else {
+        features[index] = features.back();
+        features.pop_back();
+    }
 }
 
 }}
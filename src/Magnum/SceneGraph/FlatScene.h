@@ -0,0 +1,477 @@
+#ifndef Magnum_SceneGraph_FlatScene_h
+#define Magnum_SceneGraph_FlatScene_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::FlatScene, @ref Magnum::SceneGraph::FlatObject, alias @ref Magnum::SceneGraph::BasicFlatScene2D, @ref Magnum::SceneGraph::BasicFlatScene3D, @ref Magnum::SceneGraph::BasicFlatObject2D, @ref Magnum::SceneGraph::BasicFlatObject3D, typedef @ref Magnum::SceneGraph::FlatScene2D, @ref Magnum::SceneGraph::FlatScene3D, @ref Magnum::SceneGraph::FlatObject2D, @ref Magnum::SceneGraph::FlatObject3D
+ */
+
+#include <memory>
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    enum class FlatObjectFlag: UnsignedByte {
+        /* Features need to be cleaned */
+        Dirty = 1 << 0,
+
+        /* Transformation changed since the last update() */
+        Changed = 1 << 1,
+
+        /* In the list of dirty objects */
+        Listed = 1 << 2
+    };
+
+    typedef Containers::EnumSet<FlatObjectFlag> FlatObjectFlags;
+
+    CORRADE_ENUMSET_OPERATORS(FlatObjectFlags)
+}
+
+/**
+@brief Object in a flat scene
+
+Lightweight handle to an object stored in @ref FlatScene. The object can't be
+created directly, use @ref FlatScene::addObject() instead. It implements the
+@ref AbstractObject interface, so features such as @ref Drawable or
+@ref Camera can be attached to it the same way as to @ref Object.
+
+@anchor SceneGraph-FlatObject-explicit-specializations
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref FlatScene.hpp implementation file to avoid linker
+errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref FlatObject2D
+-   @ref FlatObject3D
+
+@see @ref BasicFlatObject2D, @ref BasicFlatObject3D
+*/
+template<UnsignedInt dimensions, class T> class FlatObject: public AbstractObject<dimensions, T> {
+    friend FlatScene<dimensions, T>;
+
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<dimensions, T> MatrixType;
+
+        /** @brief Copying is not allowed */
+        FlatObject(const FlatObject<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatObject(FlatObject<dimensions, T>&&) = delete;
+
+        ~FlatObject();
+
+        /** @brief Copying is not allowed */
+        FlatObject<dimensions, T>& operator=(const FlatObject<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatObject<dimensions, T>& operator=(FlatObject<dimensions, T>&&) = delete;
+
+        /** @brief Scene */
+        FlatScene<dimensions, T>* scene() { return &_scene; }
+
+        /** @overload */
+        const FlatScene<dimensions, T>* scene() const { return &_scene; }
+
+        /**
+         * @brief Object ID
+         *
+         * Index of the object data in @ref FlatScene arrays.
+         */
+        UnsignedInt id() const { return _id; }
+
+        /**
+         * @brief Parent object
+         *
+         * Returns `nullptr` if the object is directly in the scene.
+         */
+        FlatObject<dimensions, T>* parent();
+
+        /** @overload */
+        const FlatObject<dimensions, T>* parent() const;
+
+        /** @brief Object transformation relative to parent */
+        MatrixType transformation() const;
+
+        /**
+         * @brief Set object transformation relative to parent
+         * @return Reference to self (for method chaining)
+         *
+         * Marks the object and all its children as dirty, the absolute
+         * transformations are updated in the next @ref FlatScene::update().
+         */
+        FlatObject<dimensions, T>& setTransformation(const MatrixType& transformation);
+
+        /**
+         * @brief Transformation relative to the scene
+         *
+         * Calls @ref FlatScene::update() first.
+         */
+        MatrixType absoluteTransformation() const;
+
+    private:
+        explicit FlatObject(FlatScene<dimensions, T>& scene, UnsignedInt id);
+
+        AbstractObject<dimensions, T>* doScene() override final { return &_scene; }
+        const AbstractObject<dimensions, T>* doScene() const override final { return &_scene; }
+
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doTransformationMatrix() const override final {
+            return transformation();
+        }
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doAbsoluteTransformationMatrix() const override final {
+            return absoluteTransformation();
+        }
+
+        void doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& initialTransformationMatrix, std::vector<MatrixType>& transformationMatrices) const override final;
+
+        bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final;
+        void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final;
+        void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final;
+        void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) override final;
+        void doSetSceneClean() override final;
+
+        void MAGNUM_SCENEGRAPH_LOCAL setChanged();
+
+        FlatScene<dimensions, T>& _scene;
+        UnsignedInt _id;
+};
+
+/**
+@brief Flat scene
+
+Data-oriented alternative to @ref Scene and @ref Object for large scenes.
+Instead of each object being a separate heap allocation with transformation
+reached through pointer chasing, transformations relative to parent, parent
+indices and cached absolute transformations of all objects are stored in
+contiguous arrays, indexed by @ref FlatObject::id():
+@code
+FlatScene3D scene;
+
+FlatObject3D& first = scene.addObject();
+FlatObject3D& second = scene.addObject(&first, Matrix4::translation(Vector3::xAxis(5.0f)));
+
+second.addFeature<MyDrawable>(drawables);
+camera.draw(drawables);
+@endcode
+
+Objects are stored in the order they were added and parent has to be added
+before its children, so the arrays are always sorted topologically, with
+parents before children. Thanks to that the absolute transformations are
+computed in @ref update() with a single linear pass, starting at the first
+object whose transformation changed. The update is done implicitly by all
+functions that need the absolute transformations, such as
+@ref AbstractObject::transformationMatrices() called from
+@ref Camera::draw().
+
+For scenes with many moving objects the absolute transformations can be
+computed on multiple threads by setting a @ref ThreadPool using
+@ref setThreadPool():
+@code
+SceneGraph::ThreadPool pool;
+scene.setThreadPool(&pool);
+@endcode
+
+The objects are then processed level by level --- all changed objects with
+the same depth in the hierarchy are independent of each other and their
+transformations are computed in parallel, once all transformations on the
+previous level are done. The results are the same as with the serial update.
+The parallel path pays off mainly for wide hierarchies, deep chains of single
+objects are effectively processed serially.
+
+The @ref FlatObject instances implement @ref AbstractObject, so the features
+(such as @ref Drawable or @ref Camera) and their
+@ref scenegraph-features-caching "transformation caching" work the same as
+with @ref Object. The @ref AbstractFeature::markDirty() function is called
+lazily from @ref update() instead of directly from
+@ref FlatObject::setTransformation(), so the dirty state of whole subtrees
+can be propagated in the same linear pass. The scene keeps a list of dirty
+objects, so @ref AbstractObject::setSceneClean() touches only the objects
+that actually changed.
+
+The scene itself has identity transformation and is never dirty. Objects
+can't be reparented or removed, they are all destroyed together with the
+scene.
+
+@anchor SceneGraph-FlatScene-explicit-specializations
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref FlatScene.hpp implementation file to avoid linker
+errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref FlatScene2D
+-   @ref FlatScene3D
+
+@see @ref BasicFlatScene2D, @ref BasicFlatScene3D
+*/
+template<UnsignedInt dimensions, class T> class FlatScene: public AbstractObject<dimensions, T> {
+    friend FlatObject<dimensions, T>;
+
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<dimensions, T> MatrixType;
+
+        /**
+         * @brief Parent index of objects directly in the scene
+         *
+         * @see @ref parents()
+         */
+        enum: UnsignedInt { NoParent = ~UnsignedInt{} };
+
+        explicit FlatScene();
+
+        /** @brief Copying is not allowed */
+        FlatScene(const FlatScene<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatScene(FlatScene<dimensions, T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys all objects and their features.
+         */
+        ~FlatScene();
+
+        /** @brief Copying is not allowed */
+        FlatScene<dimensions, T>& operator=(const FlatScene<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatScene<dimensions, T>& operator=(FlatScene<dimensions, T>&&) = delete;
+
+        /** @brief Object count */
+        std::size_t objectCount() const { return _objects.size(); }
+
+        /** @brief Object with given ID */
+        FlatObject<dimensions, T>& object(UnsignedInt id);
+
+        /** @overload */
+        const FlatObject<dimensions, T>& object(UnsignedInt id) const;
+
+        /**
+         * @brief Reserve memory for given object count
+         * @return Reference to self (for method chaining)
+         */
+        FlatScene<dimensions, T>& reserve(std::size_t count);
+
+        /**
+         * @brief Add an object
+         * @param parent            Parent object or `nullptr`, if the object
+         *      should be directly in the scene
+         * @param transformation    Transformation relative to parent
+         *
+         * The parent is expected to be part of this scene. The object is
+         * owned by the scene.
+         */
+        FlatObject<dimensions, T>& addObject(FlatObject<dimensions, T>* parent = nullptr, const MatrixType& transformation = MatrixType{});
+
+        /** @brief Thread pool used for updates */
+        ThreadPool* threadPool() const { return _threadPool; }
+
+        /**
+         * @brief Set thread pool used for updates
+         * @return Reference to self (for method chaining)
+         *
+         * If set to a pool with more than one thread, large updates in
+         * @ref update() are done in parallel. The pool is not owned by the
+         * scene and has to be alive for as long as it is set. Set to
+         * `nullptr` to do all updates serially. Default is `nullptr`.
+         */
+        FlatScene<dimensions, T>& setThreadPool(ThreadPool* pool) {
+            _threadPool = pool;
+            return *this;
+        }
+
+        /**
+         * @brief Parent indices
+         *
+         * Parent index is always smaller than index of the object itself,
+         * @ref NoParent for objects directly in the scene.
+         */
+        const std::vector<UnsignedInt>& parents() const { return _parents; }
+
+        /** @brief Object transformations relative to parent */
+        const std::vector<MatrixType>& transformations() const { return _transformations; }
+
+        /**
+         * @brief Object transformations relative to the scene
+         *
+         * Calls @ref update() first.
+         */
+        const std::vector<MatrixType>& absoluteTransformations();
+
+        /**
+         * @brief Update absolute transformations
+         *
+         * Recomputes absolute transformations of all objects which changed or
+         * whose parent changed since the last update and marks them as dirty,
+         * calling @ref AbstractFeature::markDirty() on their features. Done
+         * as a single linear pass starting at the first changed object, if
+         * nothing changed, the function does nothing. If a thread pool is
+         * set using @ref setThreadPool() and the updated range is large
+         * enough, only the dirty marking is done in the linear pass and the
+         * transformations are computed in parallel afterwards.
+         */
+        void update();
+
+    private:
+        typedef Implementation::FlatObjectFlag Flag;
+        typedef Implementation::FlatObjectFlags Flags;
+
+        AbstractObject<dimensions, T>* doScene() override final { return this; }
+        const AbstractObject<dimensions, T>* doScene() const override final { return this; }
+
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doTransformationMatrix() const override final { return {}; }
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doAbsoluteTransformationMatrix() const override final { return {}; }
+
+        void doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& initialTransformationMatrix, std::vector<MatrixType>& transformationMatrices) const override final;
+
+        bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return false; }
+        void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final {}
+        void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final {}
+        void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) override final;
+        void doSetSceneClean() override final;
+
+        void MAGNUM_SCENEGRAPH_LOCAL setChanged(UnsignedInt id);
+        void MAGNUM_SCENEGRAPH_LOCAL setDirty(UnsignedInt id);
+        void MAGNUM_SCENEGRAPH_LOCAL setClean(UnsignedInt id);
+        void MAGNUM_SCENEGRAPH_LOCAL updateParallel();
+
+        std::vector<std::unique_ptr<FlatObject<dimensions, T>>> _objects;
+        std::vector<UnsignedInt> _parents;
+        std::vector<MatrixType> _transformations;
+        std::vector<MatrixType> _absoluteTransformations;
+        std::vector<Flags> _flags;
+        std::vector<UnsignedInt> _depths;
+
+        /* Index of first object changed since last update(), object count if
+           nothing changed */
+        std::size_t _firstChanged;
+
+        /* Objects which were marked dirty since the last setSceneClean(),
+           some of them might be already cleaned individually */
+        std::vector<UnsignedInt> _dirtyObjects;
+
+        /* Parallel update. The level offsets and update order are only
+           scratch memory, kept to avoid reallocations in every update. */
+        ThreadPool* _threadPool;
+        UnsignedInt _maxDepth;
+        std::vector<std::size_t> _levelOffsets;
+        std::vector<UnsignedInt> _updateOrder;
+};
+
+/**
+@brief Two-dimensional flat scene
+
+Convenience alternative to `FlatScene<2, T>`. See @ref FlatScene for more
+information.
+@see @ref FlatScene2D, @ref BasicFlatScene3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatScene2D = FlatScene<2, T>;
+#endif
+
+/**
+@brief Two-dimensional float flat scene
+
+@see @ref FlatScene3D
+*/
+typedef BasicFlatScene2D<Float> FlatScene2D;
+
+/**
+@brief Three-dimensional flat scene
+
+Convenience alternative to `FlatScene<3, T>`. See @ref FlatScene for more
+information.
+@see @ref FlatScene3D, @ref BasicFlatScene2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatScene3D = FlatScene<3, T>;
+#endif
+
+/**
+@brief Three-dimensional float flat scene
+
+@see @ref FlatScene2D
+*/
+typedef BasicFlatScene3D<Float> FlatScene3D;
+
+/**
+@brief Object in two-dimensional flat scene
+
+Convenience alternative to `FlatObject<2, T>`. See @ref FlatObject for more
+information.
+@see @ref FlatObject2D, @ref BasicFlatObject3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatObject2D = FlatObject<2, T>;
+#endif
+
+/**
+@brief Object in two-dimensional float flat scene
+
+@see @ref FlatObject3D
+*/
+typedef BasicFlatObject2D<Float> FlatObject2D;
+
+/**
+@brief Object in three-dimensional flat scene
+
+Convenience alternative to `FlatObject<3, T>`. See @ref FlatObject for more
+information.
+@see @ref FlatObject3D, @ref BasicFlatObject2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatObject3D = FlatObject<3, T>;
+#endif
+
+/**
+@brief Object in three-dimensional float flat scene
+
+@see @ref FlatObject2D
+*/
+typedef BasicFlatObject3D<Float> FlatObject3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatObject<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatObject<3, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<3, Float>;
+#endif
+
+}}
+
+#endif
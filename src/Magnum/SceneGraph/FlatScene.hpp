@@ -0,0 +1,322 @@
+#ifndef Magnum_SceneGraph_FlatScene_hpp
+#define Magnum_SceneGraph_FlatScene_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FlatScene.h
+ */
+
+#include "Magnum/SceneGraph/FlatScene.h"
+#include "Magnum/SceneGraph/ThreadPool.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>::FlatObject(FlatScene<dimensions, T>& scene, const UnsignedInt id): _scene(scene), _id{id} {}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>::~FlatObject() = default;
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>* FlatObject<dimensions, T>::parent() {
+    const UnsignedInt parent = _scene._parents[_id];
+    return parent == FlatScene<dimensions, T>::NoParent ? nullptr : _scene._objects[parent].get();
+}
+
+template<UnsignedInt dimensions, class T> const FlatObject<dimensions, T>* FlatObject<dimensions, T>::parent() const {
+    const UnsignedInt parent = _scene._parents[_id];
+    return parent == FlatScene<dimensions, T>::NoParent ? nullptr : _scene._objects[parent].get();
+}
+
+template<UnsignedInt dimensions, class T> auto FlatObject<dimensions, T>::transformation() const -> MatrixType {
+    return _scene._transformations[_id];
+}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>& FlatObject<dimensions, T>::setTransformation(const MatrixType& transformation) {
+    _scene._transformations[_id] = transformation;
+    setChanged();
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> auto FlatObject<dimensions, T>::absoluteTransformation() const -> MatrixType {
+    _scene.update();
+    return _scene._absoluteTransformations[_id];
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& initialTransformationMatrix, std::vector<MatrixType>& transformationMatrices) const {
+    _scene.transformationMatricesInto(transformationMatrices, objects, initialTransformationMatrix*absoluteTransformation().inverted());
+}
+
+template<UnsignedInt dimensions, class T> bool FlatObject<dimensions, T>::doIsDirty() const {
+    _scene.update();
+    return !!(_scene._flags[_id] & FlatScene<dimensions, T>::Flag::Dirty);
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::doSetDirty() {
+    setChanged();
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::setChanged() {
+    /* In a parallel animation step only record the object, the scene is
+       updated after all steps are done */
+    if(Implementation::DeferredDirtyMarks* const deferred = Implementation::deferredDirtyMarks()) {
+        deferred->emplace_back(this, [](void* object) {
+            FlatObject<dimensions, T>& o = *static_cast<FlatObject<dimensions, T>*>(object);
+            o._scene.setChanged(o._id);
+        });
+        return;
+    }
+
+    _scene.setChanged(_id);
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::doSetClean() {
+    _scene.update();
+    _scene.setClean(_id);
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) {
+    _scene.doSetClean(objects);
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::doSetSceneClean() {
+    _scene.doSetSceneClean();
+}
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>::FlatScene(): _firstChanged{0}, _threadPool{}, _maxDepth{0} {}
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>::~FlatScene() = default;
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>& FlatScene<dimensions, T>::object(const UnsignedInt id) {
+    CORRADE_ASSERT(id < _objects.size(), "SceneGraph::FlatScene::object(): index" << id << "out of range for" << _objects.size() << "objects", (*static_cast<FlatObject<dimensions, T>*>(nullptr)));
+    return *_objects[id];
+}
+
+template<UnsignedInt dimensions, class T> const FlatObject<dimensions, T>& FlatScene<dimensions, T>::object(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _objects.size(), "SceneGraph::FlatScene::object(): index" << id << "out of range for" << _objects.size() << "objects", (*static_cast<FlatObject<dimensions, T>*>(nullptr)));
+    return *_objects[id];
+}
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>& FlatScene<dimensions, T>::reserve(const std::size_t count) {
+    _objects.reserve(count);
+    _parents.reserve(count);
+    _transformations.reserve(count);
+    _absoluteTransformations.reserve(count);
+    _flags.reserve(count);
+    _depths.reserve(count);
+    _dirtyObjects.reserve(count);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>& FlatScene<dimensions, T>::addObject(FlatObject<dimensions, T>* const parent, const MatrixType& transformation) {
+    CORRADE_ASSERT(!parent || &parent->_scene == this,
+        "SceneGraph::FlatScene::addObject(): parent is not part of this scene", (*static_cast<FlatObject<dimensions, T>*>(nullptr)));
+    CORRADE_ASSERT(_objects.size() < NoParent,
+        "SceneGraph::FlatScene::addObject(): too large scene", (*static_cast<FlatObject<dimensions, T>*>(nullptr)));
+
+    const UnsignedInt id = _objects.size();
+    _objects.emplace_back(new FlatObject<dimensions, T>{*this, id});
+    _parents.push_back(parent ? parent->_id : UnsignedInt(NoParent));
+    _transformations.push_back(transformation);
+    _absoluteTransformations.emplace_back();
+    _depths.push_back(parent ? _depths[parent->_id] + 1 : 0);
+    if(_depths.back() > _maxDepth) _maxDepth = _depths.back();
+
+    /* New objects are dirty by default, the absolute transformation is
+       calculated in the next update(). The first changed index is at most
+       the old object count, so the new object is always in the updated
+       range. */
+    _flags.push_back(Flag::Dirty|Flag::Changed|Flag::Listed);
+    _dirtyObjects.push_back(id);
+
+    return *_objects.back();
+}
+
+template<UnsignedInt dimensions, class T> const std::vector<typename FlatScene<dimensions, T>::MatrixType>& FlatScene<dimensions, T>::absoluteTransformations() {
+    update();
+    return _absoluteTransformations;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::setChanged(const UnsignedInt id) {
+    _flags[id] |= Flag::Changed;
+    if(id < _firstChanged) _firstChanged = id;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::setDirty(const UnsignedInt id) {
+    _flags[id] |= Flag::Dirty;
+    for(AbstractFeature<dimensions, T>& feature: _objects[id]->features())
+        feature.markDirty();
+
+    /* The object might be still in the list if it was cleaned individually */
+    if(!(_flags[id] & Flag::Listed)) {
+        _flags[id] |= Flag::Listed;
+        _dirtyObjects.push_back(id);
+    }
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::update() {
+    /* Not worth the synchronization overhead for small updates */
+    if(_threadPool && _threadPool->threadCount() > 1 && _objects.size() - _firstChanged >= 4096) {
+        updateParallel();
+        return;
+    }
+
+    /* Parents are always before children, so it's enough to go once through
+       the range starting at the first changed object. Change of the parent
+       is propagated to all its children this way. */
+    for(std::size_t i = _firstChanged; i != _objects.size(); ++i) {
+        const UnsignedInt parent = _parents[i];
+        if(parent != NoParent && (_flags[parent] & Flag::Changed))
+            _flags[i] |= Flag::Changed;
+        if(!(_flags[i] & Flag::Changed)) continue;
+
+        _absoluteTransformations[i] = parent == NoParent ? _transformations[i] :
+            _absoluteTransformations[parent]*_transformations[i];
+
+        /* Mark the features as dirty, if not already */
+        if(!(_flags[i] & Flag::Dirty)) setDirty(i);
+    }
+
+    /* Clear the change marks only after, as they're needed by children */
+    for(std::size_t i = _firstChanged; i != _objects.size(); ++i)
+        _flags[i] &= ~Flag::Changed;
+
+    _firstChanged = _objects.size();
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::updateParallel() {
+    /* Propagate the change marks and mark features dirty serially, as
+       markDirty() of user features isn't expected to be thread-safe. Count
+       changed objects on each depth level meanwhile. */
+    _levelOffsets.assign(_maxDepth + 2, 0);
+    for(std::size_t i = _firstChanged; i != _objects.size(); ++i) {
+        const UnsignedInt parent = _parents[i];
+        if(parent != NoParent && (_flags[parent] & Flag::Changed))
+            _flags[i] |= Flag::Changed;
+        if(!(_flags[i] & Flag::Changed)) continue;
+
+        ++_levelOffsets[_depths[i] + 1];
+
+        if(!(_flags[i] & Flag::Dirty)) setDirty(i);
+    }
+
+    /* Sort the changed objects by depth. After that, level n spans from
+       _levelOffsets[n - 1] (or zero) to _levelOffsets[n]. */
+    for(std::size_t i = 1; i != _levelOffsets.size(); ++i)
+        _levelOffsets[i] += _levelOffsets[i - 1];
+    _updateOrder.resize(_levelOffsets.back());
+    for(std::size_t i = _firstChanged; i != _objects.size(); ++i)
+        if(_flags[i] & Flag::Changed) _updateOrder[_levelOffsets[_depths[i]]++] = i;
+
+    /* Objects on the same level depend only on the already computed previous
+       level and each writes to a different place, so no locking is needed
+       and the result doesn't depend on the scheduling */
+    for(UnsignedInt level = 0; level <= _maxDepth; ++level) {
+        const std::size_t begin = level ? _levelOffsets[level - 1] : 0;
+        _threadPool->parallelFor(_levelOffsets[level] - begin, 1024, [this, begin](std::size_t chunkBegin, std::size_t chunkEnd) {
+            for(std::size_t j = begin + chunkBegin, end = begin + chunkEnd; j != end; ++j) {
+                const UnsignedInt i = _updateOrder[j];
+                const UnsignedInt parent = _parents[i];
+                _absoluteTransformations[i] = parent == NoParent ? _transformations[i] :
+                    _absoluteTransformations[parent]*_transformations[i];
+            }
+        });
+    }
+
+    for(std::size_t i = _firstChanged; i != _objects.size(); ++i)
+        _flags[i] &= ~Flag::Changed;
+
+    _firstChanged = _objects.size();
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& initialTransformationMatrix, std::vector<MatrixType>& transformationMatrices) const {
+    /* The absolute transformations are just a cache, updating them doesn't
+       change any observable state */
+    const_cast<FlatScene<dimensions, T>&>(*this).update();
+
+    transformationMatrices.clear();
+    transformationMatrices.reserve(objects.size());
+    for(AbstractObject<dimensions, T>& object: objects) {
+        CORRADE_ASSERT(object.scene() == this,
+            "SceneGraph::FlatScene::transformationMatrices(): the objects are not part of the same scene", );
+
+        /* The scene itself has identity transformation */
+        if(&object == this) transformationMatrices.push_back(initialTransformationMatrix);
+        else transformationMatrices.push_back(initialTransformationMatrix*_absoluteTransformations[static_cast<FlatObject<dimensions, T>&>(object)._id]);
+    }
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) {
+    update();
+
+    for(AbstractObject<dimensions, T>& object: objects) {
+        CORRADE_ASSERT(object.scene() == this,
+            "SceneGraph::FlatScene::setClean(): the objects are not part of the same scene", );
+
+        /* The scene itself is never dirty */
+        if(&object != this) setClean(static_cast<FlatObject<dimensions, T>&>(object)._id);
+    }
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::doSetSceneClean() {
+    update();
+
+    /* setClean() cleans also dirty parents, so objects later in the list
+       might be already clean */
+    for(const UnsignedInt id: _dirtyObjects) {
+        setClean(id);
+        _flags[id] &= ~Flag::Listed;
+    }
+
+    _dirtyObjects.clear();
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::setClean(const UnsignedInt id) {
+    /* Clean the object and all its dirty parents. A clean object can't have
+       a dirty parent, so it's possible to stop at the first clean one. */
+    for(UnsignedInt i = id; i != NoParent && (_flags[i] & Flag::Dirty); i = _parents[i]) {
+        /* "Lazy storage" for inverted transformation matrix */
+        bool invertedComputed = false;
+        MatrixType invertedMatrix;
+
+        for(AbstractFeature<dimensions, T>& feature: _objects[i]->features()) {
+            if(feature.cachedTransformations() & CachedTransformation::Absolute)
+                feature.clean(_absoluteTransformations[i]);
+
+            if(feature.cachedTransformations() & CachedTransformation::InvertedAbsolute) {
+                if(!invertedComputed) {
+                    invertedComputed = true;
+                    invertedMatrix = _absoluteTransformations[i].inverted();
+                }
+
+                feature.cleanInverted(invertedMatrix);
+            }
+        }
+
+        _flags[i] &= ~Flag::Dirty;
+    }
+}
+
+}}
+
+#endif
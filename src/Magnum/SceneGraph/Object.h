@@ -98,6 +98,7 @@ class documentation or @ref compilation-speedup-hpp for more information.
 -   @ref MatrixTransformation3D "Object<MatrixTransformation3D>"
 -   @ref RigidMatrixTransformation2D "Object<RigidMatrixTransformation2D>"
 -   @ref RigidMatrixTransformation3D "Object<RigidMatrixTransformation3D>"
+-   @ref TranslationRotationScalingTransformation3D "Object<TranslationRotationScalingTransformation3D>"
 -   @ref TranslationTransformation2D "Object<TranslationTransformation2D>"
 -   @ref TranslationTransformation3D "Object<TranslationTransformation3D>"
 
@@ -113,6 +114,8 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
 {
     friend Containers::LinkedList<Object<Transformation>>;
     friend Containers::LinkedListItem<Object<Transformation>, Object<Transformation>>;
+    friend Scene<Transformation>;
+    friend ObjectPool;
 
     public:
         /** @brief Matrix type */
@@ -352,6 +355,9 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         /* note: doc verbatim copied from AbstractObject::setClean() */
         void setClean();
 
+        /** @copydoc AbstractObject::setSceneClean() */
+        void setSceneClean();
+
         /*@}*/
 
     #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -370,7 +376,11 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
             return absoluteTransformationMatrix();
         }
 
-        std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix) const override final;
+        void doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix, std::vector<MatrixType>& transformationMatrices) const override final;
+
+        /* Takes the objects in `jointObjects`, which is then used as scratch
+           storage */
+        void MAGNUM_SCENEGRAPH_LOCAL transformationsInternal(std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const typename Transformation::DataType& initialTransformation) const;
 
         typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const;
 
@@ -378,13 +388,27 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final { setDirty(); }
         void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final { setClean(); }
         void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) override final;
+        void MAGNUM_SCENEGRAPH_LOCAL doSetSceneClean() override final { setSceneClean(); }
 
+        void MAGNUM_SCENEGRAPH_LOCAL setDirtyInternal(Scene<Transformation>* scene);
         void MAGNUM_SCENEGRAPH_LOCAL setCleanInternal(const typename Transformation::DataType& absoluteTransformation);
+        typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL setCleanWithParents();
+        static void MAGNUM_SCENEGRAPH_LOCAL setCleanListInternal(std::vector<std::reference_wrapper<Object<Transformation>>>& objects);
+
+        void MAGNUM_SCENEGRAPH_LOCAL linkDirty(Scene<Transformation>& scene);
+        void MAGNUM_SCENEGRAPH_LOCAL unlinkDirty();
+        void MAGNUM_SCENEGRAPH_LOCAL relinkDirty(Scene<Transformation>* scene);
 
         typedef Implementation::ObjectFlag Flag;
         typedef Implementation::ObjectFlags Flags;
-        UnsignedShort counter;
+        UnsignedInt counter;
         Flags flags;
+
+        /* Intrusive circular list of dirty objects in the scene, with the
+           scene itself being the list head. Both are null if the object is
+           not in any list. */
+        Object<Transformation>* dirtyPrevious;
+        Object<Transformation>* dirtyNext;
 };
 
 }}
@@ -30,7 +30,6 @@
  */
 
 #include <algorithm>
-#include <stack>
 
 #include "Magnum/SceneGraph/AbstractTransformation.h"
 #include "Magnum/SceneGraph/Object.h"
@@ -43,11 +42,13 @@ template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::~Abstra
 
 template<UnsignedInt dimensions, class T> AbstractTransformation<dimensions, T>::AbstractTransformation() {}
 
-template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFu), flags(Flag::Dirty) {
+template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFFFFFu), flags(Flag::Dirty), dirtyPrevious(nullptr), dirtyNext(nullptr) {
     setParent(parent);
 }
 
-template<class Transformation> Object<Transformation>::~Object() = default;
+template<class Transformation> Object<Transformation>::~Object() {
+    unlinkDirty();
+}
 
 template<class Transformation> Scene<Transformation>* Object<Transformation>::scene() {
     Object<Transformation>* p(this);
@@ -82,13 +83,20 @@ template<class Transformation> Object<Transformation>& Object<Transformation>::s
         p = p->parent();
     }
 
+    Scene<Transformation>* const oldScene = scene();
+
     /* Remove the object from old parent children list */
     if(this->parent()) this->parent()->Containers::template LinkedList<Object<Transformation>>::cut(this);
 
     /* Add the object to list of new parent */
     if(parent) parent->Containers::LinkedList<Object<Transformation>>::insert(this);
 
-    setDirty();
+    /* Move already dirty objects in the subtree to dirty list of the new
+       scene, the rest is added there by setDirty() */
+    Scene<Transformation>* const newScene = scene();
+    if(oldScene != newScene) relinkDirty(newScene);
+
+    setDirtyInternal(newScene);
     return *this;
 }
 
@@ -113,62 +121,118 @@ template<class Transformation> void Object<Transformation>::setDirty() {
        nothing to do */
     if(flags & Flag::Dirty) return;
 
+    /* In a parallel animation step only record the object, it's marked dirty
+       after all steps are done */
+    if(Implementation::DeferredDirtyMarks* const deferred = Implementation::deferredDirtyMarks()) {
+        deferred->emplace_back(this, [](void* object) {
+            static_cast<Object<Transformation>*>(object)->setDirty();
+        });
+        return;
+    }
+
+    setDirtyInternal(scene());
+}
+
+template<class Transformation> void Object<Transformation>::setDirtyInternal(Scene<Transformation>* const scene) {
+    if(flags & Flag::Dirty) return;
+
     /* Make all features dirty */
     for(AbstractFeature<Transformation::Dimensions, typename Transformation::Type>& feature: this->features())
         feature.markDirty();
 
     /* Make all children dirty */
     for(Object<Transformation>& child: children())
-        child.setDirty();
+        child.setDirtyInternal(scene);
 
-    /* Mark object as dirty */
+    /* Mark object as dirty and add it to the dirty list of the scene. The
+       scene itself is the list head. */
     flags |= Flag::Dirty;
+    if(scene && scene != this) linkDirty(*scene);
+}
+
+template<class Transformation> void Object<Transformation>::linkDirty(Scene<Transformation>& scene) {
+    dirtyPrevious = scene.dirtyPrevious;
+    dirtyNext = &scene;
+    scene.dirtyPrevious->dirtyNext = this;
+    scene.dirtyPrevious = this;
+}
+
+template<class Transformation> void Object<Transformation>::unlinkDirty() {
+    if(!dirtyNext) return;
+
+    dirtyPrevious->dirtyNext = dirtyNext;
+    dirtyNext->dirtyPrevious = dirtyPrevious;
+    dirtyPrevious = dirtyNext = nullptr;
+}
+
+template<class Transformation> void Object<Transformation>::relinkDirty(Scene<Transformation>* const scene) {
+    if(flags & Flag::Dirty) {
+        unlinkDirty();
+        if(scene) linkDirty(*scene);
+    }
+
+    for(Object<Transformation>& child: children())
+        child.relinkDirty(scene);
 }
 
 template<class Transformation> void Object<Transformation>::setClean() {
     /* The object (and all its parents) are already clean, nothing to do */
     if(!(flags & Flag::Dirty)) return;
 
-    /* Collect all parents, compute base transformation */
-    std::stack<Object<Transformation>*> objects;
-    typename Transformation::DataType absoluteTransformation;
-    Object<Transformation>* p = static_cast<Object<Transformation>*>(this);
-    for(;;) {
-        objects.push(p);
+    setCleanWithParents();
+}
 
-        p = p->parent();
+template<class Transformation> typename Transformation::DataType Object<Transformation>::setCleanWithParents() {
+    /* Compute base transformation, cleaning dirty parents first. On root
+       object the base transformation is identity, if the parent is clean,
+       it's its absolute transformation. */
+    Object<Transformation>* const parent = this->parent();
+    const typename Transformation::DataType absoluteTransformation = Implementation::Transformation<Transformation>::compose(
+        !parent ? typename Transformation::DataType{} :
+        parent->isDirty() ? parent->setCleanWithParents() : parent->absoluteTransformation(),
+        Transformation::transformation());
+
+    /* Clean the object */
+    CORRADE_INTERNAL_ASSERT(isDirty());
+    setCleanInternal(absoluteTransformation);
+    CORRADE_ASSERT(!isDirty(), "SceneGraph::Object::setClean(): original implementation was not called", {});
+    return absoluteTransformation;
+}
 
-        /* On root object, base transformation is identity */
-        if(!p) break;
+template<class Transformation> void Object<Transformation>::setSceneClean() {
+    Scene<Transformation>* scene = this->scene();
+    if(!scene || scene->dirtyNext == scene) return;
 
-        /* Parent object is clean, base transformation is its absolute
-           transformation */
-        if(!p->isDirty()) {
-            absoluteTransformation = p->absoluteTransformation();
-            break;
-        }
-    }
-
-    /* Clean features on every collected object, going down from root object */
-    while(!objects.empty()) {
-        Object<Transformation>* o = objects.top();
-        objects.pop();
+    /* Take the scratch storage from the scene, so it's not reused if a
+       feature calls this again from its clean() */
+    std::vector<std::reference_wrapper<Object<Transformation>>> objects;
+    std::swap(objects, scene->_dirtyObjects);
+    objects.clear();
+    for(Object<Transformation>* o = scene->dirtyNext; o != scene; o = o->dirtyNext)
+        objects.push_back(*o);
 
-        /* Compose transformation and clean object */
-        absoluteTransformation = Implementation::Transformation<Transformation>::compose(absoluteTransformation, o->transformation());
-        CORRADE_INTERNAL_ASSERT(o->isDirty());
-        o->setCleanInternal(absoluteTransformation);
-        CORRADE_ASSERT(!o->isDirty(), "SceneGraph::Object::setClean(): original implementation was not called", );
-    }
+    setCleanListInternal(objects);
+    std::swap(objects, scene->_dirtyObjects);
 }
 
-template<class Transformation> auto Object<Transformation>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix) const -> std::vector<MatrixType> {
-    std::vector<std::reference_wrapper<Object<Transformation>>> castObjects;
-    castObjects.reserve(objects.size());
+template<class Transformation> void Object<Transformation>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix, std::vector<MatrixType>& transformationMatrices) const {
+    /* Reuse scratch storage of the scene, if this is a scene. Otherwise the
+       transformations fail on an assertion anyway. */
+    std::vector<std::reference_wrapper<Object<Transformation>>> localJointObjects;
+    std::vector<typename Transformation::DataType> localJointTransformations;
+    const Scene<Transformation>* const scene = isScene() ? static_cast<const Scene<Transformation>*>(this) : nullptr;
+    std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects = scene ? scene->_jointObjects : localJointObjects;
+    std::vector<typename Transformation::DataType>& jointTransformations = scene ? scene->_jointTransformations : localJointTransformations;
+
+    jointObjects.clear();
     /** @todo Ensure this doesn't crash, somehow */
-    for(auto o: objects) castObjects.push_back(static_cast<Object<Transformation>&>(o.get()));
+    for(auto o: objects) jointObjects.push_back(static_cast<Object<Transformation>&>(o.get()));
+
+    transformationsInternal(jointObjects, jointTransformations, Implementation::Transformation<Transformation>::fromMatrix(initialTransformationMatrix));
 
-    return transformationMatrices(std::move(castObjects), initialTransformationMatrix);
+    transformationMatrices.resize(jointTransformations.size());
+    for(std::size_t i = 0; i != jointTransformations.size(); ++i)
+        transformationMatrices[i] = Implementation::Transformation<Transformation>::toMatrix(jointTransformations[i]);
 }
 
 template<class Transformation> auto Object<Transformation>::transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const MatrixType& initialTransformationMatrix) const -> std::vector<MatrixType> {
@@ -195,22 +259,28 @@ computed and recursively concatenated together. Resulting transformations for
 joints which were originally in `object` list is then returned.
 */
 template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& initialTransformation) const {
-    CORRADE_ASSERT(objects.size() < 0xFFFFu, "SceneGraph::Object::transformations(): too large scene", {});
+    std::vector<typename Transformation::DataType> transformations;
+    transformationsInternal(objects, transformations, initialTransformation);
+    return transformations;
+}
+
+template<class Transformation> void Object<Transformation>::transformationsInternal(std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const typename Transformation::DataType& initialTransformation) const {
+    jointTransformations.clear();
+    CORRADE_ASSERT(jointObjects.size() < 0xFFFFFFFFu, "SceneGraph::Object::transformations(): too large scene", );
 
     /* Remember object count for later */
-    std::size_t objectCount = objects.size();
+    std::size_t objectCount = jointObjects.size();
 
-    /* Mark all original objects as joints and create initial list of joints
-       from them */
-    for(std::size_t i = 0; i != objects.size(); ++i) {
+    /* Mark all original objects as joints, they form the initial list of
+       joints */
+    for(std::size_t i = 0; i != jointObjects.size(); ++i) {
         /* Multiple occurences of one object in the array, don't overwrite it
            with different counter */
-        if(objects[i].get().counter != 0xFFFFu) continue;
+        if(jointObjects[i].get().counter != 0xFFFFFFFFu) continue;
 
-        objects[i].get().counter = UnsignedShort(i);
-        objects[i].get().flags |= Flag::Joint;
+        jointObjects[i].get().counter = UnsignedInt(i);
+        jointObjects[i].get().flags |= Flag::Joint;
     }
-    std::vector<std::reference_wrapper<Object<Transformation>>> jointObjects(objects);
 
     #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
     /* Scene object */
@@ -218,51 +288,54 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
     #endif
 
     /* Nearest common ancestor not yet implemented - assert this is done on scene */
-    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
-
-    /* Mark all objects up the hierarchy as visited */
-    auto it = objects.begin();
-    while(!objects.empty()) {
-        /* Already visited, remove and continue to next (duplicate occurence) */
-        if(it->get().flags & Flag::Visited) {
-            it = objects.erase(it);
-            continue;
-        }
+    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", );
 
-        /* Mark the object as visited */
-        it->get().flags |= Flag::Visited;
+    /* Mark all objects up the hierarchy as visited. Each object is walked up
+       until an already visited object or a joint is found, so every object
+       in the hierarchy is visited at most once and the whole thing is linear
+       in the number of objects involved. The joint list is indexed, because
+       it grows during the traversal. */
+    for(std::size_t i = 0; i != objectCount; ++i) {
+        Object<Transformation>* o = &jointObjects[i].get();
 
-        Object<Transformation>* parent = it->get().parent();
+        /* Already visited (duplicate occurence), continue to next */
+        if(o->flags & Flag::Visited) continue;
 
-        /* If this is root object, remove from list */
-        if(!parent) {
-            CORRADE_ASSERT(&it->get() == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
-            it = objects.erase(it);
-
-        /* Parent is an joint or already visited - remove current from list */
-        } else if(parent->flags & (Flag::Visited|Flag::Joint)) {
-            it = objects.erase(it);
-
-            /* If not already marked as joint, mark it as such and add it to
-               list of joint objects */
-            if(!(parent->flags & Flag::Joint)) {
-                CORRADE_ASSERT(jointObjects.size() < 0xFFFFu,
-                               "SceneGraph::Object::transformations(): too large scene", {});
-                CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFu);
-                parent->counter = UnsignedShort(jointObjects.size());
-                parent->flags |= Flag::Joint;
-                jointObjects.push_back(*parent);
+        for(;;) {
+            /* Mark the object as visited */
+            o->flags |= Flag::Visited;
+
+            Object<Transformation>* parent = o->parent();
+
+            /* If this is root object, done */
+            if(!parent) {
+                CORRADE_ASSERT(o == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", );
+                break;
             }
 
-        /* Else go up the hierarchy */
-        } else *it = *parent;
+            /* Parent is an joint or already visited, done */
+            if(parent->flags & (Flag::Visited|Flag::Joint)) {
+                /* If not already marked as joint, mark it as such and add it
+                   to list of joint objects */
+                if(!(parent->flags & Flag::Joint)) {
+                    CORRADE_ASSERT(jointObjects.size() < 0xFFFFFFFFu,
+                                   "SceneGraph::Object::transformations(): too large scene", );
+                    CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFFFFFu);
+                    parent->counter = UnsignedInt(jointObjects.size());
+                    parent->flags |= Flag::Joint;
+                    jointObjects.push_back(*parent);
+                }
+
+                break;
+            }
 
-        /* Cycle if reached end */
-        if(it == objects.end()) it = objects.begin();
+            /* Else go up the hierarchy */
+            o = parent;
+        }
     }
 
     /* Array of absolute transformations in joints */
-    std::vector<typename Transformation::DataType> jointTransformations(jointObjects.size());
+    jointTransformations.resize(jointObjects.size());
 
     /* Compute transformations for all joints */
     for(std::size_t i = 0; i != jointTransformations.size(); ++i)
@@ -279,14 +352,13 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
     for(auto i: jointObjects) {
         /* All not-already cleaned objects (...duplicate occurences) should
            have joint mark */
-        CORRADE_INTERNAL_ASSERT(i.get().counter == 0xFFFFu || i.get().flags & Flag::Joint);
+        CORRADE_INTERNAL_ASSERT(i.get().counter == 0xFFFFFFFFu || i.get().flags & Flag::Joint);
         i.get().flags &= ~Flag::Joint;
-        i.get().counter = 0xFFFFu;
+        i.get().counter = 0xFFFFFFFFu;
     }
 
-    /* Shrink the array to contain only transformations of requested objects and return */
+    /* Shrink the array to contain only transformations of requested objects */
     jointTransformations.resize(objectCount);
-    return jointTransformations;
 }
 
 template<class Transformation> typename Transformation::DataType Object<Transformation>::computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const {
@@ -336,6 +408,10 @@ template<class Transformation> void Object<Transformation>::doSetClean(const std
 }
 
 template<class Transformation> void Object<Transformation>::setClean(std::vector<std::reference_wrapper<Object<Transformation>>> objects) {
+    setCleanListInternal(objects);
+}
+
+template<class Transformation> void Object<Transformation>::setCleanListInternal(std::vector<std::reference_wrapper<Object<Transformation>>>& objects) {
     /* Remove all clean objects from the list */
     auto firstClean = std::remove_if(objects.begin(), objects.end(), [](Object<Transformation>& o) { return !o.isDirty(); });
     objects.erase(firstClean, objects.end());
@@ -362,7 +438,15 @@ template<class Transformation> void Object<Transformation>::setClean(std::vector
     /* Compute absolute transformations */
     Scene<Transformation>* scene = objects[0].get().scene();
     CORRADE_ASSERT(scene, "Object::setClean(): objects must be part of some scene", );
-    std::vector<typename Transformation::DataType> transformations(scene->transformations(objects));
+
+    /* Take the scratch storage from the scene, so it's not reused if a
+       feature calls this again from its clean() */
+    std::vector<std::reference_wrapper<Object<Transformation>>> jointObjects;
+    std::vector<typename Transformation::DataType> transformations;
+    std::swap(jointObjects, scene->_jointObjects);
+    std::swap(transformations, scene->_jointTransformations);
+    jointObjects.assign(objects.begin(), objects.end());
+    scene->transformationsInternal(jointObjects, transformations, {});
 
     /* Go through all objects and clean them */
     for(std::size_t i = 0; i != objects.size(); ++i) {
@@ -372,6 +456,10 @@ template<class Transformation> void Object<Transformation>::setClean(std::vector
         objects[i].get().setCleanInternal(transformations[i]);
         CORRADE_ASSERT(!objects[i].get().isDirty(), "SceneGraph::Object::setClean(): original implementation was not called", );
     }
+
+    /* Give the scratch storage back */
+    std::swap(jointObjects, scene->_jointObjects);
+    std::swap(transformations, scene->_jointTransformations);
 }
 
 template<class Transformation> void Object<Transformation>::setCleanInternal(const typename Transformation::DataType& absoluteTransformation) {
@@ -405,8 +493,10 @@ template<class Transformation> void Object<Transformation>::setCleanInternal(con
         }
     }
 
-    /* Mark object as clean */
+    /* Mark object as clean, the scene is head of the dirty list and is thus
+       never in it */
     flags &= ~Flag::Dirty;
+    if(!isScene()) unlinkDirty();
 }
 
 }}
@@ -0,0 +1,68 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ObjectPool.h"
+
+namespace Magnum { namespace SceneGraph {
+
+ObjectPool::ObjectPool(const std::size_t slabSize): _slabSize{slabSize}, _slabUsed{slabSize} {}
+
+ObjectPool::~ObjectPool() { clear(); }
+
+void* ObjectPool::allocate(const std::size_t size, const std::size_t alignment) {
+    const std::size_t offset = (_slabUsed + alignment - 1) & ~(alignment - 1);
+
+    /* Not enough space in the current slab, allocate a new one. Slab memory
+       is aligned for any fundamental type. */
+    if(_slabs.empty() || offset + size > _slabSize) {
+        _slabs.emplace_back(new char[size > _slabSize ? size : _slabSize]);
+        _slabUsed = size;
+        return _slabs.back().get();
+    }
+
+    _slabUsed = offset + size;
+    return _slabs.back().get() + offset;
+}
+
+void ObjectPool::clear() {
+    /* Features are owned by objects, destroy them first so the objects don't
+       try to delete them */
+    for(auto it = _entries.rbegin(); it != _entries.rend(); ++it)
+        if(!it->detach) it->destructor(it->pointer);
+
+    /* Cut all objects from their parents first so no pooled object gets
+       deleted by its parent. Heap-allocated children stay attached and are
+       deleted with the objects. */
+    for(const Entry& entry: _entries)
+        if(entry.detach) entry.detach(entry.pointer);
+    for(auto it = _entries.rbegin(); it != _entries.rend(); ++it)
+        if(it->detach) it->destructor(it->pointer);
+
+    _entries.clear();
+    _slabs.clear();
+    _slabUsed = _slabSize;
+}
+
+}}
@@ -0,0 +1,187 @@
+#ifndef Magnum_SceneGraph_ObjectPool_h
+#define Magnum_SceneGraph_ObjectPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::ObjectPool
+ */
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Magnum/SceneGraph/Object.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Pool allocator for objects and features
+
+Objects and features are usually allocated one by one with `new`, which
+scatters them (and the linked lists connecting them) over the whole heap. The
+pool instead places them next to each other into large slabs, in order of
+creation, which makes traversal of the hierarchy and of feature groups
+significantly more cache-friendly.
+@code
+Scene3D scene;
+SceneGraph::DrawableGroup3D drawables;
+
+Object3D& object = scene.pool().create<Object3D>(&scene);
+scene.pool().create<MyDrawable>(object, drawables);
+@endcode
+
+@anchor SceneGraph-ObjectPool-lifetime
+## Object lifetime
+
+Objects and features created with @ref create() live until the pool is
+destroyed or @ref clear() is called, they must not be deleted explicitly.
+Memory is not reused until then, the pool is thus best suited for content
+which lives for the whole lifetime of a scene or a level. Upon destruction the
+pool first destroys all pooled features, then all pooled objects, the slabs
+themselves are freed at once.
+
+Pooled objects can have heap-allocated children and features, these are
+deleted by their parent as usual. Pooled objects and features must not be
+attached to heap-allocated objects which are deleted before the pool, as the
+parent would then attempt to delete them. The easiest way to satisfy that is
+to use the pool owned by the scene, available through @ref Scene::pool(),
+which is destroyed before all other scene children.
+@see @ref scenegraph, @ref Scene::pool()
+*/
+class MAGNUM_SCENEGRAPH_EXPORT ObjectPool {
+    public:
+        /** @brief Default slab size in bytes */
+        enum: std::size_t { DefaultSlabSize = 64*1024 };
+
+        /**
+         * @brief Constructor
+         * @param slabSize  Size of one slab in bytes
+         *
+         * No memory is allocated until the first object is created.
+         */
+        explicit ObjectPool(std::size_t slabSize = DefaultSlabSize);
+
+        /** @brief Copying is not allowed */
+        ObjectPool(const ObjectPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ObjectPool(ObjectPool&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Calls @ref clear().
+         */
+        ~ObjectPool();
+
+        /** @brief Copying is not allowed */
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ObjectPool& operator=(ObjectPool&&) = delete;
+
+        /** @brief Slab size in bytes */
+        std::size_t slabSize() const { return _slabSize; }
+
+        /** @brief Count of allocated slabs */
+        std::size_t slabCount() const { return _slabs.size(); }
+
+        /** @brief Count of objects and features in the pool */
+        std::size_t size() const { return _entries.size(); }
+
+        /** @brief Whether the pool is empty */
+        bool isEmpty() const { return _entries.empty(); }
+
+        /**
+         * @brief Create object or feature in the pool
+         *
+         * Constructs @p U with given arguments in the pool. If the type
+         * doesn't fit into the space left in the current slab, a new slab
+         * is allocated (of size at least `sizeof(U)`). See
+         * @ref SceneGraph-ObjectPool-lifetime "class documentation" for
+         * information about lifetime of the created instance.
+         */
+        template<class U, class ...Args> U& create(Args&&... args);
+
+        /**
+         * @brief Destroy everything in the pool
+         *
+         * Destroys all features, then all objects in reverse order of
+         * creation and frees all slabs.
+         */
+        void clear();
+
+    private:
+        struct Entry {
+            void* pointer;
+            void(*destructor)(void*);
+            /* Null for features */
+            void(*detach)(void*);
+        };
+
+        template<class Transformation> static std::true_type isObject(const Object<Transformation>*);
+        static std::false_type isObject(const void*);
+
+        template<class U> static void destroy(void* pointer) {
+            static_cast<U*>(pointer)->~U();
+        }
+
+        template<class U> static void detach(void* pointer) {
+            detachObject(*static_cast<U*>(pointer));
+        }
+
+        template<class Transformation> static void detachObject(Object<Transformation>& object) {
+            if(Object<Transformation>* parent = object.parent())
+                parent->Containers::template LinkedList<Object<Transformation>>::cut(&object);
+        }
+
+        template<class U> static auto detachFunction(std::true_type) -> void(*)(void*) { return detach<U>; }
+        template<class U> static auto detachFunction(std::false_type) -> void(*)(void*) { return nullptr; }
+
+        void* allocate(std::size_t size, std::size_t alignment);
+
+        std::size_t _slabSize, _slabUsed;
+        std::vector<std::unique_ptr<char[]>> _slabs;
+        std::vector<Entry> _entries;
+};
+
+template<class U, class ...Args> U& ObjectPool::create(Args&&... args) {
+    static_assert(alignof(U) <= alignof(std::max_align_t),
+        "over-aligned types can't be allocated in the pool");
+
+    U* const instance = new(allocate(sizeof(U), alignof(U))) U(std::forward<Args>(args)...);
+    _entries.push_back({instance, destroy<U>,
+        detachFunction<U>(decltype(isObject(instance)){})});
+    return *instance;
+}
+
+}}
+
+#endif
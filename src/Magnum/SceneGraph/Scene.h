@@ -30,6 +30,7 @@
  */
 
 #include "Magnum/SceneGraph/Object.h"
+#include "Magnum/SceneGraph/ObjectPool.h"
 
 namespace Magnum { namespace SceneGraph {
 
@@ -38,13 +39,66 @@ namespace Magnum { namespace SceneGraph {
 
 Basically @ref Object which cannot have parent or non-default transformation.
 See @ref scenegraph for introduction.
+
+The scene keeps track of all its dirty objects, which allows
+@ref Object::setSceneClean() to clean them without going through the whole
+hierarchy.
+
+The scene also owns an @ref ObjectPool, which can be used to allocate objects
+and features close to each other in memory instead of individually on the
+heap. See @ref pool() for more information.
 */
 template<class Transformation> class Scene: public Object<Transformation> {
     public:
-        explicit Scene() = default;
+        explicit Scene() {
+            this->dirtyPrevious = this->dirtyNext = this;
+        }
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys all objects in the scene.
+         */
+        ~Scene() {
+            /* Detach the dirty list, as the scene is already partially
+               destroyed when the children are */
+            for(Object<Transformation>* o = this->dirtyNext; o != this; ) {
+                Object<Transformation>* next = o->dirtyNext;
+                o->dirtyPrevious = o->dirtyNext = nullptr;
+                o = next;
+            }
+            this->dirtyPrevious = this->dirtyNext = nullptr;
+
+            /* The pool gets destroyed right after this, before the remaining
+               heap-allocated children are deleted by Object */
+        }
+
+        /**
+         * @brief Object pool
+         *
+         * Objects and features created in the pool are destroyed together
+         * with the scene, before any other children of the scene. The pool
+         * doesn't allocate any memory until it's used.
+         * @code
+         * Object3D& object = scene.pool().create<Object3D>(&scene);
+         * @endcode
+         *
+         * See @ref ObjectPool documentation for more information.
+         */
+        ObjectPool& pool() { return _pool; }
+        const ObjectPool& pool() const { return _pool; } /**< @overload */
 
     private:
+        friend Object<Transformation>;
+
         bool isScene() const override final { return true; }
+
+        ObjectPool _pool;
+
+        /* Scratch storage reused by Object::setSceneClean() and
+           transformationMatrices() so they don't allocate every frame */
+        mutable std::vector<std::reference_wrapper<Object<Transformation>>> _dirtyObjects, _jointObjects;
+        mutable std::vector<typename Transformation::DataType> _jointTransformations;
 };
 
 }}
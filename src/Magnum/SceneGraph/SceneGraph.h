@@ -135,6 +135,20 @@ template<class T> using BasicDrawableGroup3D = DrawableGroup<3, T>;
 typedef BasicDrawableGroup2D<Float> DrawableGroup2D;
 typedef BasicDrawableGroup3D<Float> DrawableGroup3D;
 
+template<UnsignedInt, class> class FlatObject;
+template<class T> using BasicFlatObject2D = FlatObject<2, T>;
+template<class T> using BasicFlatObject3D = FlatObject<3, T>;
+typedef BasicFlatObject2D<Float> FlatObject2D;
+typedef BasicFlatObject3D<Float> FlatObject3D;
+
+template<UnsignedInt, class> class FlatScene;
+template<class T> using BasicFlatScene2D = FlatScene<2, T>;
+template<class T> using BasicFlatScene3D = FlatScene<3, T>;
+typedef BasicFlatScene2D<Float> FlatScene2D;
+typedef BasicFlatScene3D<Float> FlatScene3D;
+
+enum class Interpolation: UnsignedByte;
+
 template<class> class BasicMatrixTransformation2D;
 template<class> class BasicMatrixTransformation3D;
 typedef BasicMatrixTransformation2D<Float> MatrixTransformation2D;
@@ -142,6 +156,8 @@ typedef BasicMatrixTransformation3D<Float> MatrixTransformation3D;
 
 template<class Transformation> class Object;
 
+class ObjectPool;
+
 template<class> class BasicRigidMatrixTransformation2D;
 template<class> class BasicRigidMatrixTransformation3D;
 typedef BasicRigidMatrixTransformation2D<Float> RigidMatrixTransformation2D;
@@ -149,6 +165,28 @@ typedef BasicRigidMatrixTransformation3D<Float> RigidMatrixTransformation3D;
 
 template<class Transformation> class Scene;
 
+template<UnsignedInt, class, class> class SpatialIndex;
+template<class Feature, class T> using BasicSpatialIndex2D = SpatialIndex<2, Feature, T>;
+template<class Feature, class T> using BasicSpatialIndex3D = SpatialIndex<3, Feature, T>;
+template<class Feature> using SpatialIndex2D = BasicSpatialIndex2D<Feature, Float>;
+template<class Feature> using SpatialIndex3D = BasicSpatialIndex3D<Feature, Float>;
+
+template<UnsignedInt dimensions, class T> using DrawableIndex = SpatialIndex<dimensions, Drawable<dimensions, T>, T>;
+template<class T> using BasicDrawableIndex2D = DrawableIndex<2, T>;
+template<class T> using BasicDrawableIndex3D = DrawableIndex<3, T>;
+typedef BasicDrawableIndex2D<Float> DrawableIndex2D;
+typedef BasicDrawableIndex3D<Float> DrawableIndex3D;
+
+class ThreadPool;
+
+template<class> class Track;
+
+template<class> class BasicTrackPlayer;
+typedef BasicTrackPlayer<Float> TrackPlayer;
+
+template<class> class BasicTranslationRotationScalingTransformation3D;
+typedef BasicTranslationRotationScalingTransformation3D<Float> TranslationRotationScalingTransformation3D;
+
 template<UnsignedInt, class T, class = T> class TranslationTransformation;
 template<class T, class TranslationType = T> using BasicTranslationTransformation2D = TranslationTransformation<2, T, TranslationType>;
 template<class T, class TranslationType = T> using BasicTranslationTransformation3D = TranslationTransformation<3, T, TranslationType>;
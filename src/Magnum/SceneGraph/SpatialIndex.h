@@ -0,0 +1,602 @@
+#ifndef Magnum_SceneGraph_SpatialIndex_h
+#define Magnum_SceneGraph_SpatialIndex_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::SpatialIndex, alias @ref Magnum::SceneGraph::BasicSpatialIndex2D, @ref Magnum::SceneGraph::BasicSpatialIndex3D, @ref Magnum::SceneGraph::SpatialIndex2D, @ref Magnum::SceneGraph::SpatialIndex3D, @ref Magnum::SceneGraph::DrawableIndex, @ref Magnum::SceneGraph::BasicDrawableIndex2D, @ref Magnum::SceneGraph::BasicDrawableIndex3D, typedef @ref Magnum::SceneGraph::DrawableIndex2D, @ref Magnum::SceneGraph::DrawableIndex3D
+ */
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Geometry/Intersection.h"
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    /* Axis-aligned box enclosing given box transformed with given matrix */
+    template<UnsignedInt dimensions, class T> RangeTypeFor<dimensions, T> transformedBounds(const RangeTypeFor<dimensions, T>& bounds, const MatrixTypeFor<dimensions, T>& matrix) {
+        const VectorTypeFor<dimensions, T> center = matrix.transformPoint(bounds.center());
+        const VectorTypeFor<dimensions, T> halfSize = bounds.size()/T(2);
+        const auto rotationScaling = matrix.rotationScaling();
+        VectorTypeFor<dimensions, T> transformedHalfSize;
+        for(std::size_t i = 0; i != dimensions; ++i)
+            transformedHalfSize += Math::abs(rotationScaling[i])*halfSize[i];
+        return {center - transformedHalfSize, center + transformedHalfSize};
+    }
+
+    template<UnsignedInt dimensions, class T> inline bool rangeRange(const RangeTypeFor<dimensions, T>& a, const RangeTypeFor<dimensions, T>& b) {
+        return (a.min() <= b.max()).all() && (b.min() <= a.max()).all();
+    }
+
+    template<UnsignedInt dimensions, class T> inline bool rangeSphere(const RangeTypeFor<dimensions, T>& range, const VectorTypeFor<dimensions, T>& center, const T radius) {
+        return (center - Math::min(Math::max(center, range.min()), range.max())).dot() <= radius*radius;
+    }
+
+    /* Slab test, only intersections in front of the origin count. If the
+       ray is parallel to a slab, the origin has to be inside it, as the
+       division would give 0*inf = NaN for origin on the slab boundary. */
+    template<UnsignedInt dimensions, class T> inline bool rangeRay(const RangeTypeFor<dimensions, T>& range, const VectorTypeFor<dimensions, T>& origin, const VectorTypeFor<dimensions, T>& direction, const VectorTypeFor<dimensions, T>& invertedDirection) {
+        T near = T(0), far = Math::Constants<T>::inf();
+        for(UnsignedInt i = 0; i != dimensions; ++i) {
+            if(direction[i] == T(0)) {
+                if(origin[i] < range.min()[i] || origin[i] > range.max()[i])
+                    return false;
+                continue;
+            }
+
+            const T a = (range.min()[i] - origin[i])*invertedDirection[i];
+            const T b = (range.max()[i] - origin[i])*invertedDirection[i];
+            near = Math::max(near, Math::min(a, b));
+            far = Math::min(far, Math::max(a, b));
+        }
+
+        return near <= far;
+    }
+}
+
+/**
+@brief Spatial index of features
+
+Keeps bounds of features relative to the scene in a loose quadtree (in 2D) or
+a loose octree (in 3D), so features in given region can be found without going
+through all of them and computing their absolute transformations.
+
+## Usage
+
+The index is created with the region it should cover. Features are then added
+using @ref add() together with their bounds relative to the object they are
+attached to. A feature can be part of the index and of any feature group at
+the same time.
+@code
+SceneGraph::DrawableIndex3D index{{Vector3{-1000.0f}, Vector3{1000.0f}}};
+index.add(*drawable, {Vector3{-1.0f}, Vector3{1.0f}});
+
+std::vector<std::reference_wrapper<SceneGraph::Drawable3D>> found;
+index.querySphere({10.0f, 0.0f, 0.0f}, 5.0f, found);
+@endcode
+
+The index can be queried for features intersecting given box, sphere, frustum
+or ray. Each query cleans the scene using @ref AbstractObject::setSceneClean()
+first. The index attaches an internal feature with
+@ref scenegraph-features-caching "transformation caching" to the object of
+each added feature, so only features of objects that moved since the last
+query are updated in the tree. All features in the index are expected to be in
+the same scene.
+
+@anchor SceneGraph-SpatialIndex-tree
+## Tree structure
+
+Each node of the tree has loose bounds twice as large as its cell. A feature is
+stored in exactly one node, with depth given by the feature size and cell
+containing center of the feature, so adding and moving a feature is done in
+time proportional to the tree depth. Features that don't fit into the region
+covered by the tree are kept in a separate list, which is tested in each
+query. Nodes are created on demand and kept until the index is destroyed.
+
+@anchor SceneGraph-SpatialIndex-usage
+## Usage with camera and shapes
+
+@ref DrawableIndex can be passed to @ref Camera::draw(DrawableIndex<dimensions, T>&),
+which then draws only the drawables inside the view volume.
+@ref Shapes::ShapeGroup::firstCollision(const AbstractShape<dimensions>&, ShapeIndex<dimensions>&)
+uses @ref Shapes::ShapeIndex as a broad phase.
+
+## Feature lifetime
+
+Features are removed from the index when their object is destroyed. If you
+destroy the feature sooner, remove it using @ref remove() first. If the index
+is destroyed before the objects, it detaches itself from all of them.
+
+@see @ref scenegraph, @ref BasicSpatialIndex2D, @ref BasicSpatialIndex3D,
+    @ref SpatialIndex2D, @ref SpatialIndex3D, @ref DrawableIndex
+*/
+template<UnsignedInt dimensions, class Feature, class T> class SpatialIndex {
+    public:
+        /**
+         * @brief Constructor
+         * @param bounds    Region covered by the tree
+         * @param maxDepth  Max depth of the tree
+         */
+        explicit SpatialIndex(const RangeTypeFor<dimensions, T>& bounds, UnsignedInt maxDepth = 8);
+
+        /** @brief Copying is not allowed */
+        SpatialIndex(const SpatialIndex<dimensions, Feature, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        SpatialIndex(SpatialIndex<dimensions, Feature, T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Removes the index from all objects, but doesn't delete the
+         * features.
+         */
+        ~SpatialIndex();
+
+        /** @brief Copying is not allowed */
+        SpatialIndex<dimensions, Feature, T>& operator=(const SpatialIndex<dimensions, Feature, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        SpatialIndex<dimensions, Feature, T>& operator=(SpatialIndex<dimensions, Feature, T>&&) = delete;
+
+        /** @brief Region covered by the tree */
+        RangeTypeFor<dimensions, T> bounds() const { return _nodes[0].cell; }
+
+        /** @brief Max depth of the tree */
+        UnsignedInt maxDepth() const { return _maxDepth; }
+
+        /** @brief Whether the index is empty */
+        bool isEmpty() const { return _entries.empty(); }
+
+        /** @brief Count of features in the index */
+        std::size_t size() const { return _entries.size(); }
+
+        /**
+         * @brief Count of tree nodes
+         *
+         * See @ref SceneGraph-SpatialIndex-tree for more information.
+         */
+        std::size_t nodeCount() const { return _nodes.size(); }
+
+        /** @brief Whether given feature is in the index */
+        bool contains(const Feature& feature) const {
+            return _entries.find(&feature) != _entries.end();
+        }
+
+        /**
+         * @brief Add feature to the index
+         * @param feature   Feature to add
+         * @param bounds    Feature bounds relative to its object
+         * @return Reference to self (for method chaining)
+         *
+         * The feature is expected to not be in the index already.
+         * @see @ref remove()
+         */
+        SpatialIndex<dimensions, Feature, T>& add(Feature& feature, const RangeTypeFor<dimensions, T>& bounds);
+
+        /**
+         * @brief Remove feature from the index
+         * @return Reference to self (for method chaining)
+         *
+         * The feature is expected to be in the index.
+         * @see @ref add()
+         */
+        SpatialIndex<dimensions, Feature, T>& remove(Feature& feature);
+
+        /**
+         * @brief Feature bounds relative to the scene
+         *
+         * The feature is expected to be in the index. Calls @ref setClean()
+         * first.
+         */
+        RangeTypeFor<dimensions, T> absoluteBounds(const Feature& feature);
+
+        /**
+         * @brief Update the tree
+         *
+         * Calls @ref AbstractObject::setSceneClean() on the scene the
+         * features are in, which updates features of all objects that moved
+         * since last time. Called by all queries.
+         */
+        void setClean();
+
+        /**
+         * @brief Features intersecting given box
+         * @param box       Box relative to the scene
+         * @param features  Where to put the features
+         *
+         * The @p features vector is cleared first, so its memory can be
+         * reused between queries. The order of the features is unspecified.
+         * Calls @ref setClean() first.
+         */
+        void queryBox(const RangeTypeFor<dimensions, T>& box, std::vector<std::reference_wrapper<Feature>>& features);
+
+        /**
+         * @brief Features intersecting given sphere
+         *
+         * See @ref queryBox() for more information.
+         */
+        void querySphere(const VectorTypeFor<dimensions, T>& center, T radius, std::vector<std::reference_wrapper<Feature>>& features);
+
+        /**
+         * @brief Features intersecting given frustum
+         *
+         * Available only in 3D. See @ref queryBox() for more information.
+         */
+        void queryFrustum(const Math::Frustum<T>& frustum, std::vector<std::reference_wrapper<Feature>>& features);
+
+        /**
+         * @brief Features intersecting given ray
+         * @param origin    Ray origin relative to the scene
+         * @param direction Ray direction
+         * @param features  Where to put the features
+         *
+         * Only intersections in front of the origin are counted. The features
+         * are not sorted by distance. See @ref queryBox() for more
+         * information.
+         */
+        void queryRay(const VectorTypeFor<dimensions, T>& origin, const VectorTypeFor<dimensions, T>& direction, std::vector<std::reference_wrapper<Feature>>& features);
+
+    private:
+        enum: UnsignedInt {
+            NoNode = ~UnsignedInt{},
+            OutsideNode = ~UnsignedInt{} - 1
+        };
+
+        /* Attached to the object of each feature, updates the tree when the
+           object is cleaned */
+        class Entry: public AbstractFeature<dimensions, T> {
+            public:
+                explicit Entry(SpatialIndex<dimensions, Feature, T>& index, Feature& feature, const RangeTypeFor<dimensions, T>& bounds): AbstractFeature<dimensions, T>{feature.object()}, index{&index}, feature(feature), bounds{bounds}, node{NoNode}, position{} {
+                    this->setCachedTransformations(CachedTransformation::Absolute);
+                }
+
+                ~Entry() {
+                    if(index) index->removeEntry(*this);
+                }
+
+                void clean(const MatrixTypeFor<dimensions, T>& absoluteTransformationMatrix) override {
+                    absoluteBounds = Implementation::transformedBounds<dimensions, T>(bounds, absoluteTransformationMatrix);
+                    index->updateEntry(*this);
+                }
+
+                SpatialIndex<dimensions, Feature, T>* index;
+                Feature& feature;
+                RangeTypeFor<dimensions, T> bounds, absoluteBounds;
+                UnsignedInt node;
+                std::size_t position;
+        };
+
+        struct Node {
+            RangeTypeFor<dimensions, T> cell, looseBounds;
+            UnsignedInt parent;
+            UnsignedInt children[1 << dimensions];
+            /* Count of entries in this node and all its children */
+            std::size_t count;
+            std::vector<Entry*> entries;
+        };
+
+        UnsignedInt addNode(const RangeTypeFor<dimensions, T>& cell, UnsignedInt parent);
+        UnsignedInt nodeFor(const RangeTypeFor<dimensions, T>& bounds);
+        void insertEntry(Entry& entry, UnsignedInt node);
+        void unlinkEntry(Entry& entry);
+        void updateEntry(Entry& entry);
+        void removeEntry(Entry& entry);
+        template<class Test> void query(Test test, std::vector<std::reference_wrapper<Feature>>& features);
+
+        UnsignedInt _maxDepth;
+        std::vector<Node> _nodes;
+        std::vector<Entry*> _outside;
+        std::unordered_map<const Feature*, Entry*> _entries;
+        /* Traversal stack, kept to avoid reallocations */
+        std::vector<UnsignedInt> _stack;
+};
+
+/**
+@brief Spatial index for two-dimensional scenes
+
+Convenience alternative to `SpatialIndex<2, Feature, T>`. See
+@ref SpatialIndex for more information.
+@see @ref SpatialIndex2D, @ref BasicSpatialIndex3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class Feature, class T> using BasicSpatialIndex2D = SpatialIndex<2, Feature, T>;
+#endif
+
+/**
+@brief Spatial index for two-dimensional float scenes
+
+Convenience alternative to `BasicSpatialIndex2D<Feature, Float>`. See
+@ref SpatialIndex for more information.
+@see @ref SpatialIndex3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class Feature> using SpatialIndex2D = BasicSpatialIndex2D<Feature, Float>;
+#endif
+
+/**
+@brief Spatial index for three-dimensional scenes
+
+Convenience alternative to `SpatialIndex<3, Feature, T>`. See
+@ref SpatialIndex for more information.
+@see @ref SpatialIndex3D, @ref BasicSpatialIndex2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class Feature, class T> using BasicSpatialIndex3D = SpatialIndex<3, Feature, T>;
+#endif
+
+/**
+@brief Spatial index for three-dimensional float scenes
+
+Convenience alternative to `BasicSpatialIndex3D<Feature, Float>`. See
+@ref SpatialIndex for more information.
+@see @ref SpatialIndex2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class Feature> using SpatialIndex3D = BasicSpatialIndex3D<Feature, Float>;
+#endif
+
+/**
+@brief Spatial index of drawables
+
+Can be used for culling in @ref Camera::draw(DrawableIndex<dimensions, T>&).
+See @ref SpatialIndex for more information.
+@see @ref BasicDrawableIndex2D, @ref BasicDrawableIndex3D,
+    @ref DrawableIndex2D, @ref DrawableIndex3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<UnsignedInt dimensions, class T> using DrawableIndex = SpatialIndex<dimensions, Drawable<dimensions, T>, T>;
+#endif
+
+/**
+@brief Spatial index of two-dimensional drawables
+
+Convenience alternative to `DrawableIndex<2, T>`. See @ref SpatialIndex for
+more information.
+@see @ref DrawableIndex2D, @ref BasicDrawableIndex3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicDrawableIndex2D = DrawableIndex<2, T>;
+#endif
+
+/**
+@brief Spatial index of two-dimensional float drawables
+
+@see @ref DrawableIndex3D
+*/
+typedef BasicDrawableIndex2D<Float> DrawableIndex2D;
+
+/**
+@brief Spatial index of three-dimensional drawables
+
+Convenience alternative to `DrawableIndex<3, T>`. See @ref SpatialIndex for
+more information.
+@see @ref DrawableIndex3D, @ref BasicDrawableIndex2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicDrawableIndex3D = DrawableIndex<3, T>;
+#endif
+
+/**
+@brief Spatial index of three-dimensional float drawables
+
+@see @ref DrawableIndex2D
+*/
+typedef BasicDrawableIndex3D<Float> DrawableIndex3D;
+
+template<UnsignedInt dimensions, class Feature, class T> SpatialIndex<dimensions, Feature, T>::SpatialIndex(const RangeTypeFor<dimensions, T>& bounds, const UnsignedInt maxDepth): _maxDepth{maxDepth} {
+    addNode(bounds, NoNode);
+}
+
+template<UnsignedInt dimensions, class Feature, class T> SpatialIndex<dimensions, Feature, T>::~SpatialIndex() {
+    /* The entries are owned by the objects, but they can't outlive the index */
+    for(const auto& entry: _entries) {
+        entry.second->index = nullptr;
+        delete entry.second;
+    }
+}
+
+template<UnsignedInt dimensions, class Feature, class T> SpatialIndex<dimensions, Feature, T>& SpatialIndex<dimensions, Feature, T>::add(Feature& feature, const RangeTypeFor<dimensions, T>& bounds) {
+    CORRADE_ASSERT(!contains(feature),
+        "SceneGraph::SpatialIndex::add(): feature is already in the index", *this);
+
+    Entry* const entry = new Entry{*this, feature, bounds};
+    _entries.emplace(&feature, entry);
+
+    /* The object might be already clean, so clean() wouldn't be called
+       until it's marked dirty again */
+    entry->clean(feature.object().absoluteTransformationMatrix());
+    return *this;
+}
+
+template<UnsignedInt dimensions, class Feature, class T> SpatialIndex<dimensions, Feature, T>& SpatialIndex<dimensions, Feature, T>::remove(Feature& feature) {
+    const auto found = _entries.find(&feature);
+    CORRADE_ASSERT(found != _entries.end(),
+        "SceneGraph::SpatialIndex::remove(): feature is not part of this index", *this);
+
+    /* The destructor removes the entry from the tree and the map */
+    delete found->second;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class Feature, class T> RangeTypeFor<dimensions, T> SpatialIndex<dimensions, Feature, T>::absoluteBounds(const Feature& feature) {
+    setClean();
+    const auto found = _entries.find(&feature);
+    CORRADE_ASSERT(found != _entries.end(),
+        "SceneGraph::SpatialIndex::absoluteBounds(): feature is not part of this index", {});
+    return found->second->absoluteBounds;
+}
+
+template<UnsignedInt dimensions, class Feature, class T> void SpatialIndex<dimensions, Feature, T>::setClean() {
+    /* The scene keeps track of dirty objects, so this doesn't need to go
+       through all features in the index */
+    if(!_entries.empty()) _entries.begin()->second->object().setSceneClean();
+}
+
+template<UnsignedInt dimensions, class Feature, class T> void SpatialIndex<dimensions, Feature, T>::queryBox(const RangeTypeFor<dimensions, T>& box, std::vector<std::reference_wrapper<Feature>>& features) {
+    query([&box](const RangeTypeFor<dimensions, T>& range) {
+        return Implementation::rangeRange<dimensions, T>(range, box);
+    }, features);
+}
+
+template<UnsignedInt dimensions, class Feature, class T> void SpatialIndex<dimensions, Feature, T>::querySphere(const VectorTypeFor<dimensions, T>& center, const T radius, std::vector<std::reference_wrapper<Feature>>& features) {
+    query([&center, radius](const RangeTypeFor<dimensions, T>& range) {
+        return Implementation::rangeSphere<dimensions, T>(range, center, radius);
+    }, features);
+}
+
+template<UnsignedInt dimensions, class Feature, class T> void SpatialIndex<dimensions, Feature, T>::queryFrustum(const Math::Frustum<T>& frustum, std::vector<std::reference_wrapper<Feature>>& features) {
+    query([&frustum](const RangeTypeFor<dimensions, T>& range) {
+        return Math::Geometry::Intersection::rangeFrustum(range, frustum);
+    }, features);
+}
+
+template<UnsignedInt dimensions, class Feature, class T> void SpatialIndex<dimensions, Feature, T>::queryRay(const VectorTypeFor<dimensions, T>& origin, const VectorTypeFor<dimensions, T>& direction, std::vector<std::reference_wrapper<Feature>>& features) {
+    const VectorTypeFor<dimensions, T> invertedDirection = T(1)/direction;
+    query([&origin, &direction, &invertedDirection](const RangeTypeFor<dimensions, T>& range) {
+        return Implementation::rangeRay<dimensions, T>(range, origin, direction, invertedDirection);
+    }, features);
+}
+
+template<UnsignedInt dimensions, class Feature, class T> template<class Test> void SpatialIndex<dimensions, Feature, T>::query(const Test test, std::vector<std::reference_wrapper<Feature>>& features) {
+    setClean();
+    features.clear();
+
+    for(Entry* entry: _outside)
+        if(test(entry->absoluteBounds)) features.push_back(entry->feature);
+
+    /* Skip empty subtrees and subtrees with loose bounds outside */
+    _stack.clear();
+    _stack.push_back(0);
+    while(!_stack.empty()) {
+        const Node& node = _nodes[_stack.back()];
+        _stack.pop_back();
+        if(!node.count || !test(node.looseBounds)) continue;
+
+        for(Entry* entry: node.entries)
+            if(test(entry->absoluteBounds)) features.push_back(entry->feature);
+        for(const UnsignedInt child: node.children)
+            if(child) _stack.push_back(child);
+    }
+}
+
+template<UnsignedInt dimensions, class Feature, class T> UnsignedInt SpatialIndex<dimensions, Feature, T>::addNode(const RangeTypeFor<dimensions, T>& cell, const UnsignedInt parent) {
+    const VectorTypeFor<dimensions, T> padding = cell.size()/T(2);
+
+    Node node;
+    node.cell = cell;
+    node.looseBounds = {cell.min() - padding, cell.max() + padding};
+    node.parent = parent;
+    for(UnsignedInt& child: node.children) child = 0;
+    node.count = 0;
+    _nodes.push_back(std::move(node));
+    return _nodes.size() - 1;
+}
+
+template<UnsignedInt dimensions, class Feature, class T> UnsignedInt SpatialIndex<dimensions, Feature, T>::nodeFor(const RangeTypeFor<dimensions, T>& bounds) {
+    const VectorTypeFor<dimensions, T> center = bounds.center();
+    const VectorTypeFor<dimensions, T> size = bounds.size();
+
+    /* Doesn't fit into loose bounds of the root */
+    if(!_nodes[0].cell.contains(center) || !(size <= _nodes[0].cell.size()).all())
+        return OutsideNode;
+
+    /* Go down while the bounds fit into loose bounds of the child containing
+       the center, creating the nodes on the way */
+    UnsignedInt node = 0;
+    for(UnsignedInt depth = 0; depth != _maxDepth; ++depth) {
+        const VectorTypeFor<dimensions, T> childSize = _nodes[node].cell.size()/T(2);
+        if(!(size <= childSize).all()) break;
+
+        const VectorTypeFor<dimensions, T> middle = _nodes[node].cell.center();
+        VectorTypeFor<dimensions, T> min = _nodes[node].cell.min();
+        UnsignedInt child = 0;
+        for(std::size_t i = 0; i != dimensions; ++i) if(center[i] >= middle[i]) {
+            child |= 1 << i;
+            min[i] = middle[i];
+        }
+
+        if(!_nodes[node].children[child]) {
+            const UnsignedInt created = addNode({min, min + childSize}, node);
+            _nodes[node].children[child] = created;
+        }
+
+        node = _nodes[node].children[child];
+    }
+
+    return node;
+}
+
+template<UnsignedInt dimensions, class Feature, class T> void SpatialIndex<dimensions, Feature, T>::insertEntry(Entry& entry, const UnsignedInt node) {
+    std::vector<Entry*>& entries = node == OutsideNode ? _outside : _nodes[node].entries;
+    entry.node = node;
+    entry.position = entries.size();
+    entries.push_back(&entry);
+
+    if(node != OutsideNode) for(UnsignedInt i = node; i != NoNode; i = _nodes[i].parent)
+        ++_nodes[i].count;
+}
+
+template<UnsignedInt dimensions, class Feature, class T> void SpatialIndex<dimensions, Feature, T>::unlinkEntry(Entry& entry) {
+    if(entry.node == NoNode) return;
+
+    /* Move the last entry of the node in place of the removed one */
+    std::vector<Entry*>& entries = entry.node == OutsideNode ? _outside : _nodes[entry.node].entries;
+    entries[entry.position] = entries.back();
+    entries[entry.position]->position = entry.position;
+    entries.pop_back();
+
+    if(entry.node != OutsideNode) for(UnsignedInt i = entry.node; i != NoNode; i = _nodes[i].parent)
+        --_nodes[i].count;
+    entry.node = NoNode;
+}
+
+template<UnsignedInt dimensions, class Feature, class T> void SpatialIndex<dimensions, Feature, T>::updateEntry(Entry& entry) {
+    const UnsignedInt node = nodeFor(entry.absoluteBounds);
+    if(node == entry.node) return;
+
+    unlinkEntry(entry);
+    insertEntry(entry, node);
+}
+
+template<UnsignedInt dimensions, class Feature, class T> void SpatialIndex<dimensions, Feature, T>::removeEntry(Entry& entry) {
+    unlinkEntry(entry);
+    _entries.erase(&entry.feature);
+}
+
+}}
+
+#endif
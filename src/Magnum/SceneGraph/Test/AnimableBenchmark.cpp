@@ -0,0 +1,117 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <memory>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Animable.h"
+#include "Magnum/SceneGraph/AnimableGroup.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/ThreadPool.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct AnimableBenchmark: TestSuite::Tester {
+    explicit AnimableBenchmark();
+
+    void step();
+    void stepParallel();
+
+    private:
+        void benchmarkStep(ThreadPool* pool);
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+
+namespace {
+    enum: std::size_t { StepDataCount = 3 };
+
+    constexpr struct {
+        const char* name;
+        std::size_t count, runningCount;
+    } StepData[StepDataCount]{
+        {"10k animables, 200 running", 10000, 200},
+        {"50k animables, 200 running", 50000, 200},
+        {"1M animables, 200 running", 1000000, 200}
+    };
+
+    class Animable: public SceneGraph::Animable3D {
+        public:
+            explicit Animable(AbstractObject3D& object, AnimableGroup3D& group): SceneGraph::Animable3D{object, &group}, sum{} {}
+
+            Float sum;
+
+        private:
+            void animationStep(Float time, Float) override {
+                sum += time;
+            }
+    };
+}
+
+AnimableBenchmark::AnimableBenchmark() {
+    addInstancedBenchmarks({&AnimableBenchmark::step,
+                            &AnimableBenchmark::stepParallel}, 10, StepDataCount);
+}
+
+void AnimableBenchmark::benchmarkStep(ThreadPool* const pool) {
+    const auto& data = StepData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Object3D object;
+    AnimableGroup3D group;
+    group.setThreadPool(pool);
+    std::vector<std::unique_ptr<Animable>> animables;
+    animables.reserve(data.count);
+    for(std::size_t i = 0; i != data.count; ++i)
+        animables.emplace_back(new Animable{object, group});
+
+    /* Running animables spread over the whole group */
+    const std::size_t stride = data.count/data.runningCount;
+    for(std::size_t i = 0; i != data.runningCount; ++i)
+        animables[i*stride]->setState(AnimationState::Running);
+
+    Float time = 1.0f;
+    group.step(time, 0.0f);
+
+    CORRADE_BENCHMARK(100) {
+        time += 0.01f;
+        group.step(time, 0.01f);
+    }
+
+    CORRADE_COMPARE(group.runningCount(), data.runningCount);
+    CORRADE_VERIFY(animables[stride]->sum != 0.0f);
+}
+
+void AnimableBenchmark::step() {
+    benchmarkStep(nullptr);
+}
+
+void AnimableBenchmark::stepParallel() {
+    ThreadPool pool;
+    benchmarkStep(&pool);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::AnimableBenchmark)
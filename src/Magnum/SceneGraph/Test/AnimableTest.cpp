@@ -23,12 +23,18 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <memory>
 #include <sstream>
+#include <thread>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/SceneGraph/Animable.h"
 #include "Magnum/SceneGraph/AnimableGroup.h"
+#include "Magnum/SceneGraph/FlatScene.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/ThreadPool.h"
 
 namespace Magnum { namespace SceneGraph { namespace Test {
 
@@ -41,11 +47,22 @@ struct AnimableTest: TestSuite::Tester {
     void repeat();
     void stop();
     void pause();
+    void stepManyStopped();
+    void stepGroupOrder();
+    void stepChainedFromCallback();
+    void destroyRunning();
+    void removeRunning();
+    void startFromCallback();
+    void destroyGroup();
+    void stepParallel();
+    void stepParallelTransform();
+    void stepParallelTransformFlat();
 
     void debug();
 };
 
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
 
 AnimableTest::AnimableTest() {
     addTests({&AnimableTest::state,
@@ -54,6 +71,16 @@ AnimableTest::AnimableTest() {
               &AnimableTest::repeat,
               &AnimableTest::stop,
               &AnimableTest::pause,
+              &AnimableTest::stepManyStopped,
+              &AnimableTest::stepGroupOrder,
+              &AnimableTest::stepChainedFromCallback,
+              &AnimableTest::destroyRunning,
+              &AnimableTest::removeRunning,
+              &AnimableTest::startFromCallback,
+              &AnimableTest::destroyGroup,
+              &AnimableTest::stepParallel,
+              &AnimableTest::stepParallelTransform,
+              &AnimableTest::stepParallelTransformFlat,
 
               &AnimableTest::debug});
 }
@@ -351,6 +378,434 @@ void AnimableTest::pause() {
     CORRADE_COMPARE(animable.time, 2.0f);
 }
 
+namespace {
+    class CountingAnimable: public SceneGraph::Animable3D {
+        public:
+            CountingAnimable(AbstractObject3D& object, AnimableGroup3D* group, Int& stepCount): SceneGraph::Animable3D(object, group), _stepCount(stepCount) {}
+
+        protected:
+            void animationStep(Float, Float) override { ++_stepCount; }
+
+        private:
+            Int& _stepCount;
+    };
+}
+
+void AnimableTest::stepManyStopped() {
+    Object3D object;
+    AnimableGroup3D group;
+    Int stepCount = 0;
+    std::vector<std::unique_ptr<CountingAnimable>> animables;
+    for(std::size_t i = 0; i != 100; ++i)
+        animables.emplace_back(new CountingAnimable{object, &group, stepCount});
+
+    /* Only the running ones are stepped, in any state order */
+    animables[70]->setState(AnimationState::Running);
+    animables[3]->setState(AnimationState::Running);
+    animables[50]->setState(AnimationState::Running);
+    group.step(1.0f, 0.5f);
+    CORRADE_COMPARE(stepCount, 3);
+    CORRADE_COMPARE(group.runningCount(), 3);
+
+    /* Stopping one in the middle of the list */
+    animables[3]->setState(AnimationState::Stopped);
+    animables[50]->setState(AnimationState::Paused);
+    animables[50]->setState(AnimationState::Running);
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(stepCount, 5);
+    CORRADE_COMPARE(group.runningCount(), 2);
+
+    /* Pausing and resuming */
+    animables[70]->setState(AnimationState::Paused);
+    group.step(2.0f, 0.5f);
+    CORRADE_COMPARE(stepCount, 6);
+    CORRADE_COMPARE(group.runningCount(), 1);
+
+    animables[70]->setState(AnimationState::Running);
+    animables[3]->setState(AnimationState::Running);
+    group.step(2.5f, 0.5f);
+    CORRADE_COMPARE(stepCount, 9);
+    CORRADE_COMPARE(group.runningCount(), 3);
+}
+
+namespace {
+    class OrderAnimable: public SceneGraph::Animable3D {
+        public:
+            OrderAnimable(AbstractObject3D& object, AnimableGroup3D* group, Int id, std::vector<Int>& order): SceneGraph::Animable3D(object, group), _id{id}, _order(order) {}
+
+        protected:
+            void animationStep(Float, Float) override { _order.push_back(_id); }
+            void animationStopped() override { _order.push_back(-_id); }
+
+        private:
+            Int _id;
+            std::vector<Int>& _order;
+    };
+}
+
+void AnimableTest::stepGroupOrder() {
+    Object3D object;
+    AnimableGroup3D group;
+    std::vector<Int> order;
+    std::vector<std::unique_ptr<OrderAnimable>> animables;
+    for(Int i = 0; i != 100; ++i)
+        animables.emplace_back(new OrderAnimable{object, &group, i, order});
+
+    /* Stepped in group order, not in the order they were started */
+    animables[70]->setState(AnimationState::Running);
+    animables[3]->setState(AnimationState::Running);
+    animables[50]->setState(AnimationState::Running);
+    group.step(1.0f, 0.5f);
+    CORRADE_COMPARE(order, (std::vector<Int>{3, 50, 70}));
+
+    /* Callbacks are in group order too, animables activated later are put
+       in their place */
+    animables[50]->setState(AnimationState::Stopped);
+    animables[10]->setState(AnimationState::Running);
+    animables[90]->setState(AnimationState::Running);
+    order.clear();
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(order, (std::vector<Int>{3, 10, -50, 70, 90}));
+
+    /* Removing a feature moves the last one in its place */
+    animables[99]->setState(AnimationState::Running);
+    group.remove(*animables[0]);
+    order.clear();
+    group.step(2.0f, 0.5f);
+    CORRADE_COMPARE(order, (std::vector<Int>{99, 3, 10, 70, 90}));
+}
+
+namespace {
+    class ChainAnimable: public SceneGraph::Animable3D {
+        public:
+            ChainAnimable(AbstractObject3D& object, AnimableGroup3D* group, Int id, std::vector<Int>& events, Float duration = 0.0f): SceneGraph::Animable3D(object, group), _id{id}, _events(events) {
+                setDuration(duration);
+            }
+
+            std::vector<ChainAnimable*> next;
+            std::vector<Float> stepTimes;
+
+        protected:
+            void animationStep(Float time, Float) override {
+                _events.push_back(_id);
+                stepTimes.push_back(time);
+            }
+            void animationStarted() override { _events.push_back(100 + _id); }
+            void animationStopped() override {
+                _events.push_back(-_id);
+                for(ChainAnimable* animable: next)
+                    animable->setState(AnimationState::Running);
+            }
+
+        private:
+            Int _id;
+            std::vector<Int>& _events;
+    };
+}
+
+void AnimableTest::stepChainedFromCallback() {
+    Object3D object;
+    AnimableGroup3D group;
+    std::vector<Int> events;
+    ChainAnimable c{object, &group, 0, events};
+    ChainAnimable a{object, &group, 1, events, 1.0f};
+    ChainAnimable b{object, &group, 2, events};
+    ChainAnimable d{object, &group, 3, events};
+    a.next = {&b, &c};
+
+    a.setState(AnimationState::Running);
+    d.setState(AnimationState::Running);
+    group.step(0.0f, 0.5f);
+    group.step(0.5f, 0.5f);
+    CORRADE_COMPARE(events, (std::vector<Int>{101, 1, 103, 3, 1, 3}));
+
+    /* Animable after the stopped one in the group is started in the same
+       step, without a gap. The one before it has to wait for the next step,
+       the same as if the whole group was iterated. */
+    events.clear();
+    group.step(1.5f, 1.0f);
+    CORRADE_COMPARE(events, (std::vector<Int>{-1, 102, 2, 3}));
+    CORRADE_COMPARE(group.runningCount(), 2);
+
+    events.clear();
+    group.step(2.0f, 0.5f);
+    CORRADE_COMPARE(events, (std::vector<Int>{100, 0, 2, 3}));
+    CORRADE_COMPARE(b.stepTimes, (std::vector<Float>{0.0f, 0.5f}));
+    CORRADE_COMPARE(group.runningCount(), 3);
+}
+
+void AnimableTest::destroyRunning() {
+    Object3D object;
+    AnimableGroup3D group;
+    Int stepCount = 0;
+    CountingAnimable a{object, &group, stepCount};
+    a.setState(AnimationState::Running);
+    {
+        CountingAnimable b{object, &group, stepCount};
+        b.setState(AnimationState::Running);
+        group.step(1.0f, 0.5f);
+        CORRADE_COMPARE(stepCount, 2);
+        CORRADE_COMPARE(group.runningCount(), 2);
+    }
+
+    CORRADE_COMPARE(group.runningCount(), 1);
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(stepCount, 3);
+
+    /* Animable with changed state destroyed before the step */
+    {
+        CountingAnimable b{object, &group, stepCount};
+        b.setState(AnimationState::Running);
+    }
+    group.step(2.0f, 0.5f);
+    CORRADE_COMPARE(stepCount, 4);
+    CORRADE_COMPARE(group.runningCount(), 1);
+}
+
+void AnimableTest::removeRunning() {
+    Object3D object;
+    AnimableGroup3D group, another;
+    Int stepCount = 0;
+    CountingAnimable a{object, &group, stepCount};
+    a.setState(AnimationState::Running);
+    group.step(1.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 1);
+
+    /* Removed animables are not stepped anymore */
+    group.remove(a);
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(stepCount, 1);
+    CORRADE_COMPARE(group.runningCount(), 0);
+
+    /* Running animable moved to another group continues there */
+    another.add(a);
+    group.step(2.0f, 0.5f);
+    another.step(2.0f, 0.5f);
+    CORRADE_COMPARE(stepCount, 2);
+    CORRADE_COMPARE(group.runningCount(), 0);
+    CORRADE_COMPARE(another.runningCount(), 1);
+
+    /* Moving back without any step in between */
+    group.add(a);
+    CORRADE_COMPARE(another.runningCount(), 0);
+    CORRADE_COMPARE(group.runningCount(), 1);
+    another.step(2.5f, 0.5f);
+    group.step(2.5f, 0.5f);
+    CORRADE_COMPARE(stepCount, 3);
+
+    a.setState(AnimationState::Stopped);
+    group.step(3.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 0);
+}
+
+void AnimableTest::startFromCallback() {
+    class StartingAnimable: public OneShotAnimable {
+        public:
+            StartingAnimable(AbstractObject3D& object, AnimableGroup3D* group, Animable3D& other): OneShotAnimable(object, group), _other(other) {}
+
+        protected:
+            void animationStopped() override {
+                OneShotAnimable::animationStopped();
+                _other.setState(AnimationState::Running);
+            }
+
+        private:
+            Animable3D& _other;
+    };
+
+    Object3D object;
+    AnimableGroup3D group;
+    Int stepCount = 0;
+    CountingAnimable other{object, &group, stepCount};
+    StartingAnimable animable{object, &group, other};
+
+    group.step(1.0f, 0.5f);
+    animable.setState(AnimationState::Stopped);
+
+    /* The state change from the callback is processed in next step */
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(animable.stateChanges, "started;stopped;");
+    CORRADE_COMPARE(stepCount, 0);
+    group.step(2.0f, 0.5f);
+    CORRADE_COMPARE(stepCount, 1);
+    CORRADE_COMPARE(group.runningCount(), 1);
+}
+
+void AnimableTest::destroyGroup() {
+    Object3D object;
+    Int stepCount = 0;
+    std::unique_ptr<AnimableGroup3D> group{new AnimableGroup3D};
+    CountingAnimable a{object, group.get(), stepCount};
+    a.setState(AnimationState::Running);
+    group->step(1.0f, 0.5f);
+
+    /* Destroying the animable after the group shouldn't crash */
+    group.reset();
+    CORRADE_VERIFY(!a.animables());
+}
+
+void AnimableTest::stepParallel() {
+    class ThreadAnimable: public SceneGraph::Animable3D {
+        public:
+            ThreadAnimable(AbstractObject3D& object, AnimableGroup3D& group, Int id, Float duration, std::vector<Int>& started, std::vector<Int>& stopped): SceneGraph::Animable3D(object, &group), id{id}, time{-1.0f}, callbackThreadsOk{true}, _mainThread{std::this_thread::get_id()}, _started(started), _stopped(stopped) {
+                setDuration(duration);
+            }
+
+            Int id;
+            Float time;
+            bool callbackThreadsOk;
+
+        protected:
+            void animationStep(Float t, Float) override { time = t; }
+
+            void animationStarted() override {
+                /* Called after the step and on the main thread */
+                callbackThreadsOk = callbackThreadsOk && time == 0.0f && std::this_thread::get_id() == _mainThread;
+                _started.push_back(id);
+            }
+
+            void animationStopped() override {
+                callbackThreadsOk = callbackThreadsOk && std::this_thread::get_id() == _mainThread;
+                _stopped.push_back(id);
+            }
+
+        private:
+            std::thread::id _mainThread;
+            std::vector<Int>& _started;
+            std::vector<Int>& _stopped;
+    };
+
+    ThreadPool pool{4};
+    Object3D object;
+    AnimableGroup3D group;
+    CORRADE_VERIFY(!group.threadPool());
+    group.setThreadPool(&pool);
+    CORRADE_VERIFY(group.threadPool() == &pool);
+
+    std::vector<Int> started, stopped, expectedStarted, expectedStopped;
+    std::vector<std::unique_ptr<ThreadAnimable>> animables;
+    for(Int i = 0; i != 1000; ++i) {
+        animables.emplace_back(new ThreadAnimable{object, group, i, i % 3 ? 0.0f : 1.0f, started, stopped});
+        if(i % 5) {
+            animables.back()->setState(AnimationState::Running);
+            expectedStarted.push_back(i);
+            if(i % 3 == 0) expectedStopped.push_back(i);
+        }
+    }
+
+    group.step(1.0f, 0.5f);
+    CORRADE_COMPARE(started, expectedStarted);
+    CORRADE_VERIFY(stopped.empty());
+    CORRADE_COMPARE(group.runningCount(), expectedStarted.size());
+
+    /* The order after removals from the active list is unspecified */
+    group.step(2.5f, 1.5f);
+    std::sort(stopped.begin(), stopped.end());
+    CORRADE_COMPARE(stopped, expectedStopped);
+    CORRADE_COMPARE(group.runningCount(), expectedStarted.size() - expectedStopped.size());
+
+    for(std::unique_ptr<ThreadAnimable>& animable: animables) {
+        CORRADE_VERIFY(animable->callbackThreadsOk);
+        if(animable->id % 5 == 0) CORRADE_COMPARE(animable->time, -1.0f);
+        else if(animable->id % 3 == 0) CORRADE_COMPARE(animable->time, 0.0f);
+        else CORRADE_COMPARE(animable->time, 1.5f);
+    }
+}
+
+namespace {
+    /* Moves its own object in every step */
+    template<class ObjectType> class TransformingAnimable: public SceneGraph::Animable3D {
+        public:
+            TransformingAnimable(ObjectType& object, AnimableGroup3D& group): SceneGraph::Animable3D(object, &group), _object(object) {
+                setState(AnimationState::Running);
+            }
+
+        protected:
+            void animationStep(Float time, Float) override {
+                _object.setTransformation(Matrix4::translation(Vector3::xAxis(time)));
+            }
+
+        private:
+            ObjectType& _object;
+    };
+
+    /* Records absolute transformation of the object when cleaned */
+    class CachingFeature: public AbstractFeature3D {
+        public:
+            CachingFeature(AbstractObject3D& object): AbstractFeature3D{object}, cleanCount{} {
+                setCachedTransformations(CachedTransformation::Absolute);
+            }
+
+            Matrix4 transformation;
+            Int cleanCount;
+
+        protected:
+            void clean(const Matrix4& absoluteTransformationMatrix) override {
+                transformation = absoluteTransformationMatrix;
+                ++cleanCount;
+            }
+    };
+}
+
+void AnimableTest::stepParallelTransform() {
+    ThreadPool pool{8};
+    Scene3D scene;
+    AnimableGroup3D group;
+    group.setThreadPool(&pool);
+
+    std::vector<Object3D*> objects;
+    std::vector<CachingFeature*> features;
+    for(std::size_t i = 0; i != 2000; ++i) {
+        objects.push_back(new Object3D{&scene});
+        features.push_back(new CachingFeature{*objects.back()});
+        new TransformingAnimable<Object3D>{*objects.back(), group};
+    }
+
+    /* Start all animations, clean the initial state */
+    group.step(1.0f, 0.5f);
+    scene.setSceneClean();
+    for(CachingFeature* feature: features) feature->cleanCount = 0;
+
+    /* Every object moved from the steps is marked dirty and put into the
+       dirty list of the scene, so cleaning the scene cleans all of them */
+    group.step(2.5f, 1.5f);
+    for(Object3D* object: objects) CORRADE_VERIFY(object->isDirty());
+    scene.setSceneClean();
+    for(std::size_t i = 0; i != objects.size(); ++i) {
+        CORRADE_VERIFY(!objects[i]->isDirty());
+        CORRADE_COMPARE(features[i]->cleanCount, 1);
+        CORRADE_COMPARE(features[i]->transformation, Matrix4::translation(Vector3::xAxis(1.5f)));
+    }
+}
+
+void AnimableTest::stepParallelTransformFlat() {
+    ThreadPool pool{8};
+    FlatScene3D scene;
+    AnimableGroup3D group;
+    group.setThreadPool(&pool);
+
+    std::vector<FlatObject3D*> objects;
+    std::vector<CachingFeature*> features;
+    for(std::size_t i = 0; i != 2000; ++i) {
+        objects.push_back(&scene.addObject());
+        features.push_back(new CachingFeature{*objects.back()});
+        new TransformingAnimable<FlatObject3D>{*objects.back(), group};
+    }
+
+    group.step(1.0f, 0.5f);
+    scene.setSceneClean();
+    for(CachingFeature* feature: features) feature->cleanCount = 0;
+
+    group.step(2.5f, 1.5f);
+    for(FlatObject3D* object: objects) CORRADE_VERIFY(object->isDirty());
+    scene.setSceneClean();
+    for(std::size_t i = 0; i != objects.size(); ++i) {
+        CORRADE_VERIFY(!objects[i]->isDirty());
+        CORRADE_COMPARE(features[i]->cleanCount, 1);
+        CORRADE_COMPARE(features[i]->transformation, Matrix4::translation(Vector3::xAxis(1.5f)));
+    }
+}
+
 void AnimableTest::debug() {
     std::ostringstream o;
     Debug(&o) << AnimationState::Running << AnimationState(0xbe);
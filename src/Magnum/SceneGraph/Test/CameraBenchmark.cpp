@@ -0,0 +1,210 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/FlatScene.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct CameraBenchmark: TestSuite::Tester {
+    explicit CameraBenchmark();
+
+    void draw();
+    void drawCulled();
+    void drawSorted();
+    void drawFlatScene();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+namespace {
+    enum: std::size_t { DrawDataCount = 4 };
+
+    /* Objects grouped under parents, scaling from 1k to 1M objects */
+    constexpr struct {
+        const char* name;
+        std::size_t parentCount, childCount;
+    } DrawData[DrawDataCount]{
+        {"1k objects", 1, 1000},
+        {"10k objects", 10, 1000},
+        {"100k objects", 100, 1000},
+        {"1M objects", 1000, 1000}
+    };
+
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            explicit Drawable(AbstractObject3D& object, DrawableGroup3D& group, Float& sum): SceneGraph::Drawable3D{object, &group}, _sum(sum) {}
+
+        private:
+            void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+                _sum += transformationMatrix.translation().x();
+            }
+
+            Float& _sum;
+    };
+}
+
+CameraBenchmark::CameraBenchmark() {
+    addInstancedBenchmarks({&CameraBenchmark::draw,
+                            &CameraBenchmark::drawCulled,
+                            &CameraBenchmark::drawSorted,
+                            &CameraBenchmark::drawFlatScene}, 3, DrawDataCount);
+}
+
+void CameraBenchmark::draw() {
+    const auto& data = DrawData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    DrawableGroup3D drawables;
+    Float sum{};
+    for(std::size_t i = 0; i != data.parentCount; ++i) {
+        Object3D* parent = new Object3D{&scene};
+        parent->translate(Vector3::xAxis(Float(i)));
+        for(std::size_t j = 0; j != data.childCount; ++j) {
+            Object3D* object = new Object3D{parent};
+            object->translate(Vector3::zAxis(Float(j)));
+            new Drawable{*object, drawables, sum};
+        }
+    }
+
+    Object3D cameraObject{&scene};
+    cameraObject.translate(Vector3::xAxis(-1.0f));
+    Camera3D camera{cameraObject};
+
+    CORRADE_BENCHMARK(1) {
+        camera.draw(drawables);
+    }
+
+    CORRADE_COMPARE(drawables.size(), data.parentCount*data.childCount);
+    CORRADE_VERIFY(sum != 0.0f);
+}
+
+void CameraBenchmark::drawCulled() {
+    const auto& data = DrawData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Every other object is behind the camera */
+    Scene3D scene;
+    DrawableGroup3D drawables;
+    Float sum{};
+    for(std::size_t i = 0; i != data.parentCount; ++i) {
+        Object3D* parent = new Object3D{&scene};
+        parent->translate(Vector3::xAxis(Float(i)));
+        for(std::size_t j = 0; j != data.childCount; ++j) {
+            Object3D* object = new Object3D{parent};
+            object->translate(Vector3::zAxis(j % 2 ? Float(j) : -Float(j) - 1.0f));
+            (new Drawable{*object, drawables, sum})->setBoundingSphere({}, 0.5f);
+        }
+    }
+
+    Object3D cameraObject{&scene};
+    cameraObject.translate(Vector3::xAxis(-1.0f));
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 10000.0f));
+
+    /* The first draw cleans the whole scene, measure only the steady state */
+    camera.draw(drawables);
+
+    CORRADE_BENCHMARK(1) {
+        camera.draw(drawables);
+    }
+
+    CORRADE_COMPARE(camera.drawnCount() + camera.culledCount(), data.parentCount*data.childCount);
+    CORRADE_VERIFY(camera.culledCount() >= drawables.size()/2);
+    CORRADE_VERIFY(sum != 0.0f);
+}
+
+void CameraBenchmark::drawSorted() {
+    const auto& data = DrawData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* 64 different states interleaved */
+    Scene3D scene;
+    DrawableGroup3D drawables;
+    Float sum{};
+    for(std::size_t i = 0; i != data.parentCount; ++i) {
+        Object3D* parent = new Object3D{&scene};
+        parent->translate(Vector3::xAxis(Float(i)));
+        for(std::size_t j = 0; j != data.childCount; ++j) {
+            Object3D* object = new Object3D{parent};
+            object->translate(Vector3::zAxis(-Float(j)));
+            (new Drawable{*object, drawables, sum})->setSortKey(j % 64);
+        }
+    }
+
+    Object3D cameraObject{&scene};
+    cameraObject.translate(Vector3::xAxis(-1.0f));
+    Camera3D camera{cameraObject};
+    camera.setSortingEnabled(true);
+
+    /* The first draw allocates memory for sorting, measure only the steady
+       state */
+    camera.draw(drawables);
+
+    CORRADE_BENCHMARK(1) {
+        camera.draw(drawables);
+    }
+
+    CORRADE_COMPARE(camera.stateChangeCount(), 63);
+    CORRADE_VERIFY(sum != 0.0f);
+}
+
+void CameraBenchmark::drawFlatScene() {
+    const auto& data = DrawData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    FlatScene3D scene;
+    scene.reserve(data.parentCount*(data.childCount + 1) + 1);
+    DrawableGroup3D drawables;
+    Float sum{};
+    for(std::size_t i = 0; i != data.parentCount; ++i) {
+        FlatObject3D& parent = scene.addObject(nullptr, Matrix4::translation(Vector3::xAxis(Float(i))));
+        for(std::size_t j = 0; j != data.childCount; ++j) {
+            FlatObject3D& object = scene.addObject(&parent, Matrix4::translation(Vector3::zAxis(Float(j))));
+            new Drawable{object, drawables, sum};
+        }
+    }
+
+    FlatObject3D& cameraObject = scene.addObject(nullptr, Matrix4::translation(Vector3::xAxis(-1.0f)));
+    Camera3D camera{cameraObject};
+
+    CORRADE_BENCHMARK(1) {
+        camera.draw(drawables);
+    }
+
+    CORRADE_COMPARE(drawables.size(), data.parentCount*data.childCount);
+    CORRADE_VERIFY(sum != 0.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraBenchmark)
@@ -23,6 +23,10 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <new>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/SceneGraph/Camera.hpp" /* only for aspectRatioFix(), so it doesn't have to be exported */
@@ -31,6 +35,35 @@
 #include "Magnum/SceneGraph/MatrixTransformation2D.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/SpatialIndex.h"
+
+/* Counting global allocator, used to verify that drawing doesn't allocate.
+   Counting is enabled only around the checked draws. The array forms
+   forward to these by default. With a shared library on Windows the
+   replacement doesn't see allocations done inside the DLL, so the check
+   there is weaker. */
+namespace {
+    bool countAllocations = false;
+    std::size_t allocationCount = 0;
+}
+
+void* operator new(std::size_t size) {
+    if(countAllocations) ++allocationCount;
+    if(void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc{};
+}
+
+/* GCC 11+ sees the inlined std::free() as a mismatch for operator new even
+   though both are replaced here */
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
 
 namespace Magnum { namespace SceneGraph { namespace Test {
 
@@ -46,10 +79,27 @@ struct CameraTest: TestSuite::Tester {
     void projectionSizePerspective();
     void projectionSizeViewport();
     void draw();
+    void drawCulled2D();
+    void drawCulled3D();
+    void drawCulledMoved();
+    void drawIndexed2D();
+    void drawIndexed3D();
+    void drawIndexedMoved();
+    void drawSorted2D();
+    void drawSorted3D();
+    void radixSort();
+    void drawInstanced();
+    void drawInstancedDefault();
+    void drawLod2D();
+    void drawLod3D();
+    void drawLodHysteresis();
+    void drawLodInstanced();
+    void drawNoAllocations();
 };
 
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
 typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
 
 CameraTest::CameraTest() {
@@ -61,7 +111,23 @@ CameraTest::CameraTest() {
               &CameraTest::projectionSizeOrthographic,
               &CameraTest::projectionSizePerspective,
               &CameraTest::projectionSizeViewport,
-              &CameraTest::draw});
+              &CameraTest::draw,
+              &CameraTest::drawCulled2D,
+              &CameraTest::drawCulled3D,
+              &CameraTest::drawCulledMoved,
+              &CameraTest::drawIndexed2D,
+              &CameraTest::drawIndexed3D,
+              &CameraTest::drawIndexedMoved,
+              &CameraTest::drawSorted2D,
+              &CameraTest::drawSorted3D,
+              &CameraTest::radixSort,
+              &CameraTest::drawInstanced,
+              &CameraTest::drawInstancedDefault,
+              &CameraTest::drawLod2D,
+              &CameraTest::drawLod3D,
+              &CameraTest::drawLodHysteresis,
+              &CameraTest::drawLodInstanced,
+              &CameraTest::drawNoAllocations});
 }
 
 void CameraTest::fixAspectRatio() {
@@ -210,6 +276,612 @@ void CameraTest::draw() {
     CORRADE_COMPARE(thirdTransformation, Matrix4());
 }
 
+namespace {
+    template<UnsignedInt dimensions> class OrderDrawable: public SceneGraph::Drawable<dimensions, Float> {
+        public:
+            OrderDrawable(SceneGraph::AbstractObject<dimensions, Float>& object, SceneGraph::DrawableGroup<dimensions, Float>& group, Int id, std::vector<Int>& drawn): SceneGraph::Drawable<dimensions, Float>{object, &group}, _id{id}, _drawn(drawn) {}
+
+        protected:
+            void draw(const MatrixTypeFor<dimensions, Float>&, SceneGraph::Camera<dimensions, Float>&) override {
+                _drawn.push_back(_id);
+            }
+
+        private:
+            Int _id;
+            std::vector<Int>& _drawn;
+    };
+}
+
+void CameraTest::drawCulled2D() {
+    Scene2D scene;
+    Object2D cameraObject{&scene};
+    cameraObject.translate({10.0f, 0.0f});
+    Camera2D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix3::projection({4.0f, 2.0f}));
+
+    DrawableGroup2D group;
+    std::vector<Int> drawn;
+
+    /* Inside */
+    Object2D a{&scene};
+    a.translate({10.0f, 0.5f});
+    (new OrderDrawable<2>{a, group, 0, drawn})->setBoundingSphere({}, 0.1f);
+
+    /* Outside, but the scaled sphere touches the view volume */
+    Object2D b{&scene};
+    b.scale(Vector2{2.0f}).translate({13.5f, 0.0f});
+    (new OrderDrawable<2>{b, group, 1, drawn})->setBoundingSphere({}, 1.0f);
+
+    /* Outside of the view volume */
+    Object2D c{&scene};
+    c.translate({10.0f, 2.0f});
+    (new OrderDrawable<2>{c, group, 2, drawn})->setBoundingSphere({}, 0.5f);
+
+    /* No bounding sphere, always drawn */
+    Object2D d{&scene};
+    d.translate({-100.0f, 0.0f});
+    new OrderDrawable<2>{d, group, 3, drawn};
+
+    /* Box far from the origin, outside */
+    Object2D e{&scene};
+    e.translate({10.0f, 0.0f});
+    (new OrderDrawable<2>{e, group, 4, drawn})->setBoundingBox({{2.5f, -0.5f}, {3.5f, 0.5f}});
+
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{0, 1, 3}));
+    CORRADE_COMPARE(camera.drawnCount(), 3);
+    CORRADE_COMPARE(camera.culledCount(), 2);
+}
+
+void CameraTest::drawCulled3D() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    cameraObject.translate(Vector3::zAxis(5.0f));
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f));
+
+    DrawableGroup3D group;
+    std::vector<Int> drawn;
+
+    /* More than 32 spheres to test the mask, every third is behind the
+       camera and every fifth has no sphere */
+    std::vector<std::unique_ptr<Object3D>> objects;
+    std::vector<Int> expected;
+    for(Int i = 0; i != 40; ++i) {
+        objects.emplace_back(new Object3D{&scene});
+        objects.back()->translate(Vector3::zAxis(i % 3 ? -5.0f : 10.0f));
+        auto drawable = new OrderDrawable<3>{*objects.back(), group, i, drawn};
+        if(i % 5) drawable->setBoundingSphere({}, 1.0f);
+        if(i % 3 == 0 && i % 5) continue;
+        expected.push_back(i);
+    }
+
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, expected);
+    CORRADE_COMPARE(camera.drawnCount(), expected.size());
+    CORRADE_COMPARE(camera.culledCount(), 40 - expected.size());
+}
+
+void CameraTest::drawCulledMoved() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+
+    DrawableGroup3D group;
+    std::vector<Int> drawn;
+
+    Object3D parent{&scene};
+    Object3D object{&parent};
+    (new OrderDrawable<3>{object, group, 0, drawn})->setBoundingSphere({}, 0.5f);
+
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, std::vector<Int>{0});
+
+    /* Moving the parent out of the view volume should update the sphere */
+    parent.translate(Vector3::xAxis(2.0f));
+    drawn.clear();
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, std::vector<Int>{});
+    CORRADE_COMPARE(camera.culledCount(), 1);
+
+    /* Moving the camera after it should make it visible again */
+    cameraObject.translate(Vector3::xAxis(2.0f));
+    drawn.clear();
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, std::vector<Int>{0});
+    CORRADE_COMPARE(camera.culledCount(), 0);
+}
+
+void CameraTest::drawIndexed2D() {
+    Scene2D scene;
+    Object2D cameraObject{&scene};
+    cameraObject.translate({10.0f, 0.0f});
+    Camera2D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix3::projection({4.0f, 2.0f}));
+
+    DrawableGroup2D group;
+    DrawableIndex2D index{{Vector2{-20.0f}, Vector2{20.0f}}};
+    std::vector<Int> drawn;
+
+    /* Inside */
+    Object2D a{&scene};
+    a.translate({10.0f, 0.5f});
+    index.add(*new OrderDrawable<2>{a, group, 0, drawn}, {Vector2{-0.1f}, Vector2{0.1f}});
+
+    /* Outside, but the scaled box touches the view volume */
+    Object2D b{&scene};
+    b.scale(Vector2{2.0f}).translate({13.5f, 0.0f});
+    index.add(*new OrderDrawable<2>{b, group, 1, drawn}, {Vector2{-1.0f}, Vector2{1.0f}});
+
+    /* Outside of the view volume */
+    Object2D c{&scene};
+    c.translate({10.0f, 2.0f});
+    index.add(*new OrderDrawable<2>{c, group, 2, drawn}, {Vector2{-0.5f}, Vector2{0.5f}});
+
+    /* Outside of the index bounds, outside of the view volume */
+    Object2D d{&scene};
+    d.translate({-100.0f, 0.0f});
+    index.add(*new OrderDrawable<2>{d, group, 3, drawn}, {Vector2{-0.5f}, Vector2{0.5f}});
+
+    /* Not in the index, never drawn */
+    Object2D e{&scene};
+    e.translate({10.0f, 0.0f});
+    new OrderDrawable<2>{e, group, 4, drawn};
+
+    camera.draw(index);
+    std::sort(drawn.begin(), drawn.end());
+    CORRADE_COMPARE(drawn, (std::vector<Int>{0, 1}));
+    CORRADE_COMPARE(camera.drawnCount(), 2);
+    CORRADE_COMPARE(camera.culledCount(), 2);
+}
+
+void CameraTest::drawIndexed3D() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    cameraObject.translate(Vector3::zAxis(5.0f));
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f));
+
+    DrawableGroup3D group;
+    DrawableIndex3D index{{Vector3{-50.0f}, Vector3{50.0f}}};
+    std::vector<Int> drawn;
+
+    /* Every third is behind the camera, the rest is spread along the X axis
+       and only the ones close to the view axis are visible */
+    std::vector<Int> expected;
+    for(Int i = 0; i != 40; ++i) {
+        Object3D* object = new Object3D{&scene};
+        object->translate({Float(i % 10)*4.0f - 18.0f, 0.0f, i % 3 ? -5.0f : 10.0f});
+        index.add(*new OrderDrawable<3>{*object, group, i, drawn}, {Vector3{-0.5f}, Vector3{0.5f}});
+        if(i % 3 == 0 || i % 10 < 2 || i % 10 > 7) continue;
+        expected.push_back(i);
+    }
+
+    camera.draw(index);
+    std::sort(drawn.begin(), drawn.end());
+    CORRADE_COMPARE(drawn, expected);
+    CORRADE_COMPARE(camera.drawnCount(), expected.size());
+    CORRADE_COMPARE(camera.culledCount(), 40 - expected.size());
+}
+
+void CameraTest::drawIndexedMoved() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+
+    DrawableGroup3D group;
+    DrawableIndex3D index{{Vector3{-10.0f}, Vector3{10.0f}}};
+    std::vector<Int> drawn;
+
+    Object3D parent{&scene};
+    Object3D object{&parent};
+    index.add(*new OrderDrawable<3>{object, group, 0, drawn}, {Vector3{-0.5f}, Vector3{0.5f}});
+
+    camera.draw(index);
+    CORRADE_COMPARE(drawn, std::vector<Int>{0});
+
+    /* Moving the parent out of the view volume should update the index */
+    parent.translate(Vector3::xAxis(2.0f));
+    drawn.clear();
+    camera.draw(index);
+    CORRADE_COMPARE(drawn, std::vector<Int>{});
+    CORRADE_COMPARE(camera.culledCount(), 1);
+
+    /* Moving the camera after it should make it visible again */
+    cameraObject.translate(Vector3::xAxis(2.0f));
+    drawn.clear();
+    camera.draw(index);
+    CORRADE_COMPARE(drawn, std::vector<Int>{0});
+    CORRADE_COMPARE(camera.culledCount(), 0);
+}
+
+void CameraTest::drawSorted2D() {
+    Scene2D scene;
+    Object2D cameraObject{&scene};
+    Camera2D camera{cameraObject};
+    CORRADE_VERIFY(!camera.isSortingEnabled());
+
+    DrawableGroup2D group;
+    std::vector<Int> drawn;
+    Object2D object{&scene};
+    const UnsignedInt keys[]{3, 1, 3, 0x10000, 1, 3};
+    for(Int i = 0; i != 6; ++i)
+        (new OrderDrawable<2>{object, group, i, drawn})->setSortKey(keys[i]);
+
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{0, 1, 2, 3, 4, 5}));
+    CORRADE_COMPARE(camera.stateChangeCount(), 5);
+    CORRADE_COMPARE(camera.avoidedStateChangeCount(), 0);
+
+    /* Drawables with the same key are kept in group order */
+    drawn.clear();
+    camera.setSortingEnabled(true);
+    CORRADE_VERIFY(camera.isSortingEnabled());
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{1, 4, 0, 2, 5, 3}));
+    CORRADE_COMPARE(camera.stateChangeCount(), 2);
+    CORRADE_COMPARE(camera.avoidedStateChangeCount(), 3);
+}
+
+void CameraTest::drawSorted3D() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setSortingEnabled(true);
+
+    DrawableGroup3D group;
+    std::vector<Int> drawn;
+
+    const struct {
+        UnsignedInt key;
+        bool transparent;
+        Float distance;
+    } data[]{
+        {2, false, 1.0f},
+        {1, true, 2.0f},
+        {1, false, 3.0f},
+        {2, false, 0.5f},
+        {0, true, 5.0f},
+        {1, false, 0.25f},
+        {1, true, 2.0f},
+        /* Behind the camera, treated as zero distance */
+        {2, false, -1.0f}
+    };
+
+    std::vector<std::unique_ptr<Object3D>> objects;
+    for(Int i = 0; i != 8; ++i) {
+        objects.emplace_back(new Object3D{&scene});
+        objects.back()->translate(Vector3::zAxis(-data[i].distance));
+        (new OrderDrawable<3>{*objects.back(), group, i, drawn})
+            ->setSortKey(data[i].key)
+            .setTransparent(data[i].transparent);
+    }
+
+    /* Opaque ones sorted by key and front-to-back, then transparent ones
+       back-to-front and by key */
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{5, 2, 7, 3, 0, 4, 1, 6}));
+}
+
+void CameraTest::radixSort() {
+    std::vector<Implementation::DrawSortItem> items, scratch;
+    UnsignedLong key = 0x123456789abcdefull;
+    for(UnsignedInt i = 0; i != 1000; ++i) {
+        /* Every key twice to verify stability */
+        key = key*6364136223846793005ull + 1442695040888963407ull;
+        items.push_back({key, 2*i});
+        items.push_back({key, 2*i + 1});
+    }
+
+    Implementation::radixSort(items, scratch);
+    CORRADE_COMPARE(items.size(), 2000);
+    for(std::size_t i = 1; i != items.size(); ++i) {
+        CORRADE_VERIFY(items[i - 1].key <= items[i].key);
+        if(items[i - 1].key == items[i].key)
+            CORRADE_VERIFY(items[i - 1].index < items[i].index);
+    }
+}
+
+namespace {
+    class InstancedDrawable: public SceneGraph::Drawable3D {
+        public:
+            InstancedDrawable(AbstractObject3D& object, DrawableGroup3D& group, Int id, std::vector<std::pair<Int, std::vector<Float>>>& drawn): SceneGraph::Drawable3D{object, &group}, _id{id}, _drawn(drawn) {}
+
+        protected:
+            void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+                _drawn.emplace_back(_id, std::vector<Float>{transformationMatrix.translation().x()});
+            }
+
+            void drawInstanced(Containers::ArrayView<const Matrix4> transformationMatrices, Camera3D&) override {
+                std::vector<Float> translations;
+                for(const Matrix4& transformationMatrix: transformationMatrices)
+                    translations.push_back(transformationMatrix.translation().x());
+                _drawn.emplace_back(_id, translations);
+            }
+
+        private:
+            Int _id;
+            std::vector<std::pair<Int, std::vector<Float>>>& _drawn;
+    };
+}
+
+void CameraTest::drawInstanced() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    CORRADE_VERIFY(!camera.isInstancingEnabled());
+
+    DrawableGroup3D group;
+    std::vector<std::pair<Int, std::vector<Float>>> drawn;
+    const UnsignedLong keys[]{7, 7, 0, 0, 3, 7, 3};
+    std::vector<std::unique_ptr<Object3D>> objects;
+    for(Int i = 0; i != 7; ++i) {
+        objects.emplace_back(new Object3D{&scene});
+        objects.back()->translate(Vector3::xAxis(Float(i)));
+        (new InstancedDrawable{*objects.back(), group, i, drawn})
+            ->setInstanceKey(keys[i])
+            .setSortKey(keys[i]);
+    }
+
+    camera.draw(group);
+    CORRADE_COMPARE(drawn.size(), 7);
+    CORRADE_COMPARE(camera.drawCallCount(), 7);
+
+    /* Only consecutive drawables with the same nonzero key are instanced */
+    drawn.clear();
+    camera.setInstancingEnabled(true);
+    CORRADE_VERIFY(camera.isInstancingEnabled());
+    camera.draw(group);
+    CORRADE_COMPARE(camera.drawCallCount(), 6);
+    CORRADE_COMPARE(drawn.size(), 6);
+    CORRADE_COMPARE(drawn[0].first, 0);
+    CORRADE_COMPARE(drawn[0].second, (std::vector<Float>{0.0f, 1.0f}));
+    CORRADE_COMPARE(drawn[1].first, 2);
+    CORRADE_COMPARE(drawn[2].first, 3);
+    CORRADE_COMPARE(drawn[5].first, 6);
+
+    /* With sorting all drawables with the same key are drawn at once */
+    drawn.clear();
+    camera.setSortingEnabled(true);
+    camera.draw(group);
+    CORRADE_COMPARE(camera.drawnCount(), 7);
+    CORRADE_COMPARE(camera.drawCallCount(), 4);
+    CORRADE_COMPARE(drawn.size(), 4);
+    CORRADE_COMPARE(drawn[2].first, 4);
+    CORRADE_COMPARE(drawn[2].second, (std::vector<Float>{4.0f, 6.0f}));
+    CORRADE_COMPARE(drawn[3].first, 0);
+    CORRADE_COMPARE(drawn[3].second, (std::vector<Float>{0.0f, 1.0f, 5.0f}));
+}
+
+void CameraTest::drawInstancedDefault() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setInstancingEnabled(true);
+
+    /* Default implementation of drawInstanced() calls draw() for each */
+    DrawableGroup3D group;
+    std::vector<Int> drawn;
+    Object3D object{&scene};
+    for(Int i = 0; i != 3; ++i)
+        (new OrderDrawable<3>{object, group, i, drawn})->setInstanceKey(1);
+
+    camera.draw(group);
+    CORRADE_COMPARE(camera.drawCallCount(), 1);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{0, 0, 0}));
+}
+
+void CameraTest::drawLod2D() {
+    Scene2D scene;
+    Object2D cameraObject{&scene};
+    Camera2D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix3::projection({4.0f, 4.0f}));
+
+    DrawableGroup2D group;
+    std::vector<Int> drawn;
+    Object2D object{&scene};
+    auto drawable = new OrderDrawable<2>{object, group, 0, drawn};
+    drawable->setBoundingSphere({}, 1.0f)
+        .setLodThresholds({0.6f, 0.4f});
+    CORRADE_COMPARE(drawable->lodCount(), 3);
+    CORRADE_COMPARE(drawable->lodThresholds().size(), 2);
+
+    /* Sphere diameter is half of the viewport height */
+    camera.draw(group);
+    CORRADE_COMPARE(drawable->lod(), 1);
+
+    camera.setProjectionMatrix(Matrix3::projection({10.0f, 10.0f}));
+    camera.draw(group);
+    CORRADE_COMPARE(drawable->lod(), 2);
+    CORRADE_COMPARE(camera.lodDrawnCount(0), 0);
+    CORRADE_COMPARE(camera.lodDrawnCount(2), 1);
+}
+
+void CameraTest::drawLod3D() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    /* Projected size of an unit sphere is inverse of its distance */
+    DrawableGroup3D group;
+    std::vector<Int> drawn;
+    Object3D near{&scene}, middle{&scene}, far{&scene};
+    near.translate(Vector3::zAxis(-1.0f));
+    middle.translate(Vector3::zAxis(-5.0f));
+    far.translate(Vector3::zAxis(-12.0f));
+    Drawable3D* drawables[]{
+        &(new OrderDrawable<3>{near, group, 0, drawn})->setBoundingSphere({}, 1.0f).setLodThresholds({0.5f, 0.1f}),
+        &(new OrderDrawable<3>{middle, group, 1, drawn})->setBoundingSphere({}, 1.0f).setLodThresholds({0.5f, 0.1f}),
+        &(new OrderDrawable<3>{far, group, 2, drawn})->setBoundingSphere({}, 1.0f).setLodThresholds({0.5f, 0.1f}),
+        /* Without thresholds and without bounding sphere */
+        &(new OrderDrawable<3>{far, group, 3, drawn})->setBoundingSphere({}, 1.0f),
+        &(new OrderDrawable<3>{far, group, 4, drawn})->setLodThresholds({0.5f, 0.1f})};
+
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{0, 1, 2, 3, 4}));
+    CORRADE_COMPARE(drawables[0]->lod(), 0);
+    CORRADE_COMPARE(drawables[1]->lod(), 1);
+    CORRADE_COMPARE(drawables[2]->lod(), 2);
+    CORRADE_COMPARE(drawables[3]->lod(), 0);
+    CORRADE_COMPARE(drawables[4]->lod(), 0);
+    CORRADE_COMPARE(camera.lodDrawnCount(0), 3);
+    CORRADE_COMPARE(camera.lodDrawnCount(1), 1);
+    CORRADE_COMPARE(camera.lodDrawnCount(2), 1);
+    CORRADE_COMPARE(camera.lodDrawnCount(3), 0);
+
+    /* Moving the camera closer changes the levels */
+    cameraObject.translate(Vector3::zAxis(-4.5f));
+    camera.draw(group);
+    CORRADE_COMPARE(drawables[1]->lod(), 0);
+    CORRADE_COMPARE(drawables[2]->lod(), 1);
+
+    /* Sphere containing the camera center is the most detailed */
+    cameraObject.translate(Vector3::zAxis(-0.5f));
+    camera.draw(group);
+    CORRADE_COMPARE(drawables[1]->lod(), 0);
+
+    /* Setting the thresholds resets the level */
+    drawables[2]->setLodThresholds({0.5f});
+    CORRADE_COMPARE(drawables[2]->lod(), 0);
+}
+
+void CameraTest::drawLodHysteresis() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f))
+        .setLodHysteresis(0.2f);
+    CORRADE_COMPARE(camera.lodHysteresis(), 0.2f);
+
+    DrawableGroup3D group;
+    std::vector<Int> drawn;
+    Object3D object{&scene};
+    auto drawable = new OrderDrawable<3>{object, group, 0, drawn};
+    drawable->setBoundingSphere({}, 1.0f)
+        .setLodThresholds({0.5f});
+
+    /* Size 0.526 */
+    object.setTransformation(Matrix4::translation(Vector3::zAxis(-1.9f)));
+    camera.draw(group);
+    CORRADE_COMPARE(drawable->lod(), 0);
+
+    /* Size 0.455, below the threshold but not enough */
+    object.setTransformation(Matrix4::translation(Vector3::zAxis(-2.2f)));
+    camera.draw(group);
+    CORRADE_COMPARE(drawable->lod(), 0);
+
+    /* Size 0.385 */
+    object.setTransformation(Matrix4::translation(Vector3::zAxis(-2.6f)));
+    camera.draw(group);
+    CORRADE_COMPARE(drawable->lod(), 1);
+
+    /* Size 0.526 again, above the threshold but not enough */
+    object.setTransformation(Matrix4::translation(Vector3::zAxis(-1.9f)));
+    camera.draw(group);
+    CORRADE_COMPARE(drawable->lod(), 1);
+
+    /* Size 0.667 */
+    object.setTransformation(Matrix4::translation(Vector3::zAxis(-1.5f)));
+    camera.draw(group);
+    CORRADE_COMPARE(drawable->lod(), 0);
+}
+
+void CameraTest::drawLodInstanced() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f))
+        .setInstancingEnabled(true);
+
+    /* Two drawables near and two far, all with the same instance key */
+    DrawableGroup3D group;
+    std::vector<std::pair<Int, std::vector<Float>>> drawn;
+    std::vector<std::unique_ptr<Object3D>> objects;
+    for(Int i = 0; i != 4; ++i) {
+        objects.emplace_back(new Object3D{&scene});
+        objects.back()->translate({Float(i), 0.0f, i < 2 ? -2.0f : -10.0f});
+        (new InstancedDrawable{*objects.back(), group, i, drawn})
+            ->setInstanceKey(1)
+            .setBoundingSphere({}, 1.0f)
+            .setLodThresholds({0.3f});
+    }
+
+    /* Drawables with different level are not drawn together */
+    camera.draw(group);
+    CORRADE_COMPARE(camera.drawCallCount(), 2);
+    CORRADE_COMPARE(camera.lodDrawnCount(0), 2);
+    CORRADE_COMPARE(camera.lodDrawnCount(1), 2);
+    CORRADE_COMPARE(drawn.size(), 2);
+    CORRADE_COMPARE(drawn[0].first, 0);
+    CORRADE_COMPARE(drawn[0].second, (std::vector<Float>{0.0f, 1.0f}));
+    CORRADE_COMPARE(drawn[1].first, 2);
+    CORRADE_COMPARE(drawn[1].second, (std::vector<Float>{2.0f, 3.0f}));
+}
+
+namespace {
+    class CountingDrawable: public SceneGraph::Drawable3D {
+        public:
+            CountingDrawable(AbstractObject3D& object, DrawableGroup3D& group, std::size_t& count): SceneGraph::Drawable3D{object, &group}, _count(count) {}
+
+        protected:
+            void draw(const Matrix4&, Camera3D&) override { ++_count; }
+            void drawInstanced(Containers::ArrayView<const Matrix4> transformationMatrices, Camera3D&) override {
+                _count += transformationMatrices.size();
+            }
+
+        private:
+            std::size_t& _count;
+    };
+}
+
+void CameraTest::drawNoAllocations() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    cameraObject.translate(Vector3::zAxis(5.0f));
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f))
+        .setSortingEnabled(true)
+        .setInstancingEnabled(true);
+
+    /* Nested objects, some culled, some with instance key or detail levels,
+       some without bounding sphere. The objects are owned by the scene. */
+    DrawableGroup3D group;
+    std::size_t drawn = 0;
+    std::vector<Object3D*> objects;
+    for(Int i = 0; i != 100; ++i) {
+        objects.push_back(new Object3D{i % 4 ? objects.back() : &scene});
+        objects.back()->translate(Vector3::xAxis(i % 3 ? 0.1f : 50.0f));
+        auto drawable = new CountingDrawable{*objects.back(), group, drawn};
+        drawable->setSortKey(i % 7)
+            .setInstanceKey(i % 2 ? i % 5 + 1 : 0);
+        if(i % 5) drawable->setBoundingSphere({}, 1.0f);
+        if(i % 3) drawable->setLodThresholds({0.5f, 0.1f});
+    }
+
+    /* First draw allocates the temporary storage */
+    camera.draw(group);
+    const std::size_t drawnCount = camera.drawnCount();
+    CORRADE_VERIFY(camera.culledCount());
+    CORRADE_COMPARE(drawn, drawnCount);
+
+    /* Subsequent draws don't allocate anything, even if the objects and the
+       camera moved */
+    countAllocations = true;
+    allocationCount = 0;
+    camera.draw(group);
+    objects[3]->translate(Vector3::yAxis(0.5f));
+    objects[42]->translate(Vector3::yAxis(-0.5f));
+    cameraObject.translate(Vector3::zAxis(0.5f));
+    camera.draw(group);
+    camera.draw(group);
+    countAllocations = false;
+
+    CORRADE_COMPARE(allocationCount, 0);
+    CORRADE_COMPARE(camera.drawnCount(), drawnCount);
+    CORRADE_COMPARE(drawn, 4*drawnCount);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraTest)
@@ -0,0 +1,133 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <memory>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AbstractGroupedFeature.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct FeatureGroupBenchmark: TestSuite::Tester {
+    explicit FeatureGroupBenchmark();
+
+    void addRemove();
+    void addRemoveOrderPreserved();
+    void destroy();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+namespace {
+    enum: std::size_t { FeatureDataCount = 3 };
+
+    constexpr struct {
+        const char* name;
+        std::size_t count;
+    } FeatureData[FeatureDataCount]{
+        {"10k features", 10000},
+        {"100k features", 100000},
+        {"1M features", 1000000}
+    };
+
+    class Feature: public AbstractGroupedFeature3D<Feature> {
+        public:
+            explicit Feature(AbstractObject3D& object, FeatureGroup3D<Feature>* group = nullptr): AbstractGroupedFeature3D<Feature>{object, group} {}
+    };
+}
+
+FeatureGroupBenchmark::FeatureGroupBenchmark() {
+    addInstancedBenchmarks({&FeatureGroupBenchmark::addRemove,
+                            &FeatureGroupBenchmark::addRemoveOrderPreserved,
+                            &FeatureGroupBenchmark::destroy}, 3, FeatureDataCount);
+}
+
+void FeatureGroupBenchmark::addRemove() {
+    const auto& data = FeatureData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    Object3D object{&scene};
+    std::vector<std::unique_ptr<Feature>> features;
+    features.reserve(data.count);
+    for(std::size_t i = 0; i != data.count; ++i)
+        features.emplace_back(new Feature{object});
+
+    FeatureGroup3D<Feature> group;
+    CORRADE_BENCHMARK(1) {
+        for(std::unique_ptr<Feature>& feature: features) group.add(*feature);
+        for(std::unique_ptr<Feature>& feature: features) group.remove(*feature);
+    }
+
+    CORRADE_VERIFY(group.isEmpty());
+}
+
+void FeatureGroupBenchmark::addRemoveOrderPreserved() {
+    const auto& data = FeatureData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    Object3D object{&scene};
+    std::vector<std::unique_ptr<Feature>> features;
+    features.reserve(data.count);
+    for(std::size_t i = 0; i != data.count; ++i)
+        features.emplace_back(new Feature{object});
+
+    FeatureGroup3D<Feature> group;
+    group.setOrderPreserved(true);
+    CORRADE_BENCHMARK(1) {
+        for(std::unique_ptr<Feature>& feature: features) group.add(*feature);
+        for(std::unique_ptr<Feature>& feature: features) group.remove(*feature);
+    }
+
+    CORRADE_VERIFY(group.isEmpty());
+}
+
+void FeatureGroupBenchmark::destroy() {
+    const auto& data = FeatureData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group;
+    std::vector<std::unique_ptr<Feature>> features;
+    features.reserve(data.count);
+    for(std::size_t i = 0; i != data.count; ++i)
+        features.emplace_back(new Feature{object, &group});
+
+    /* Features are destroyed in creation order, which was the worst case for
+       linear search */
+    CORRADE_BENCHMARK(1) {
+        features.clear();
+    }
+
+    CORRADE_VERIFY(group.isEmpty());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FeatureGroupBenchmark)
@@ -0,0 +1,254 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <memory>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AbstractGroupedFeature.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct FeatureGroupTest: TestSuite::Tester {
+    explicit FeatureGroupTest();
+
+    void add();
+    void addFromOtherGroup();
+    void remove();
+    void removeLast();
+    void removeOrderPreserved();
+    void removeOrderPreservedAddAfter();
+    void setOrderPreserved();
+    void featureDestroyed();
+    void groupDestroyed();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+namespace {
+    class Feature: public AbstractGroupedFeature3D<Feature> {
+        public:
+            explicit Feature(AbstractObject3D& object, FeatureGroup3D<Feature>* group = nullptr): AbstractGroupedFeature3D<Feature>{object, group} {}
+    };
+
+    std::vector<Feature*> contents(const FeatureGroup3D<Feature>& group) {
+        std::vector<Feature*> out;
+        for(std::size_t i = 0; i != group.size(); ++i)
+            out.push_back(const_cast<Feature*>(&group[i]));
+        return out;
+    }
+}
+
+FeatureGroupTest::FeatureGroupTest() {
+    addTests({&FeatureGroupTest::add,
+              &FeatureGroupTest::addFromOtherGroup,
+              &FeatureGroupTest::remove,
+              &FeatureGroupTest::removeLast,
+              &FeatureGroupTest::removeOrderPreserved,
+              &FeatureGroupTest::removeOrderPreservedAddAfter,
+              &FeatureGroupTest::setOrderPreserved,
+              &FeatureGroupTest::featureDestroyed,
+              &FeatureGroupTest::groupDestroyed});
+}
+
+void FeatureGroupTest::add() {
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group;
+    CORRADE_VERIFY(group.isEmpty());
+
+    Feature a{object, &group};
+    Feature b{object};
+    group.add(b);
+
+    CORRADE_VERIFY(!group.isEmpty());
+    CORRADE_COMPARE(contents(group), (std::vector<Feature*>{&a, &b}));
+    CORRADE_VERIFY(a.group() == &group);
+    CORRADE_VERIFY(b.group() == &group);
+}
+
+void FeatureGroupTest::addFromOtherGroup() {
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group1, group2;
+
+    Feature a{object, &group1};
+    Feature b{object, &group1};
+    Feature c{object, &group1};
+    group2.add(a);
+
+    CORRADE_COMPARE(contents(group1), (std::vector<Feature*>{&c, &b}));
+    CORRADE_COMPARE(contents(group2), std::vector<Feature*>{&a});
+    CORRADE_VERIFY(a.group() == &group2);
+
+    /* The moved feature has its index updated */
+    group1.remove(c);
+    CORRADE_COMPARE(contents(group1), std::vector<Feature*>{&b});
+}
+
+void FeatureGroupTest::remove() {
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group;
+
+    Feature a{object, &group};
+    Feature b{object, &group};
+    Feature c{object, &group};
+    Feature d{object, &group};
+
+    /* Last feature is moved in place of the removed one */
+    group.remove(b);
+    CORRADE_COMPARE(contents(group), (std::vector<Feature*>{&a, &d, &c}));
+    CORRADE_VERIFY(!b.group());
+
+    group.remove(a)
+         .remove(d);
+    CORRADE_COMPARE(contents(group), std::vector<Feature*>{&c});
+
+    group.remove(c);
+    CORRADE_VERIFY(group.isEmpty());
+}
+
+void FeatureGroupTest::removeLast() {
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group;
+
+    Feature a{object, &group};
+    Feature b{object, &group};
+
+    group.remove(b);
+    CORRADE_COMPARE(contents(group), std::vector<Feature*>{&a});
+
+    group.add(b);
+    group.remove(a);
+    CORRADE_COMPARE(contents(group), std::vector<Feature*>{&b});
+}
+
+void FeatureGroupTest::removeOrderPreserved() {
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group;
+    group.setOrderPreserved(true);
+    CORRADE_VERIFY(group.isOrderPreserved());
+
+    Feature a{object, &group};
+    Feature b{object, &group};
+    Feature c{object, &group};
+    Feature d{object, &group};
+
+    /* Removing more features before the group is compacted */
+    group.remove(b)
+         .remove(a);
+    CORRADE_VERIFY(!a.group());
+    CORRADE_COMPARE(contents(group), (std::vector<Feature*>{&c, &d}));
+
+    /* Indices are updated after compaction */
+    group.remove(d);
+    CORRADE_COMPARE(contents(group), std::vector<Feature*>{&c});
+}
+
+void FeatureGroupTest::removeOrderPreservedAddAfter() {
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group;
+    group.setOrderPreserved(true);
+
+    Feature a{object, &group};
+    Feature b{object, &group};
+    Feature c{object, &group};
+
+    /* Adding a feature before the group is compacted */
+    group.remove(a);
+    Feature d{object, &group};
+    group.remove(c);
+    CORRADE_COMPARE(contents(group), (std::vector<Feature*>{&b, &d}));
+
+    /* Re-adding moves the feature to the end */
+    group.add(b);
+    CORRADE_COMPARE(contents(group), (std::vector<Feature*>{&d, &b}));
+}
+
+void FeatureGroupTest::setOrderPreserved() {
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group;
+    CORRADE_VERIFY(!group.isOrderPreserved());
+    group.setOrderPreserved(true);
+
+    Feature a{object, &group};
+    Feature b{object, &group};
+    Feature c{object, &group};
+    Feature d{object, &group};
+
+    /* Disabling the order preservation compacts the group first */
+    group.remove(a);
+    group.setOrderPreserved(false);
+    CORRADE_VERIFY(!group.isOrderPreserved());
+    group.remove(b);
+    CORRADE_COMPARE(contents(group), (std::vector<Feature*>{&d, &c}));
+}
+
+void FeatureGroupTest::featureDestroyed() {
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group, orderedGroup;
+    orderedGroup.setOrderPreserved(true);
+
+    Feature a{object, &group};
+    Feature b{object, &orderedGroup};
+    {
+        Feature c{object, &group};
+        Feature d{object, &orderedGroup};
+        Feature e{object, &group};
+        Feature f{object, &orderedGroup};
+    }
+
+    CORRADE_COMPARE(contents(group), std::vector<Feature*>{&a});
+    CORRADE_COMPARE(contents(orderedGroup), std::vector<Feature*>{&b});
+}
+
+void FeatureGroupTest::groupDestroyed() {
+    Scene3D scene;
+    Object3D object{&scene};
+    Feature a{object};
+    Feature b{object};
+    {
+        FeatureGroup3D<Feature> group;
+        group.setOrderPreserved(true);
+        group.add(a);
+        group.add(b);
+        group.remove(a);
+        group.add(a);
+    }
+
+    CORRADE_VERIFY(!a.group());
+    CORRADE_VERIFY(!b.group());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FeatureGroupTest)
@@ -0,0 +1,110 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/FlatScene.h"
+#include "Magnum/SceneGraph/ThreadPool.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct FlatSceneBenchmark: TestSuite::Tester {
+    explicit FlatSceneBenchmark();
+
+    void update();
+    void updateParallel();
+};
+
+namespace {
+    enum: std::size_t { UpdateDataCount = 3 };
+
+    /* All parents move every frame */
+    constexpr struct {
+        const char* name;
+        std::size_t parentCount, childCount;
+    } UpdateData[UpdateDataCount]{
+        {"10k objects", 10, 1000},
+        {"100k objects", 100, 1000},
+        {"1M objects", 1000, 1000}
+    };
+
+    void populate(FlatScene3D& scene, std::size_t parentCount, std::size_t childCount) {
+        scene.reserve(parentCount*(childCount + 1));
+        for(std::size_t i = 0; i != parentCount; ++i) {
+            FlatObject3D& parent = scene.addObject(nullptr, Matrix4::translation(Vector3::xAxis(Float(i))));
+            for(std::size_t j = 0; j != childCount; ++j)
+                scene.addObject(&parent, Matrix4::rotationY(Deg(Float(j))));
+        }
+    }
+}
+
+FlatSceneBenchmark::FlatSceneBenchmark() {
+    addInstancedBenchmarks({&FlatSceneBenchmark::update,
+                            &FlatSceneBenchmark::updateParallel}, 3, UpdateDataCount);
+}
+
+void FlatSceneBenchmark::update() {
+    const auto& data = UpdateData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    FlatScene3D scene;
+    populate(scene, data.parentCount, data.childCount);
+    scene.update();
+
+    Float offset{};
+    CORRADE_BENCHMARK(1) {
+        offset += 1.0f;
+        for(std::size_t i = 0; i != data.parentCount; ++i)
+            scene.object(i*(data.childCount + 1)).setTransformation(Matrix4::translation(Vector3::yAxis(offset)));
+        scene.update();
+    }
+
+    CORRADE_COMPARE(scene.absoluteTransformations().back().translation().y(), offset);
+}
+
+void FlatSceneBenchmark::updateParallel() {
+    const auto& data = UpdateData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ThreadPool pool;
+    FlatScene3D scene;
+    scene.setThreadPool(&pool);
+    populate(scene, data.parentCount, data.childCount);
+    scene.update();
+
+    Float offset{};
+    CORRADE_BENCHMARK(1) {
+        offset += 1.0f;
+        for(std::size_t i = 0; i != data.parentCount; ++i)
+            scene.object(i*(data.childCount + 1)).setTransformation(Matrix4::translation(Vector3::yAxis(offset)));
+        scene.update();
+    }
+
+    CORRADE_COMPARE(scene.absoluteTransformations().back().translation().y(), offset);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatSceneBenchmark)
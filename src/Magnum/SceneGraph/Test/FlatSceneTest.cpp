@@ -0,0 +1,387 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/FlatScene.h"
+#include "Magnum/SceneGraph/ThreadPool.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct FlatSceneTest: TestSuite::Tester {
+    explicit FlatSceneTest();
+
+    void addObject();
+    void addObjectWrongParent();
+    void absoluteTransformations();
+    void update();
+    void updateParallel();
+    void transformationMatrices();
+    void transformationMatricesRelative();
+    void setClean();
+    void setCleanList();
+    void setSceneClean();
+    void draw();
+};
+
+namespace {
+    class CachingFeature: public AbstractFeature3D {
+        public:
+            explicit CachingFeature(AbstractObject3D& object): AbstractFeature3D{object} {
+                setCachedTransformations(CachedTransformation::Absolute|CachedTransformation::InvertedAbsolute);
+            }
+
+            Int dirtyCount = 0;
+            Matrix4 cleanedAbsoluteTransformation{Math::ZeroInit};
+            Matrix4 cleanedInvertedAbsoluteTransformation{Math::ZeroInit};
+
+        private:
+            void markDirty() override { ++dirtyCount; }
+
+            void clean(const Matrix4& absoluteTransformation) override {
+                cleanedAbsoluteTransformation = absoluteTransformation;
+            }
+
+            void cleanInverted(const Matrix4& invertedAbsoluteTransformation) override {
+                cleanedInvertedAbsoluteTransformation = invertedAbsoluteTransformation;
+            }
+    };
+}
+
+FlatSceneTest::FlatSceneTest() {
+    addTests({&FlatSceneTest::addObject,
+              &FlatSceneTest::addObjectWrongParent,
+              &FlatSceneTest::absoluteTransformations,
+              &FlatSceneTest::update,
+              &FlatSceneTest::updateParallel,
+              &FlatSceneTest::transformationMatrices,
+              &FlatSceneTest::transformationMatricesRelative,
+              &FlatSceneTest::setClean,
+              &FlatSceneTest::setCleanList,
+              &FlatSceneTest::setSceneClean,
+              &FlatSceneTest::draw});
+}
+
+void FlatSceneTest::addObject() {
+    FlatScene3D scene;
+    CORRADE_COMPARE(scene.objectCount(), 0);
+
+    FlatObject3D& a = scene.addObject();
+    FlatObject3D& b = scene.addObject(&a, Matrix4::translation(Vector3::xAxis(1.0f)));
+    FlatObject3D& c = scene.addObject(&a);
+
+    CORRADE_COMPARE(scene.objectCount(), 3);
+    CORRADE_COMPARE(a.id(), 0);
+    CORRADE_COMPARE(b.id(), 1);
+    CORRADE_COMPARE(c.id(), 2);
+    CORRADE_COMPARE(&scene.object(1), &b);
+    CORRADE_COMPARE(a.scene(), &scene);
+    CORRADE_COMPARE(static_cast<AbstractObject3D&>(b).scene(), &scene);
+
+    CORRADE_VERIFY(!a.parent());
+    CORRADE_COMPARE(b.parent(), &a);
+    CORRADE_COMPARE(c.parent(), &a);
+    CORRADE_COMPARE(scene.parents(), (std::vector<UnsignedInt>{FlatScene3D::NoParent, 0, 0}));
+
+    CORRADE_COMPARE(a.transformation(), Matrix4());
+    CORRADE_COMPARE(b.transformation(), Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(b.transformationMatrix(), Matrix4::translation(Vector3::xAxis(1.0f)));
+}
+
+void FlatSceneTest::addObjectWrongParent() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    FlatScene3D scene;
+    FlatScene3D another;
+    FlatObject3D& a = another.addObject();
+    scene.addObject(&a);
+
+    CORRADE_COMPARE(scene.objectCount(), 0);
+    CORRADE_COMPARE(out.str(), "SceneGraph::FlatScene::addObject(): parent is not part of this scene\n");
+}
+
+void FlatSceneTest::absoluteTransformations() {
+    FlatScene3D scene;
+    FlatObject3D& a = scene.addObject(nullptr, Matrix4::rotationZ(Deg(30.0f)));
+    FlatObject3D& b = scene.addObject(&a, Matrix4::scaling(Vector3(0.5f)));
+    scene.addObject(&b, Matrix4::translation(Vector3::xAxis(5.0f)));
+    scene.addObject(nullptr, Matrix4::translation(Vector3::yAxis(2.0f)));
+
+    CORRADE_COMPARE(scene.absoluteTransformations(), (std::vector<Matrix4>{
+        Matrix4::rotationZ(Deg(30.0f)),
+        Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f)),
+        Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f))*Matrix4::translation(Vector3::xAxis(5.0f)),
+        Matrix4::translation(Vector3::yAxis(2.0f))
+    }));
+    CORRADE_COMPARE(b.absoluteTransformation(), Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f)));
+    CORRADE_COMPARE(b.absoluteTransformationMatrix(), Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f)));
+
+    /* Change of parent transformation is propagated to children */
+    a.setTransformation(Matrix4::translation(Vector3::zAxis(1.0f)));
+    CORRADE_COMPARE(scene.absoluteTransformations(), (std::vector<Matrix4>{
+        Matrix4::translation(Vector3::zAxis(1.0f)),
+        Matrix4::translation(Vector3::zAxis(1.0f))*Matrix4::scaling(Vector3(0.5f)),
+        Matrix4::translation(Vector3::zAxis(1.0f))*Matrix4::scaling(Vector3(0.5f))*Matrix4::translation(Vector3::xAxis(5.0f)),
+        Matrix4::translation(Vector3::yAxis(2.0f))
+    }));
+}
+
+void FlatSceneTest::update() {
+    FlatScene3D scene;
+    FlatObject3D& a = scene.addObject();
+    FlatObject3D& b = scene.addObject(&a);
+    FlatObject3D& c = scene.addObject();
+    CachingFeature& fa = a.addFeature<CachingFeature>();
+    CachingFeature& fb = b.addFeature<CachingFeature>();
+    CachingFeature& fc = c.addFeature<CachingFeature>();
+
+    /* Objects are dirty by default, markDirty() is not called for them */
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_VERIFY(c.isDirty());
+    CORRADE_COMPARE(fa.dirtyCount, 0);
+
+    a.setClean();
+    b.setClean();
+    c.setClean();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+
+    /* Changing transformation marks the object and its children as dirty in
+       the next update, siblings are untouched */
+    a.setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(fa.dirtyCount, 0);
+    scene.update();
+    CORRADE_COMPARE(fa.dirtyCount, 1);
+    CORRADE_COMPARE(fb.dirtyCount, 1);
+    CORRADE_COMPARE(fc.dirtyCount, 0);
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+
+    /* Marking an already dirty object doesn't call markDirty() again */
+    b.setDirty();
+    scene.update();
+    CORRADE_COMPARE(fb.dirtyCount, 1);
+
+    /* Explicit dirty marking of a clean object */
+    c.setDirty();
+    CORRADE_VERIFY(c.isDirty());
+    CORRADE_COMPARE(fc.dirtyCount, 1);
+}
+
+void FlatSceneTest::updateParallel() {
+    ThreadPool pool{4};
+    FlatScene3D serial;
+    FlatScene3D parallel;
+    parallel.setThreadPool(&pool);
+    CORRADE_COMPARE(parallel.threadPool(), &pool);
+
+    /* Wide hierarchy three levels deep, large enough to use the parallel
+       path */
+    for(FlatScene3D* scene: {&serial, &parallel}) {
+        for(Int i = 0; i != 10; ++i) {
+            FlatObject3D& root = scene->addObject(nullptr, Matrix4::rotationY(Deg(i*36.0f)));
+            for(Int j = 0; j != 100; ++j) {
+                FlatObject3D& child = scene->addObject(&root, Matrix4::translation(Vector3::xAxis(j*0.5f)));
+                for(Int k = 0; k != 10; ++k)
+                    scene->addObject(&child, Matrix4::rotationZ(Deg(k*10.0f))*Matrix4::scaling(Vector3(1.0f + k*0.1f)));
+            }
+        }
+    }
+    CORRADE_COMPARE(parallel.objectCount(), 11010);
+
+    CachingFeature& serialFeature = serial.object(11009).addFeature<CachingFeature>();
+    CachingFeature& parallelFeature = parallel.object(11009).addFeature<CachingFeature>();
+    serial.object(11009).setClean();
+    parallel.object(11009).setClean();
+    parallel.object(1200).setClean();
+
+    CORRADE_COMPARE(parallel.absoluteTransformations(), serial.absoluteTransformations());
+
+    /* Changed objects and their subtrees are updated and marked as dirty,
+       other objects are untouched */
+    serial.object(9*1101).setTransformation(Matrix4::translation(Vector3::yAxis(3.0f)));
+    parallel.object(9*1101).setTransformation(Matrix4::translation(Vector3::yAxis(3.0f)));
+    serial.object(1).setTransformation(Matrix4::scaling(Vector3(2.0f)));
+    parallel.object(1).setTransformation(Matrix4::scaling(Vector3(2.0f)));
+    CORRADE_COMPARE(parallel.absoluteTransformations(), serial.absoluteTransformations());
+    CORRADE_COMPARE(parallelFeature.dirtyCount, 1);
+    CORRADE_COMPARE(serialFeature.dirtyCount, 1);
+    CORRADE_VERIFY(parallel.object(11009).isDirty());
+    CORRADE_VERIFY(!parallel.object(1200).isDirty());
+}
+
+void FlatSceneTest::transformationMatrices() {
+    FlatScene3D scene;
+    FlatObject3D& a = scene.addObject(nullptr, Matrix4::rotationZ(Deg(30.0f)));
+    FlatObject3D& b = scene.addObject(&a, Matrix4::scaling(Vector3(0.5f)));
+    FlatObject3D& c = scene.addObject(nullptr, Matrix4::translation(Vector3::xAxis(5.0f)));
+
+    const Matrix4 initial = Matrix4::rotationX(Deg(90.0f)).inverted();
+    CORRADE_COMPARE(scene.transformationMatrices({c, b, scene, b}, initial), (std::vector<Matrix4>{
+        initial*Matrix4::translation(Vector3::xAxis(5.0f)),
+        initial*Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f)),
+        initial,
+        initial*Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f))
+    }));
+}
+
+void FlatSceneTest::transformationMatricesRelative() {
+    FlatScene3D scene;
+    FlatObject3D& a = scene.addObject(nullptr, Matrix4::rotationZ(Deg(30.0f)));
+    FlatObject3D& b = scene.addObject(&a, Matrix4::scaling(Vector3(0.5f)));
+    FlatObject3D& c = scene.addObject(&a, Matrix4::translation(Vector3::xAxis(5.0f)));
+
+    CORRADE_COMPARE(b.transformationMatrices({c}), std::vector<Matrix4>{
+        Matrix4::scaling(Vector3(0.5f)).inverted()*Matrix4::translation(Vector3::xAxis(5.0f))
+    });
+}
+
+void FlatSceneTest::setClean() {
+    FlatScene3D scene;
+    FlatObject3D& a = scene.addObject(nullptr, Matrix4::scaling(Vector3(2.0f)));
+    FlatObject3D& b = scene.addObject(&a, Matrix4::translation(Vector3::xAxis(1.0f)));
+    FlatObject3D& c = scene.addObject(&b, Matrix4::rotationY(Deg(90.0f)));
+    CachingFeature& fa = a.addFeature<CachingFeature>();
+    CachingFeature& fb = b.addFeature<CachingFeature>();
+
+    /* Clean the object and all its dirty parents (but not children) */
+    b.setClean();
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(c.isDirty());
+
+    /* Verify the right matrices were passed */
+    CORRADE_COMPARE(fa.cleanedAbsoluteTransformation, Matrix4::scaling(Vector3(2.0f)));
+    CORRADE_COMPARE(fb.cleanedAbsoluteTransformation, b.absoluteTransformation());
+    CORRADE_COMPARE(fb.cleanedInvertedAbsoluteTransformation, b.absoluteTransformation().inverted());
+
+    /* If the object is already clean, it shouldn't clean it again */
+    fa.cleanedAbsoluteTransformation = Matrix4{Math::ZeroInit};
+    b.setTransformation(Matrix4::translation(Vector3::xAxis(3.0f)));
+    b.setClean();
+    CORRADE_COMPARE(fa.cleanedAbsoluteTransformation, Matrix4{Math::ZeroInit});
+    CORRADE_COMPARE(fb.cleanedAbsoluteTransformation, Matrix4::scaling(Vector3(2.0f))*Matrix4::translation(Vector3::xAxis(3.0f)));
+}
+
+void FlatSceneTest::setCleanList() {
+    FlatScene3D scene;
+    FlatObject3D& a = scene.addObject(nullptr, Matrix4::scaling(Vector3(2.0f)));
+    FlatObject3D& b = scene.addObject(&a, Matrix4::translation(Vector3::xAxis(1.0f)));
+    FlatObject3D& c = scene.addObject(nullptr, Matrix4::rotationY(Deg(90.0f)));
+    CachingFeature& fb = b.addFeature<CachingFeature>();
+    CachingFeature& fc = c.addFeature<CachingFeature>();
+
+    AbstractObject3D::setClean({b, c, scene});
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(fb.cleanedAbsoluteTransformation, Matrix4::scaling(Vector3(2.0f))*Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(fc.cleanedAbsoluteTransformation, Matrix4::rotationY(Deg(90.0f)));
+}
+
+void FlatSceneTest::setSceneClean() {
+    FlatScene3D scene;
+    FlatObject3D& a = scene.addObject(nullptr, Matrix4::scaling(Vector3(2.0f)));
+    FlatObject3D& b = scene.addObject(&a, Matrix4::translation(Vector3::xAxis(1.0f)));
+    FlatObject3D& c = scene.addObject(nullptr, Matrix4::rotationY(Deg(90.0f)));
+    CachingFeature& fb = b.addFeature<CachingFeature>();
+    CachingFeature& fc = c.addFeature<CachingFeature>();
+
+    /* All objects are dirty at first */
+    b.setSceneClean();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(fb.cleanedAbsoluteTransformation, Matrix4::scaling(Vector3(2.0f))*Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(fc.cleanedAbsoluteTransformation, Matrix4::rotationY(Deg(90.0f)));
+
+    /* Only changed objects are cleaned again, also if some of them were
+       cleaned individually in the meantime */
+    fc.cleanedAbsoluteTransformation = Matrix4{Math::ZeroInit};
+    a.setTransformation(Matrix4::scaling(Vector3(3.0f)));
+    b.setClean();
+    fb.cleanedAbsoluteTransformation = Matrix4{Math::ZeroInit};
+    a.setTransformation(Matrix4::scaling(Vector3(4.0f)));
+    scene.setSceneClean();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_COMPARE(fb.cleanedAbsoluteTransformation, Matrix4::scaling(Vector3(4.0f))*Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(fc.cleanedAbsoluteTransformation, Matrix4{Math::ZeroInit});
+    CORRADE_COMPARE(fb.dirtyCount, 2);
+}
+
+void FlatSceneTest::draw() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            explicit Drawable(AbstractObject3D& object, DrawableGroup3D& group, Matrix4& result): SceneGraph::Drawable3D{object, &group}, _result(result) {}
+
+        private:
+            void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+                _result = transformationMatrix;
+            }
+
+            Matrix4& _result;
+    };
+
+    DrawableGroup3D group;
+    FlatScene3D scene;
+
+    Matrix4 firstTransformation;
+    FlatObject3D& first = scene.addObject(nullptr, Matrix4::scaling(Vector3(5.0f)));
+    new Drawable{first, group, firstTransformation};
+
+    Matrix4 secondTransformation;
+    FlatObject3D& second = scene.addObject(nullptr, Matrix4::translation(Vector3::yAxis(3.0f)));
+    new Drawable{second, group, secondTransformation};
+
+    Matrix4 thirdTransformation;
+    FlatObject3D& third = scene.addObject(&second, Matrix4::translation(Vector3::zAxis(-1.5f)));
+    new Drawable{third, group, thirdTransformation};
+
+    Camera3D camera{third};
+    camera.draw(group);
+
+    CORRADE_COMPARE(firstTransformation, Matrix4::translation({0.0f, -3.0f, 1.5f})*Matrix4::scaling(Vector3(5.0f)));
+    CORRADE_COMPARE(secondTransformation, Matrix4::translation(Vector3::zAxis(1.5f)));
+    CORRADE_COMPARE(thirdTransformation, Matrix4());
+
+    /* Moving the camera updates the camera matrix */
+    third.setTransformation(Matrix4::translation(Vector3::zAxis(1.5f)));
+    camera.draw(group);
+    CORRADE_COMPARE(thirdTransformation, Matrix4());
+    CORRADE_COMPARE(secondTransformation, Matrix4::translation(Vector3::zAxis(-1.5f)));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatSceneTest)
@@ -0,0 +1,137 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct ObjectBenchmark: TestSuite::Tester {
+    explicit ObjectBenchmark();
+
+    void setCleanList();
+    void setSceneClean();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+namespace {
+    enum: std::size_t { CleanDataCount = 3 };
+
+    /* Objects grouped under parents, one in hundred moves every frame */
+    constexpr struct {
+        const char* name;
+        std::size_t parentCount, childCount;
+    } CleanData[CleanDataCount]{
+        {"10k objects, 1% moving", 10, 1000},
+        {"100k objects, 1% moving", 100, 1000},
+        {"1M objects, 1% moving", 1000, 1000}
+    };
+
+    class CachingFeature: public AbstractFeature3D {
+        public:
+            explicit CachingFeature(AbstractObject3D& object, Float& sum): AbstractFeature3D{object}, _sum(sum) {
+                setCachedTransformations(CachedTransformation::Absolute);
+            }
+
+        private:
+            void clean(const Matrix4& absoluteTransformation) override {
+                _sum += absoluteTransformation.translation().y();
+            }
+
+            Float& _sum;
+    };
+
+    std::vector<Object3D*> populate(Scene3D& scene, std::size_t parentCount, std::size_t childCount, Float& sum) {
+        std::vector<Object3D*> moving;
+        for(std::size_t i = 0; i != parentCount; ++i) {
+            Object3D* parent = new Object3D{&scene};
+            parent->translate(Vector3::xAxis(Float(i)));
+            for(std::size_t j = 0; j != childCount; ++j) {
+                Object3D* object = new Object3D{parent};
+                object->translate(Vector3::zAxis(Float(j)));
+                new CachingFeature{*object, sum};
+                if(j % 100 == 0) moving.push_back(object);
+            }
+        }
+
+        return moving;
+    }
+}
+
+ObjectBenchmark::ObjectBenchmark() {
+    addInstancedBenchmarks({&ObjectBenchmark::setCleanList,
+                            &ObjectBenchmark::setSceneClean}, 3, CleanDataCount);
+}
+
+void ObjectBenchmark::setCleanList() {
+    const auto& data = CleanData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    Float sum{};
+    std::vector<Object3D*> moving = populate(scene, data.parentCount, data.childCount, sum);
+    scene.setSceneClean();
+
+    /* Cleaning all objects in the scene, as was done with a list of all
+       objects in a feature group */
+    CORRADE_BENCHMARK(1) {
+        for(Object3D* object: moving) object->translate(Vector3::yAxis(1.0f));
+
+        std::vector<std::reference_wrapper<Object3D>> objects;
+        objects.reserve(data.parentCount*data.childCount);
+        for(Object3D& parent: scene.children())
+            for(Object3D& object: parent.children())
+                objects.push_back(object);
+        Object3D::setClean(std::move(objects));
+    }
+
+    CORRADE_VERIFY(sum != 0.0f);
+}
+
+void ObjectBenchmark::setSceneClean() {
+    const auto& data = CleanData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    Float sum{};
+    std::vector<Object3D*> moving = populate(scene, data.parentCount, data.childCount, sum);
+    scene.setSceneClean();
+
+    CORRADE_BENCHMARK(1) {
+        for(Object3D* object: moving) object->translate(Vector3::yAxis(1.0f));
+        scene.setSceneClean();
+    }
+
+    CORRADE_VERIFY(sum != 0.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ObjectBenchmark)
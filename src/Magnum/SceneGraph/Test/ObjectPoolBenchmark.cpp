@@ -0,0 +1,172 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <memory>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct ObjectPoolBenchmark: TestSuite::Tester {
+    explicit ObjectPoolBenchmark();
+
+    void setSceneClean();
+    void draw();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+namespace {
+    enum: std::size_t { DataCount = 4 };
+
+    /* Objects grouped under parents, each with a caching feature and a
+       drawable */
+    constexpr struct {
+        const char* name;
+        std::size_t parentCount, childCount;
+        bool pooled;
+    } Data[DataCount]{
+        {"10k objects, heap", 10, 1000, false},
+        {"10k objects, pooled", 10, 1000, true},
+        {"100k objects, heap", 100, 1000, false},
+        {"100k objects, pooled", 100, 1000, true}
+    };
+
+    class CachingFeature: public AbstractFeature3D {
+        public:
+            explicit CachingFeature(AbstractObject3D& object, Float& sum): AbstractFeature3D{object}, _sum(sum) {
+                setCachedTransformations(CachedTransformation::Absolute);
+            }
+
+        private:
+            void clean(const Matrix4& absoluteTransformation) override {
+                _sum += absoluteTransformation.translation().y();
+            }
+
+            Float& _sum;
+    };
+
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            explicit Drawable(AbstractObject3D& object, DrawableGroup3D& group, Float& sum): SceneGraph::Drawable3D{object, &group}, _sum(sum) {}
+
+        private:
+            void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+                _sum += transformationMatrix.translation().x();
+            }
+
+            Float& _sum;
+    };
+
+    template<class U, class ...Args> U& create(Scene3D& scene, bool pooled, Args&&... args) {
+        return pooled ? scene.pool().create<U>(std::forward<Args>(args)...) :
+            *new U{std::forward<Args>(args)...};
+    }
+
+    /* Other allocations happening in between, as in a real application, so
+       the heap-allocated objects don't end up next to each other */
+    std::vector<Object3D*> populate(Scene3D& scene, DrawableGroup3D& drawables, std::size_t parentCount, std::size_t childCount, bool pooled, Float& sum, std::vector<std::unique_ptr<char[]>>& noise) {
+        std::vector<Object3D*> parents;
+        for(std::size_t i = 0; i != parentCount; ++i) {
+            Object3D& parent = create<Object3D>(scene, pooled, &scene);
+            parent.translate(Vector3::xAxis(Float(i)));
+            parents.push_back(&parent);
+            for(std::size_t j = 0; j != childCount; ++j) {
+                Object3D& object = create<Object3D>(scene, pooled, &parent);
+                object.translate(Vector3::zAxis(Float(j)));
+                noise.emplace_back(new char[64 + (j*7919) % 512]);
+                create<CachingFeature>(scene, pooled, object, sum);
+                noise.emplace_back(new char[64 + (j*104729) % 512]);
+                create<Drawable>(scene, pooled, object, drawables, sum);
+            }
+        }
+
+        /* Free every other noise allocation to leave holes */
+        for(std::size_t i = 0; i < noise.size(); i += 2) noise[i] = nullptr;
+
+        return parents;
+    }
+}
+
+ObjectPoolBenchmark::ObjectPoolBenchmark() {
+    addInstancedBenchmarks({&ObjectPoolBenchmark::setSceneClean,
+                            &ObjectPoolBenchmark::draw}, 5, DataCount);
+}
+
+void ObjectPoolBenchmark::setSceneClean() {
+    const auto& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    DrawableGroup3D drawables;
+    std::vector<std::unique_ptr<char[]>> noise;
+    Float sum{};
+    std::vector<Object3D*> parents = populate(scene, drawables, data.parentCount, data.childCount, data.pooled, sum, noise);
+    scene.setSceneClean();
+
+    /* Moving the parents makes the whole hierarchy dirty */
+    CORRADE_BENCHMARK(1) {
+        for(Object3D* parent: parents) parent->translate(Vector3::yAxis(0.1f));
+        scene.setSceneClean();
+    }
+
+    CORRADE_COMPARE(scene.pool().size(), data.pooled ? data.parentCount*(1 + 3*data.childCount) : 0);
+    CORRADE_VERIFY(sum != 0.0f);
+}
+
+void ObjectPoolBenchmark::draw() {
+    const auto& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    DrawableGroup3D drawables;
+    std::vector<std::unique_ptr<char[]>> noise;
+    Float sum{};
+    populate(scene, drawables, data.parentCount, data.childCount, data.pooled, sum, noise);
+
+    Object3D cameraObject{&scene};
+    cameraObject.translate(Vector3::xAxis(-1.0f));
+    Camera3D camera{cameraObject};
+
+    /* The first draw cleans the whole scene, measure only the steady state */
+    camera.draw(drawables);
+
+    CORRADE_BENCHMARK(1) {
+        camera.draw(drawables);
+    }
+
+    CORRADE_COMPARE(drawables.size(), data.parentCount*data.childCount);
+    CORRADE_VERIFY(sum != 0.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ObjectPoolBenchmark)
@@ -0,0 +1,244 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct ObjectPoolTest: TestSuite::Tester {
+    explicit ObjectPoolTest();
+
+    void construct();
+    void create();
+    void createFeature();
+    void slabs();
+    void slabsLarge();
+    void clear();
+    void clearHierarchy();
+    void clearHeapChildren();
+    void scene();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+namespace {
+    class CountedObject: public Object3D {
+        public:
+            explicit CountedObject(Object3D* parent, std::vector<Int>& destroyed, Int id): Object3D{parent}, _destroyed(destroyed), _id{id} {}
+
+            ~CountedObject() { _destroyed.push_back(_id); }
+
+        private:
+            std::vector<Int>& _destroyed;
+            Int _id;
+    };
+
+    class CountedFeature: public AbstractFeature3D {
+        public:
+            explicit CountedFeature(AbstractObject3D& object, std::vector<Int>& destroyed, Int id): AbstractFeature3D{object}, _destroyed(destroyed), _id{id} {}
+
+            ~CountedFeature() { _destroyed.push_back(_id); }
+
+        private:
+            std::vector<Int>& _destroyed;
+            Int _id;
+    };
+
+    class Drawable: public Drawable3D {
+        public:
+            explicit Drawable(AbstractObject3D& object, DrawableGroup3D& group): Drawable3D{object, &group} {}
+
+        private:
+            void draw(const Matrix4&, Camera3D&) override {}
+    };
+
+    struct Large {
+        char data[1000];
+    };
+}
+
+ObjectPoolTest::ObjectPoolTest() {
+    addTests({&ObjectPoolTest::construct,
+              &ObjectPoolTest::create,
+              &ObjectPoolTest::createFeature,
+              &ObjectPoolTest::slabs,
+              &ObjectPoolTest::slabsLarge,
+              &ObjectPoolTest::clear,
+              &ObjectPoolTest::clearHierarchy,
+              &ObjectPoolTest::clearHeapChildren,
+              &ObjectPoolTest::scene});
+}
+
+void ObjectPoolTest::construct() {
+    ObjectPool pool{1024};
+    CORRADE_COMPARE(pool.slabSize(), 1024);
+    CORRADE_COMPARE(pool.slabCount(), 0);
+    CORRADE_COMPARE(pool.size(), 0);
+    CORRADE_VERIFY(pool.isEmpty());
+}
+
+void ObjectPoolTest::create() {
+    ObjectPool pool;
+    Object3D& a = pool.create<Object3D>();
+    Object3D& b = pool.create<Object3D>(&a);
+    b.translate(Vector3::xAxis(3.0f));
+
+    CORRADE_COMPARE(pool.size(), 2);
+    CORRADE_COMPARE(pool.slabCount(), 1);
+    CORRADE_VERIFY(b.parent() == &a);
+    CORRADE_COMPARE(b.absoluteTransformationMatrix(), Matrix4::translation(Vector3::xAxis(3.0f)));
+
+    /* Allocated next to each other */
+    CORRADE_VERIFY(reinterpret_cast<char*>(&b) - reinterpret_cast<char*>(&a) < std::ptrdiff_t(2*sizeof(Object3D)));
+    CORRADE_VERIFY(reinterpret_cast<char*>(&b) > reinterpret_cast<char*>(&a));
+}
+
+void ObjectPoolTest::createFeature() {
+    DrawableGroup3D group;
+    {
+        ObjectPool pool;
+        Object3D& object = pool.create<Object3D>();
+        Drawable& drawable = pool.create<Drawable>(object, group);
+
+        CORRADE_COMPARE(pool.size(), 2);
+        CORRADE_COMPARE(group.size(), 1);
+        CORRADE_VERIFY(&group[0] == &drawable);
+        CORRADE_VERIFY(&drawable.object() == &object);
+    }
+
+    /* The drawable got removed from the group */
+    CORRADE_COMPARE(group.size(), 0);
+}
+
+void ObjectPoolTest::slabs() {
+    ObjectPool pool{3*sizeof(Object3D)};
+    for(std::size_t i = 0; i != 3; ++i) pool.create<Object3D>();
+    CORRADE_COMPARE(pool.slabCount(), 1);
+
+    pool.create<Object3D>();
+    CORRADE_COMPARE(pool.slabCount(), 2);
+    CORRADE_COMPARE(pool.size(), 4);
+}
+
+void ObjectPoolTest::slabsLarge() {
+    ObjectPool pool{128};
+    pool.create<Object3D>();
+
+    /* Larger than the slab, gets a slab of its own */
+    Large& large = pool.create<Large>();
+    large.data[999] = 'a';
+    CORRADE_COMPARE(pool.slabCount(), 2);
+
+    /* Next allocation doesn't fit anymore */
+    pool.create<Object3D>();
+    CORRADE_COMPARE(pool.slabCount(), 3);
+}
+
+void ObjectPoolTest::clear() {
+    std::vector<Int> destroyed;
+    ObjectPool pool;
+    Object3D& a = pool.create<CountedObject>(nullptr, destroyed, 0);
+    pool.create<CountedFeature>(a, destroyed, 1);
+    Object3D& b = pool.create<CountedObject>(nullptr, destroyed, 2);
+    pool.create<CountedFeature>(b, destroyed, 3);
+    pool.create<CountedFeature>(a, destroyed, 4);
+
+    pool.clear();
+    CORRADE_VERIFY(pool.isEmpty());
+    CORRADE_COMPARE(pool.slabCount(), 0);
+
+    /* Features first, then objects, both in reverse order */
+    CORRADE_COMPARE(destroyed, (std::vector<Int>{4, 3, 1, 2, 0}));
+
+    /* The pool is usable again */
+    pool.create<Object3D>();
+    CORRADE_COMPARE(pool.size(), 1);
+    CORRADE_COMPARE(pool.slabCount(), 1);
+}
+
+void ObjectPoolTest::clearHierarchy() {
+    std::vector<Int> destroyed;
+    {
+        ObjectPool pool;
+
+        /* Child created before its parent, it's destroyed after it */
+        Object3D& child = pool.create<CountedObject>(nullptr, destroyed, 0);
+        Object3D& parent = pool.create<CountedObject>(nullptr, destroyed, 1);
+        pool.create<CountedObject>(&child, destroyed, 2);
+        child.setParent(&parent);
+    }
+
+    /* Each destroyed exactly once */
+    CORRADE_COMPARE(destroyed, (std::vector<Int>{2, 1, 0}));
+}
+
+void ObjectPoolTest::clearHeapChildren() {
+    std::vector<Int> destroyed;
+    {
+        ObjectPool pool;
+        Object3D& object = pool.create<CountedObject>(nullptr, destroyed, 0);
+        Object3D* child = new CountedObject{&object, destroyed, 1};
+        new CountedFeature{*child, destroyed, 2};
+        new CountedFeature{object, destroyed, 3};
+    }
+
+    /* Heap-allocated children and features are deleted by the pooled
+       object */
+    CORRADE_COMPARE(destroyed.size(), 4);
+    CORRADE_COMPARE(destroyed.front(), 0);
+}
+
+void ObjectPoolTest::scene() {
+    std::vector<Int> destroyed;
+    DrawableGroup3D group;
+    {
+        Scene3D scene;
+        CORRADE_VERIFY(scene.pool().isEmpty());
+
+        Object3D& a = scene.pool().create<CountedObject>(&scene, destroyed, 0);
+        Object3D* b = new CountedObject{&scene, destroyed, 1};
+        Object3D& c = scene.pool().create<CountedObject>(b, destroyed, 2);
+        scene.pool().create<Drawable>(a, group);
+        new Drawable{c, group};
+        CORRADE_COMPARE(group.size(), 2);
+
+        /* Dirty objects are fine too */
+        c.translate(Vector3::xAxis());
+    }
+
+    /* Pooled objects go first, heap children of the scene after */
+    CORRADE_COMPARE(destroyed, (std::vector<Int>{2, 0, 1}));
+    CORRADE_COMPARE(group.size(), 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ObjectPoolTest)
@@ -45,9 +45,13 @@ struct ObjectTest: TestSuite::Tester {
     void transformationsRelative();
     void transformationsOrphan();
     void transformationsDuplicate();
+    void transformationsLargeScene();
     void setClean();
     void setCleanListHierarchy();
     void setCleanListBulk();
+    void setSceneClean();
+    void setSceneCleanReparent();
+    void setSceneCleanDestroy();
 
     void rangeBasedForChildren();
     void rangeBasedForFeatures();
@@ -82,9 +86,13 @@ ObjectTest::ObjectTest() {
               &ObjectTest::transformationsRelative,
               &ObjectTest::transformationsOrphan,
               &ObjectTest::transformationsDuplicate,
+              &ObjectTest::transformationsLargeScene,
               &ObjectTest::setClean,
               &ObjectTest::setCleanListHierarchy,
               &ObjectTest::setCleanListBulk,
+              &ObjectTest::setSceneClean,
+              &ObjectTest::setSceneCleanReparent,
+              &ObjectTest::setSceneCleanDestroy,
 
               &ObjectTest::rangeBasedForChildren,
               &ObjectTest::rangeBasedForFeatures});
@@ -304,6 +312,26 @@ void ObjectTest::transformationsDuplicate() {
     }));
 }
 
+void ObjectTest::transformationsLargeScene() {
+    /* More objects than would fit into 16-bit joint indices */
+    Scene3D s;
+    Object3D* parent = new Object3D{&s};
+    parent->translate(Vector3::xAxis(5.0f));
+
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    objects.reserve(70000);
+    for(std::size_t i = 0; i != 70000; ++i) {
+        Object3D* o = new Object3D{parent};
+        o->translate(Vector3::yAxis(Float(i)));
+        objects.push_back(*o);
+    }
+
+    std::vector<Matrix4> transformations = s.transformations(objects);
+    CORRADE_COMPARE(transformations.size(), 70000);
+    CORRADE_COMPARE(transformations[0], Matrix4::translation(Vector3::xAxis(5.0f)));
+    CORRADE_COMPARE(transformations[69999], Matrix4::translation({5.0f, 69999.0f, 0.0f}));
+}
+
 void ObjectTest::setClean() {
     Scene3D scene;
 
@@ -484,6 +512,111 @@ void ObjectTest::setCleanListBulk() {
     CORRADE_COMPARE(d.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::zAxis(3.0f))*Matrix4::scaling(Vector3(-2.0f)));
 }
 
+void ObjectTest::setSceneClean() {
+    Scene3D scene;
+    CachingObject a(&scene);
+    a.translate(Vector3::zAxis(3.0f));
+    CachingObject b(&a);
+    b.scale(Vector3(-2.0f));
+    CachingObject c(&scene);
+    CachingObject d(&scene);
+
+    /* All dirty objects get cleaned, the function can be called on any object
+       in the scene */
+    b.setSceneClean();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_VERIFY(!d.isDirty());
+    CORRADE_COMPARE(b.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::zAxis(3.0f))*Matrix4::scaling(Vector3(-2.0f)));
+
+    /* Only objects marked dirty since are cleaned again */
+    c.cleanedAbsoluteTransformation = Matrix4{Math::ZeroInit};
+    d.cleanedAbsoluteTransformation = Matrix4{Math::ZeroInit};
+    a.translate(Vector3::xAxis(1.0f));
+    d.translate(Vector3::yAxis(1.0f));
+    CORRADE_VERIFY(b.isDirty());
+    scene.setSceneClean();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!d.isDirty());
+    CORRADE_COMPARE(b.cleanedAbsoluteTransformation, Matrix4::translation({1.0f, 0.0f, 3.0f})*Matrix4::scaling(Vector3(-2.0f)));
+    CORRADE_COMPARE(c.cleanedAbsoluteTransformation, Matrix4{Math::ZeroInit});
+    CORRADE_COMPARE(d.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::yAxis(1.0f)));
+
+    /* Objects cleaned individually are not cleaned again */
+    d.translate(Vector3::yAxis(1.0f));
+    d.setClean();
+    d.cleanedAbsoluteTransformation = Matrix4{Math::ZeroInit};
+    static_cast<AbstractObject3D&>(a).setSceneClean();
+    CORRADE_COMPARE(d.cleanedAbsoluteTransformation, Matrix4{Math::ZeroInit});
+
+    /* Object without a scene does nothing */
+    CachingObject orphan;
+    orphan.setSceneClean();
+    CORRADE_VERIFY(orphan.isDirty());
+}
+
+void ObjectTest::setSceneCleanReparent() {
+    Scene3D scene;
+    Scene3D another;
+    CachingObject a(&scene);
+    CachingObject b(&a);
+    b.translate(Vector3::xAxis(1.0f));
+    CachingObject c(&another);
+    c.translate(Vector3::yAxis(2.0f));
+    scene.setSceneClean();
+    CORRADE_VERIFY(!a.isDirty());
+
+    /* Dirty subtree moved to another scene is cleaned with that scene */
+    b.translate(Vector3::xAxis(1.0f));
+    a.setParent(&another);
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    scene.setSceneClean();
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    another.setSceneClean();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(b.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::xAxis(2.0f)));
+
+    /* Object removed from the scene is not cleaned with it */
+    c.translate(Vector3::yAxis(1.0f));
+    c.setParent(nullptr);
+    another.setSceneClean();
+    CORRADE_VERIFY(c.isDirty());
+
+    /* Reparenting in the same scene */
+    c.setParent(&another);
+    c.setParent(&a);
+    another.setSceneClean();
+    CORRADE_VERIFY(!c.isDirty());
+}
+
+void ObjectTest::setSceneCleanDestroy() {
+    Scene3D scene;
+    CachingObject* a = new CachingObject{&scene};
+    CachingObject* b = new CachingObject{a};
+    CachingObject c(&scene);
+
+    /* Destroyed objects are removed from the dirty list */
+    delete a;
+    scene.setSceneClean();
+    CORRADE_VERIFY(!c.isDirty());
+
+    /* Scene destroyed with dirty objects */
+    {
+        Scene3D another;
+        new CachingObject{&another};
+        b = new CachingObject{&another};
+        new CachingObject{b};
+    }
+
+    CORRADE_VERIFY(true);
+}
+
 void ObjectTest::rangeBasedForChildren() {
     Scene3D scene;
     Object3D a(&scene);
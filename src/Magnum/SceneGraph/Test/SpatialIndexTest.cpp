@@ -0,0 +1,507 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/MatrixTransformation2D.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/SpatialIndex.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct SpatialIndexTest: TestSuite::Tester {
+    explicit SpatialIndexTest();
+
+    void construct();
+    void add();
+    void addTwice();
+    void remove();
+    void removeNotInIndex();
+    void absoluteBounds();
+    void nodes();
+    void queryBox();
+    void querySphere();
+    void queryFrustum();
+    void queryRay();
+    void queryRayTouchingFace();
+    void query2D();
+    void outside();
+    void moved();
+    void objectDestroyed();
+    void indexDestroyed();
+    void bruteForce();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+namespace {
+    template<UnsignedInt dimensions> class IdFeature: public AbstractFeature<dimensions, Float> {
+        public:
+            explicit IdFeature(AbstractObject<dimensions, Float>& object, Int id): AbstractFeature<dimensions, Float>{object}, id{id} {}
+
+            Int id;
+    };
+
+    typedef IdFeature<2> IdFeature2D;
+    typedef IdFeature<3> IdFeature3D;
+    typedef SpatialIndex2D<IdFeature2D> Index2D;
+    typedef SpatialIndex3D<IdFeature3D> Index3D;
+
+    template<UnsignedInt dimensions> std::vector<Int> ids(const std::vector<std::reference_wrapper<IdFeature<dimensions>>>& features) {
+        std::vector<Int> out;
+        for(const IdFeature<dimensions>& feature: features) out.push_back(feature.id);
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    std::size_t featureCount(AbstractObject3D& object) {
+        std::size_t count = 0;
+        for(AbstractFeature3D* feature = object.features().first(); feature; feature = feature->nextFeature())
+            ++count;
+        return count;
+    }
+}
+
+SpatialIndexTest::SpatialIndexTest() {
+    addTests({&SpatialIndexTest::construct,
+              &SpatialIndexTest::add,
+              &SpatialIndexTest::addTwice,
+              &SpatialIndexTest::remove,
+              &SpatialIndexTest::removeNotInIndex,
+              &SpatialIndexTest::absoluteBounds,
+              &SpatialIndexTest::nodes,
+              &SpatialIndexTest::queryBox,
+              &SpatialIndexTest::querySphere,
+              &SpatialIndexTest::queryFrustum,
+              &SpatialIndexTest::queryRay,
+              &SpatialIndexTest::queryRayTouchingFace,
+              &SpatialIndexTest::query2D,
+              &SpatialIndexTest::outside,
+              &SpatialIndexTest::moved,
+              &SpatialIndexTest::objectDestroyed,
+              &SpatialIndexTest::indexDestroyed,
+              &SpatialIndexTest::bruteForce});
+}
+
+void SpatialIndexTest::construct() {
+    Index3D index{{Vector3{-10.0f}, Vector3{10.0f}}, 5};
+    CORRADE_COMPARE(index.bounds(), (Range3D{Vector3{-10.0f}, Vector3{10.0f}}));
+    CORRADE_COMPARE(index.maxDepth(), 5);
+    CORRADE_VERIFY(index.isEmpty());
+    CORRADE_COMPARE(index.size(), 0);
+    CORRADE_COMPARE(index.nodeCount(), 1);
+}
+
+void SpatialIndexTest::add() {
+    Scene3D scene;
+    Object3D object{&scene};
+    IdFeature3D feature{object, 0};
+
+    Index3D index{{Vector3{-10.0f}, Vector3{10.0f}}};
+    index.add(feature, {Vector3{-1.0f}, Vector3{1.0f}});
+    CORRADE_VERIFY(!index.isEmpty());
+    CORRADE_COMPARE(index.size(), 1);
+    CORRADE_VERIFY(index.contains(feature));
+
+    /* The index attached its own feature to the object */
+    CORRADE_COMPARE(featureCount(object), 2);
+}
+
+void SpatialIndexTest::addTwice() {
+    Scene3D scene;
+    Object3D object{&scene};
+    IdFeature3D feature{object, 0};
+
+    Index3D index{{Vector3{-10.0f}, Vector3{10.0f}}};
+    index.add(feature, {Vector3{-1.0f}, Vector3{1.0f}});
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    index.add(feature, {Vector3{-1.0f}, Vector3{1.0f}});
+    CORRADE_COMPARE(index.size(), 1);
+    CORRADE_COMPARE(out.str(), "SceneGraph::SpatialIndex::add(): feature is already in the index\n");
+}
+
+void SpatialIndexTest::remove() {
+    Scene3D scene;
+    Object3D object{&scene};
+    IdFeature3D a{object, 0}, b{object, 1};
+
+    Index3D index{{Vector3{-10.0f}, Vector3{10.0f}}};
+    index.add(a, {Vector3{-1.0f}, Vector3{1.0f}})
+        .add(b, {Vector3{-1.0f}, Vector3{1.0f}});
+    CORRADE_COMPARE(featureCount(object), 4);
+
+    index.remove(a);
+    CORRADE_COMPARE(index.size(), 1);
+    CORRADE_VERIFY(!index.contains(a));
+    CORRADE_VERIFY(index.contains(b));
+    CORRADE_COMPARE(featureCount(object), 3);
+
+    std::vector<std::reference_wrapper<IdFeature3D>> found;
+    index.queryBox({Vector3{-10.0f}, Vector3{10.0f}}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{1}));
+}
+
+void SpatialIndexTest::removeNotInIndex() {
+    Scene3D scene;
+    Object3D object{&scene};
+    IdFeature3D feature{object, 0};
+
+    Index3D index{{Vector3{-10.0f}, Vector3{10.0f}}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    index.remove(feature);
+    CORRADE_COMPARE(out.str(), "SceneGraph::SpatialIndex::remove(): feature is not part of this index\n");
+}
+
+void SpatialIndexTest::absoluteBounds() {
+    Scene3D scene;
+    Object3D parent{&scene};
+    parent.translate({1.0f, 2.0f, 3.0f});
+    Object3D object{&parent};
+    object.scale(Vector3{2.0f})
+        .rotateZ(Deg(45.0f));
+    IdFeature3D feature{object, 0};
+
+    Index3D index{{Vector3{-10.0f}, Vector3{10.0f}}};
+    index.add(feature, {{-1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 2.0f}});
+
+    /* Box enclosing the rotated and scaled box */
+    const Range3D bounds = index.absoluteBounds(feature);
+    CORRADE_COMPARE(bounds.min(), (Vector3{1.0f - 2.0f*Constants::sqrt2(), 2.0f - 2.0f*Constants::sqrt2(), 3.0f}));
+    CORRADE_COMPARE(bounds.max(), (Vector3{1.0f + 2.0f*Constants::sqrt2(), 2.0f + 2.0f*Constants::sqrt2(), 7.0f}));
+
+    /* Moving the parent is reflected after cleaning */
+    parent.translate(Vector3::xAxis(2.0f));
+    CORRADE_COMPARE(index.absoluteBounds(feature).min().x(), 3.0f - 2.0f*Constants::sqrt2());
+}
+
+void SpatialIndexTest::nodes() {
+    Scene3D scene;
+    Object3D object{&scene};
+    IdFeature3D small{object, 0}, large{object, 1}, tiny{object, 2};
+
+    Index3D index{{Vector3{-8.0f}, Vector3{8.0f}}, 4};
+
+    /* Feature as large as the region stays in the root */
+    index.add(large, {Vector3{-8.0f}, Vector3{8.0f}});
+    CORRADE_COMPARE(index.nodeCount(), 1);
+
+    /* Feature of size 4 fits into loose bounds of the second level */
+    index.add(small, {Vector3{1.0f}, Vector3{5.0f}});
+    CORRADE_COMPARE(index.nodeCount(), 3);
+
+    /* Tiny feature goes down to max depth, reusing the existing nodes */
+    index.add(tiny, {Vector3{3.0f}, Vector3{3.01f}});
+    CORRADE_COMPARE(index.nodeCount(), 5);
+}
+
+void SpatialIndexTest::queryBox() {
+    Scene3D scene;
+    Index3D index{{Vector3{-100.0f}, Vector3{100.0f}}};
+    std::vector<std::unique_ptr<IdFeature3D>> features;
+    for(Int i = 0; i != 10; ++i) {
+        Object3D* object = new Object3D{&scene};
+        object->translate(Vector3::xAxis(Float(i*10)));
+        features.emplace_back(new IdFeature3D{*object, i});
+        index.add(*features.back(), {Vector3{-1.0f}, Vector3{1.0f}});
+    }
+
+    std::vector<std::reference_wrapper<IdFeature3D>> found;
+    index.queryBox({{15.0f, -5.0f, -5.0f}, {41.0f, 5.0f, 5.0f}}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{2, 3, 4}));
+
+    /* The output is cleared on each query */
+    index.queryBox({{-5.0f, 2.0f, -5.0f}, {100.0f, 5.0f, 5.0f}}, found);
+    CORRADE_VERIFY(found.empty());
+
+    /* The features need to be destroyed before the objects */
+    features.clear();
+}
+
+void SpatialIndexTest::querySphere() {
+    Scene3D scene;
+    Index3D index{{Vector3{-100.0f}, Vector3{100.0f}}};
+    Object3D a{&scene}, b{&scene}, c{&scene};
+    a.translate({3.0f, 0.0f, 0.0f});
+    b.translate({3.0f, 3.0f, 0.0f});
+    c.translate({0.0f, 0.0f, -10.0f});
+    IdFeature3D fa{a, 0}, fb{b, 1}, fc{c, 2};
+    index.add(fa, {Vector3{-1.0f}, Vector3{1.0f}})
+        .add(fb, {Vector3{-1.0f}, Vector3{1.0f}})
+        .add(fc, {Vector3{-1.0f}, Vector3{1.0f}});
+
+    /* The corner of b is at distance sqrt(8) from the center */
+    std::vector<std::reference_wrapper<IdFeature3D>> found;
+    index.querySphere({}, 2.5f, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{0}));
+    index.querySphere({}, 3.0f, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{0, 1}));
+}
+
+void SpatialIndexTest::queryFrustum() {
+    Scene3D scene;
+    Index3D index{{Vector3{-100.0f}, Vector3{100.0f}}};
+    Object3D inside{&scene}, behind{&scene}, side{&scene}, partial{&scene};
+    inside.translate(Vector3::zAxis(-10.0f));
+    behind.translate(Vector3::zAxis(10.0f));
+    side.translate({20.0f, 0.0f, -10.0f});
+    partial.translate({11.0f, 0.0f, -10.0f});
+    IdFeature3D a{inside, 0}, b{behind, 1}, c{side, 2}, d{partial, 3};
+    index.add(a, {Vector3{-1.0f}, Vector3{1.0f}})
+        .add(b, {Vector3{-1.0f}, Vector3{1.0f}})
+        .add(c, {Vector3{-1.0f}, Vector3{1.0f}})
+        .add(d, {Vector3{-2.0f}, Vector3{2.0f}});
+
+    std::vector<std::reference_wrapper<IdFeature3D>> found;
+    index.queryFrustum(Frustum::fromMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f)), found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{0, 3}));
+}
+
+void SpatialIndexTest::queryRay() {
+    Scene3D scene;
+    Index3D index{{Vector3{-100.0f}, Vector3{100.0f}}};
+    Object3D front{&scene}, back{&scene}, aside{&scene}, around{&scene};
+    front.translate({5.0f, 0.0f, 0.0f});
+    back.translate({-5.0f, 0.0f, 0.0f});
+    aside.translate({5.0f, 3.0f, 0.0f});
+    IdFeature3D a{front, 0}, b{back, 1}, c{aside, 2}, d{around, 3};
+    index.add(a, {Vector3{-1.0f}, Vector3{1.0f}})
+        .add(b, {Vector3{-1.0f}, Vector3{1.0f}})
+        .add(c, {Vector3{-1.0f}, Vector3{1.0f}})
+        .add(d, {Vector3{-1.0f}, Vector3{1.0f}});
+
+    /* Only boxes in front of the origin or containing it are hit */
+    std::vector<std::reference_wrapper<IdFeature3D>> found;
+    index.queryRay({}, Vector3::xAxis(), found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{0, 3}));
+
+    index.queryRay({0.0f, 3.0f, 0.0f}, Vector3::xAxis(2.0f), found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{2}));
+
+    index.queryRay({}, Vector3{1.0f, 0.6f, 0.0f}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{2, 3}));
+}
+
+void SpatialIndexTest::queryRayTouchingFace() {
+    Scene3D scene;
+    Index3D index{{Vector3{-100.0f}, Vector3{100.0f}}};
+    Object3D box{&scene}, aside{&scene};
+    aside.translate(Vector3::xAxis(5.0f));
+    IdFeature3D a{box, 0}, b{aside, 1};
+    index.add(a, {Vector3{0.0f}, Vector3{2.0f}})
+        .add(b, {Vector3{0.0f}, Vector3{2.0f}});
+
+    /* Axis-aligned ray going along faces and edges of the first box. The
+       components parallel to the faces are zero, which shouldn't make the
+       slab test fail. Counted as a hit, same as in queryBox(). */
+    std::vector<std::reference_wrapper<IdFeature3D>> found;
+    index.queryRay({0.0f, 0.0f, 10.0f}, {0.0f, 0.0f, -1.0f}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{0}));
+
+    index.queryRay({2.0f, 1.0f, 10.0f}, {0.0f, 0.0f, -1.0f}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{0}));
+
+    index.queryBox({{0.0f, 0.0f, 10.0f}, {0.0f, 0.0f, 10.0f}}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{}));
+    index.queryBox({{0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{0}));
+
+    /* Parallel to the face, but outside of the box */
+    index.queryRay({-0.5f, 0.0f, 10.0f}, {0.0f, 0.0f, -1.0f}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{}));
+
+    /* Touching the face, but pointing away from the box */
+    index.queryRay({0.0f, 0.0f, 10.0f}, {0.0f, 0.0f, 1.0f}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{}));
+}
+
+void SpatialIndexTest::query2D() {
+    Scene2D scene;
+    Index2D index{{Vector2{-100.0f}, Vector2{100.0f}}};
+    Object2D a{&scene}, b{&scene};
+    a.translate({10.0f, 0.0f});
+    b.translate({-10.0f, 5.0f});
+    IdFeature2D fa{a, 0}, fb{b, 1};
+    index.add(fa, {Vector2{-1.0f}, Vector2{1.0f}})
+        .add(fb, {Vector2{-1.0f}, Vector2{1.0f}});
+
+    std::vector<std::reference_wrapper<IdFeature2D>> found;
+    index.queryBox({{5.0f, -5.0f}, {15.0f, 5.0f}}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{0}));
+    index.querySphere({-10.0f, 0.0f}, 4.5f, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{1}));
+    index.queryRay({}, Vector2{-2.0f, 1.0f}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{1}));
+}
+
+void SpatialIndexTest::outside() {
+    Scene3D scene;
+    Index3D index{{Vector3{-10.0f}, Vector3{10.0f}}};
+    Object3D far{&scene}, huge{&scene};
+    far.translate(Vector3::xAxis(50.0f));
+    IdFeature3D a{far, 0}, b{huge, 1};
+    index.add(a, {Vector3{-1.0f}, Vector3{1.0f}})
+        .add(b, {Vector3{-60.0f}, Vector3{60.0f}});
+    CORRADE_COMPARE(index.nodeCount(), 1);
+
+    std::vector<std::reference_wrapper<IdFeature3D>> found;
+    index.queryBox({Vector3{45.0f}, Vector3{55.0f}}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{1}));
+    index.queryBox({{45.0f, -1.0f, -1.0f}, {55.0f, 1.0f, 1.0f}}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{0, 1}));
+
+    /* Moving back into the region */
+    far.setTransformation({});
+    index.queryBox({Vector3{-2.0f}, Vector3{2.0f}}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{0, 1}));
+    CORRADE_COMPARE(index.nodeCount(), 4);
+}
+
+void SpatialIndexTest::moved() {
+    Scene3D scene;
+    Index3D index{{Vector3{-100.0f}, Vector3{100.0f}}};
+    Object3D parent{&scene};
+    Object3D object{&parent};
+    IdFeature3D feature{object, 0};
+    index.add(feature, {Vector3{-1.0f}, Vector3{1.0f}});
+
+    std::vector<std::reference_wrapper<IdFeature3D>> found;
+    index.queryBox({Vector3{-2.0f}, Vector3{2.0f}}, found);
+    CORRADE_COMPARE(found.size(), 1);
+
+    /* Moving the parent moves the feature, the index picks it up on next
+       query */
+    parent.translate(Vector3::yAxis(50.0f));
+    CORRADE_VERIFY(object.isDirty());
+    index.queryBox({Vector3{-2.0f}, Vector3{2.0f}}, found);
+    CORRADE_VERIFY(found.empty());
+    CORRADE_VERIFY(!object.isDirty());
+    index.queryBox({{-2.0f, 48.0f, -2.0f}, {2.0f, 52.0f, 2.0f}}, found);
+    CORRADE_COMPARE(found.size(), 1);
+}
+
+/* GCC 11+ speculatively devirtualizes the deletes below to ~Scene() and then
+   complains that the Object3D allocation is too small for a Scene */
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+void SpatialIndexTest::objectDestroyed() {
+    Scene3D scene;
+    Index3D index{{Vector3{-100.0f}, Vector3{100.0f}}};
+    Object3D* a = new Object3D{&scene};
+    Object3D* b = new Object3D{&scene};
+    auto fa = new IdFeature3D{*a, 0};
+    auto fb = new IdFeature3D{*b, 1};
+    index.add(*fa, {Vector3{-1.0f}, Vector3{1.0f}})
+        .add(*fb, {Vector3{-1.0f}, Vector3{1.0f}});
+
+    delete a;
+    CORRADE_COMPARE(index.size(), 1);
+    CORRADE_VERIFY(index.contains(*fb));
+
+    std::vector<std::reference_wrapper<IdFeature3D>> found;
+    index.queryBox({Vector3{-2.0f}, Vector3{2.0f}}, found);
+    CORRADE_COMPARE(ids(found), (std::vector<Int>{1}));
+}
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+void SpatialIndexTest::indexDestroyed() {
+    Scene3D scene;
+    Object3D object{&scene};
+    IdFeature3D feature{object, 0};
+
+    {
+        Index3D index{{Vector3{-100.0f}, Vector3{100.0f}}};
+        index.add(feature, {Vector3{-1.0f}, Vector3{1.0f}});
+        CORRADE_COMPARE(featureCount(object), 2);
+    }
+
+    /* The index detached itself, moving the object doesn't crash */
+    CORRADE_COMPARE(featureCount(object), 1);
+    object.translate(Vector3::xAxis(1.0f));
+    object.setClean();
+}
+
+void SpatialIndexTest::bruteForce() {
+    Scene3D scene;
+    Index3D index{{Vector3{-50.0f}, Vector3{50.0f}}, 6};
+
+    /* Features of random sizes in a hierarchy, some outside of the region */
+    std::mt19937 random{17};
+    std::uniform_real_distribution<Float> position{-60.0f, 60.0f}, size{0.01f, 20.0f};
+    std::vector<Object3D*> objects;
+    std::vector<std::unique_ptr<IdFeature3D>> features;
+    std::vector<Range3D> bounds;
+    for(Int i = 0; i != 500; ++i) {
+        objects.push_back(new Object3D{i % 5 ? objects[random() % objects.size()] : &scene});
+        objects.back()->translate(Vector3{position(random), position(random), position(random)}/Float(1 + i % 5));
+        features.emplace_back(new IdFeature3D{*objects.back(), i});
+        bounds.push_back(Range3D::fromSize({}, Vector3{size(random)}));
+        index.add(*features.back(), bounds.back());
+    }
+
+    std::vector<std::reference_wrapper<IdFeature3D>> found;
+    for(Int iteration = 0; iteration != 20; ++iteration) {
+        /* Move some objects around */
+        for(Int i = 0; i != 20; ++i)
+            objects[random() % objects.size()]->translate(Vector3{position(random), position(random), position(random)}/10.0f);
+
+        const Vector3 center{position(random), position(random), position(random)};
+        const Range3D box{center - Vector3{size(random)}, center + Vector3{size(random)}};
+        index.queryBox(box, found);
+
+        std::vector<Int> expected;
+        for(std::size_t i = 0; i != features.size(); ++i) {
+            const Matrix4 transformation = objects[i]->absoluteTransformationMatrix();
+            const Range3D absolute{transformation.transformPoint(bounds[i].min()), transformation.transformPoint(bounds[i].max())};
+            if((absolute.min() <= box.max()).all() && (box.min() <= absolute.max()).all())
+                expected.push_back(Int(i));
+        }
+
+        CORRADE_COMPARE(ids(found), expected);
+    }
+
+    /* The features need to be destroyed before the objects */
+    features.clear();
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::SpatialIndexTest)
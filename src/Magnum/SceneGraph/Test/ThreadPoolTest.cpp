@@ -0,0 +1,125 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/ThreadPool.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct ThreadPoolTest: TestSuite::Tester {
+    explicit ThreadPoolTest();
+
+    void construct();
+    void constructDefault();
+    void parallelFor();
+    void parallelForSingleThread();
+    void parallelForSingleChunk();
+    void parallelForEmpty();
+    void parallelForZeroChunkSize();
+};
+
+ThreadPoolTest::ThreadPoolTest() {
+    addTests({&ThreadPoolTest::construct,
+              &ThreadPoolTest::constructDefault,
+              &ThreadPoolTest::parallelFor,
+              &ThreadPoolTest::parallelForSingleThread,
+              &ThreadPoolTest::parallelForSingleChunk,
+              &ThreadPoolTest::parallelForEmpty,
+              &ThreadPoolTest::parallelForZeroChunkSize});
+}
+
+void ThreadPoolTest::construct() {
+    ThreadPool pool{3};
+    CORRADE_COMPARE(pool.threadCount(), 3);
+}
+
+void ThreadPoolTest::constructDefault() {
+    ThreadPool pool;
+    CORRADE_VERIFY(pool.threadCount() >= 1);
+}
+
+void ThreadPoolTest::parallelFor() {
+    ThreadPool pool{4};
+
+    /* Each item is processed exactly once, also when the pool is reused */
+    std::vector<Int> data(10000);
+    for(Int iteration = 0; iteration != 50; ++iteration) {
+        pool.parallelFor(data.size(), 64, [&data](std::size_t begin, std::size_t end) {
+            CORRADE_INTERNAL_ASSERT(end - begin <= 64);
+            for(std::size_t i = begin; i != end; ++i) ++data[i];
+        });
+    }
+
+    CORRADE_COMPARE(data, std::vector<Int>(10000, 50));
+}
+
+void ThreadPoolTest::parallelForSingleThread() {
+    ThreadPool pool{1};
+    CORRADE_COMPARE(pool.threadCount(), 1);
+
+    /* Chunks are processed in order on the calling thread */
+    std::vector<std::size_t> begins;
+    pool.parallelFor(10, 3, [&begins](std::size_t begin, std::size_t) {
+        begins.push_back(begin);
+    });
+    CORRADE_COMPARE(begins, (std::vector<std::size_t>{0, 3, 6, 9}));
+}
+
+void ThreadPoolTest::parallelForSingleChunk() {
+    ThreadPool pool{4};
+
+    std::size_t calls = 0, first = 1, last = 0;
+    pool.parallelFor(100, 128, [&](std::size_t begin, std::size_t end) {
+        ++calls;
+        first = begin;
+        last = end;
+    });
+    CORRADE_COMPARE(calls, 1);
+    CORRADE_COMPARE(first, 0);
+    CORRADE_COMPARE(last, 100);
+}
+
+void ThreadPoolTest::parallelForEmpty() {
+    ThreadPool pool{4};
+
+    bool called = false;
+    pool.parallelFor(0, 16, [&called](std::size_t, std::size_t) { called = true; });
+    CORRADE_VERIFY(!called);
+}
+
+void ThreadPoolTest::parallelForZeroChunkSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    ThreadPool pool{4};
+    pool.parallelFor(100, 0, [](std::size_t, std::size_t) {});
+    CORRADE_COMPARE(out.str(), "SceneGraph::ThreadPool::parallelFor(): chunk size can't be zero\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ThreadPoolTest)
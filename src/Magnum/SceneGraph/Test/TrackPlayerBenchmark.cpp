@@ -0,0 +1,142 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <memory>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/TrackPlayer.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct TrackPlayerBenchmark: TestSuite::Tester {
+    explicit TrackPlayerBenchmark();
+
+    void playback();
+    void seek();
+};
+
+typedef Object<TranslationRotationScalingTransformation3D> Object3D;
+typedef Scene<TranslationRotationScalingTransformation3D> Scene3D;
+
+namespace {
+    enum: std::size_t {
+        TrackCount = 10000,
+        KeyCount = 100,
+        DataCount = 3
+    };
+
+    constexpr struct {
+        const char* name;
+        Interpolation interpolation;
+    } Data[DataCount]{
+        {"10k tracks, linear", Interpolation::Linear},
+        {"10k tracks, spherical", Interpolation::Spherical},
+        {"10k tracks, cubic Bézier", Interpolation::CubicBezier}
+    };
+
+    /* One third of the tracks is translation, one rotation, one scaling, each
+       with 100 keys one second apart */
+    struct Fixture {
+        explicit Fixture(Interpolation interpolation): player{scene} {
+            /* The player references the tracks, so they can't reallocate */
+            translations.reserve(TrackCount/3 + 1);
+            rotations.reserve(TrackCount/3 + 1);
+            scalings.reserve(TrackCount/3 + 1);
+            objects.reserve(TrackCount/3 + 1);
+
+            for(std::size_t i = 0; i != TrackCount; ++i) {
+                if(i % 3 == 0) objects.emplace_back(new Object3D{&scene});
+                Object3D& object = *objects.back();
+
+                if(i % 3 == 0) {
+                    translations.emplace_back(interpolation);
+                    for(std::size_t j = 0; j != KeyCount; ++j)
+                        translations.back().add(Float(j), Vector3(Float(i + j)));
+                    player.addTranslation(translations.back(), object);
+                } else if(i % 3 == 1) {
+                    rotations.emplace_back(interpolation);
+                    for(std::size_t j = 0; j != KeyCount; ++j)
+                        rotations.back().add(Float(j), Quaternion::rotation(Deg(Float(i + j*17)), Vector3::yAxis()));
+                    player.addRotation(rotations.back(), object);
+                } else {
+                    scalings.emplace_back(interpolation);
+                    for(std::size_t j = 0; j != KeyCount; ++j)
+                        scalings.back().add(Float(j), Vector3(1.0f + Float(j % 2)));
+                    player.addScaling(scalings.back(), object);
+                }
+            }
+        }
+
+        Scene3D scene;
+        std::vector<std::unique_ptr<Object3D>> objects;
+        std::vector<Track<Vector3>> translations, scalings;
+        std::vector<Track<Quaternion>> rotations;
+        TrackPlayer player;
+    };
+}
+
+TrackPlayerBenchmark::TrackPlayerBenchmark() {
+    addInstancedBenchmarks({&TrackPlayerBenchmark::playback,
+                            &TrackPlayerBenchmark::seek}, 10, DataCount);
+}
+
+void TrackPlayerBenchmark::playback() {
+    const auto& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Fixture fixture{data.interpolation};
+    CORRADE_COMPARE(fixture.player.trackCount(), TrackCount);
+
+    /* Sequential playback, the lookup hint is used */
+    Float time = 0.0f;
+    CORRADE_BENCHMARK(100) {
+        time += 0.3f;
+        fixture.player.evaluate(time);
+    }
+
+    CORRADE_VERIFY(fixture.objects.front()->translation() != Vector3{});
+}
+
+void TrackPlayerBenchmark::seek() {
+    const auto& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Fixture fixture{data.interpolation};
+    CORRADE_COMPARE(fixture.player.trackCount(), TrackCount);
+
+    /* Jumping over many keys each time, falls back to binary search */
+    std::size_t i = 0;
+    CORRADE_BENCHMARK(100) {
+        i = (i + 37) % KeyCount;
+        fixture.player.evaluate(Float(i) + 0.5f);
+    }
+
+    CORRADE_VERIFY(fixture.objects.front()->translation() != Vector3{});
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::TrackPlayerBenchmark)
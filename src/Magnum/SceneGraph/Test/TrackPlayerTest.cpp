@@ -0,0 +1,187 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AnimableGroup.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/TrackPlayer.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+typedef Object<TranslationRotationScalingTransformation3D> Object3D;
+typedef Scene<TranslationRotationScalingTransformation3D> Scene3D;
+
+struct TrackPlayerTest: TestSuite::Tester {
+    explicit TrackPlayerTest();
+
+    void construct();
+    void addEmpty();
+    void evaluate();
+    void evaluateTransformation();
+    void play();
+    void playStopped();
+};
+
+TrackPlayerTest::TrackPlayerTest() {
+    addTests({&TrackPlayerTest::construct,
+              &TrackPlayerTest::addEmpty,
+              &TrackPlayerTest::evaluate,
+              &TrackPlayerTest::evaluateTransformation,
+              &TrackPlayerTest::play,
+              &TrackPlayerTest::playStopped});
+}
+
+void TrackPlayerTest::construct() {
+    Track<Vector3> translation;
+    translation.add(0.0f, {})
+               .add(1.5f, {});
+    Track<Quaternion> rotation;
+    rotation.add(0.5f, {})
+            .add(3.0f, {});
+
+    Scene3D scene;
+    Object3D object{&scene};
+    TrackPlayer player{object};
+    CORRADE_COMPARE(player.trackCount(), 0);
+    CORRADE_COMPARE(player.duration(), 0.0f);
+
+    player.addTranslation(translation, object)
+          .addRotation(rotation, object);
+    CORRADE_COMPARE(player.trackCount(), 2);
+    CORRADE_COMPARE(player.duration(), 3.0f);
+}
+
+void TrackPlayerTest::addEmpty() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Track<Vector3> track;
+    Object3D object;
+    TrackPlayer player{object};
+    player.addScaling(track, object);
+    CORRADE_COMPARE(player.trackCount(), 0);
+    CORRADE_COMPARE(out.str(), "SceneGraph::TrackPlayer::addScaling(): the track is empty\n");
+}
+
+void TrackPlayerTest::evaluate() {
+    Track<Vector3> translation;
+    translation.add(0.0f, {})
+               .add(2.0f, {2.0f, 4.0f, 0.0f});
+    Track<Quaternion> rotation{Interpolation::Spherical};
+    rotation.add(0.0f, {})
+            .add(2.0f, Quaternion::rotation(Deg(90.0f), Vector3::yAxis()));
+    Track<Vector3> scaling{Interpolation::Constant};
+    scaling.add(0.0f, Vector3{1.0f})
+           .add(1.0f, Vector3{3.0f});
+
+    Scene3D scene;
+    Object3D a{&scene};
+    Object3D b{&scene};
+    TrackPlayer player{scene};
+    player.addTranslation(translation, a)
+          .addRotation(rotation, a)
+          .addScaling(scaling, b);
+
+    a.setClean();
+    b.setClean();
+    player.evaluate(1.0f);
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_COMPARE(a.translation(), (Vector3{1.0f, 2.0f, 0.0f}));
+    CORRADE_COMPARE(a.rotation(), Quaternion::rotation(Deg(45.0f), Vector3::yAxis()));
+    CORRADE_COMPARE(a.scaling(), Vector3{1.0f});
+    CORRADE_COMPARE(b.translation(), Vector3{});
+    CORRADE_COMPARE(b.scaling(), Vector3{3.0f});
+
+    /* Seeking back */
+    player.evaluate(0.5f);
+    CORRADE_COMPARE(a.translation(), (Vector3{0.5f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(b.scaling(), Vector3{1.0f});
+}
+
+void TrackPlayerTest::evaluateTransformation() {
+    Track<DualQuaternion> transformation;
+    transformation.add(0.0f, {})
+                  .add(1.0f, DualQuaternion::translation({4.0f, 0.0f, 0.0f})*DualQuaternion::rotation(Deg(90.0f), Vector3::zAxis()));
+
+    Scene3D scene;
+    Object3D object{&scene};
+    object.setScaling(Vector3{2.0f});
+    TrackPlayer player{object};
+    player.addTransformation(transformation, object);
+
+    /* Scaling is kept */
+    player.evaluate(1.0f);
+    CORRADE_COMPARE(object.transformationMatrix(),
+        Matrix4::translation({4.0f, 0.0f, 0.0f})*
+        Matrix4::rotationZ(Deg(90.0f))*
+        Matrix4::scaling(Vector3{2.0f}));
+}
+
+void TrackPlayerTest::play() {
+    Track<Vector3> translation;
+    translation.add(0.0f, {})
+               .add(2.0f, {2.0f, 0.0f, 0.0f});
+
+    Scene3D scene;
+    Object3D object{&scene};
+    AnimableGroup3D group;
+    TrackPlayer player{object, &group};
+    player.addTranslation(translation, object)
+          .setState(AnimationState::Running);
+
+    group.step(1.0f, 0.5f);
+    CORRADE_COMPARE(object.translation(), Vector3{});
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(object.translation(), (Vector3{0.5f, 0.0f, 0.0f}));
+    group.step(2.75f, 1.25f);
+    CORRADE_COMPARE(object.translation(), (Vector3{1.75f, 0.0f, 0.0f}));
+}
+
+void TrackPlayerTest::playStopped() {
+    Track<Vector3> translation;
+    translation.add(0.0f, {})
+               .add(2.0f, {2.0f, 0.0f, 0.0f});
+
+    Scene3D scene;
+    Object3D object{&scene};
+    AnimableGroup3D group;
+    TrackPlayer player{object, &group};
+    player.addTranslation(translation, object)
+          .setState(AnimationState::Running);
+
+    /* The final pose is reached even if there was no step at the end */
+    group.step(1.0f, 0.5f);
+    group.step(1.5f, 0.5f);
+    group.step(5.0f, 3.5f);
+    CORRADE_COMPARE(player.state(), AnimationState::Stopped);
+    CORRADE_COMPARE(object.translation(), (Vector3{2.0f, 0.0f, 0.0f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::TrackPlayerTest)
@@ -0,0 +1,250 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Bezier.h"
+#include "Magnum/SceneGraph/Track.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct TrackTest: TestSuite::Tester {
+    explicit TrackTest();
+
+    void construct();
+    void addUnsorted();
+    void clamp();
+
+    void constant();
+    void linear();
+    void spherical();
+    void cubicBezier();
+
+    void hintSequential();
+    void hintSeek();
+    void hintReverse();
+
+    void debugInterpolation();
+};
+
+TrackTest::TrackTest() {
+    addTests({&TrackTest::construct,
+              &TrackTest::addUnsorted,
+              &TrackTest::clamp,
+
+              &TrackTest::constant,
+              &TrackTest::linear,
+              &TrackTest::spherical,
+              &TrackTest::cubicBezier,
+
+              &TrackTest::hintSequential,
+              &TrackTest::hintSeek,
+              &TrackTest::hintReverse,
+
+              &TrackTest::debugInterpolation});
+}
+
+void TrackTest::construct() {
+    Track<Vector3> track{Interpolation::Spherical};
+    CORRADE_COMPARE(track.interpolation(), Interpolation::Spherical);
+    CORRADE_VERIFY(track.isEmpty());
+    CORRADE_COMPARE(track.duration(), 0.0f);
+
+    track.add(0.5f, {1.0f, 2.0f, 3.0f})
+         .add(1.5f, {4.0f, 5.0f, 6.0f});
+    CORRADE_VERIFY(!track.isEmpty());
+    CORRADE_COMPARE(track.size(), 2);
+    CORRADE_COMPARE(track.duration(), 1.5f);
+    CORRADE_COMPARE(track.times()[1], 1.5f);
+    CORRADE_COMPARE(track.values()[0], (Vector3{1.0f, 2.0f, 3.0f}));
+}
+
+void TrackTest::addUnsorted() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Track<Vector3> track;
+    track.add(1.0f, {})
+         .add(0.5f, {});
+    CORRADE_COMPARE(track.size(), 1);
+    CORRADE_COMPARE(out.str(), "SceneGraph::Track::add(): keys must be added in ascending time order\n");
+}
+
+void TrackTest::clamp() {
+    Track<Vector3> track;
+    track.add(1.0f, {1.0f, 0.0f, 0.0f})
+         .add(2.0f, {2.0f, 0.0f, 0.0f});
+
+    CORRADE_COMPARE(track.at(-5.0f), (Vector3{1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(track.at(1.0f), (Vector3{1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(track.at(2.0f), (Vector3{2.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(track.at(7.0f), (Vector3{2.0f, 0.0f, 0.0f}));
+
+    /* Single key */
+    Track<Quaternion> single;
+    single.add(1.0f, Quaternion::rotation(Deg(35.0f), Vector3::xAxis()));
+    CORRADE_COMPARE(single.at(0.0f), Quaternion::rotation(Deg(35.0f), Vector3::xAxis()));
+    CORRADE_COMPARE(single.at(3.0f), Quaternion::rotation(Deg(35.0f), Vector3::xAxis()));
+}
+
+void TrackTest::constant() {
+    Track<Vector3> track{Interpolation::Constant};
+    track.add(0.0f, {1.0f, 0.0f, 0.0f})
+         .add(1.0f, {2.0f, 0.0f, 0.0f})
+         .add(2.0f, {3.0f, 0.0f, 0.0f});
+
+    CORRADE_COMPARE(track.at(0.75f), (Vector3{1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(track.at(1.0f), (Vector3{2.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(track.at(1.99f), (Vector3{2.0f, 0.0f, 0.0f}));
+}
+
+void TrackTest::linear() {
+    Track<Vector3> vectors;
+    vectors.add(0.0f, {1.0f, 0.0f, 0.0f})
+           .add(2.0f, {3.0f, 4.0f, 0.0f});
+    CORRADE_COMPARE(vectors.at(0.5f), (Vector3{1.5f, 1.0f, 0.0f}));
+
+    const Quaternion a = Quaternion::rotation(Deg(0.0f), Vector3::zAxis());
+    const Quaternion b = Quaternion::rotation(Deg(90.0f), Vector3::zAxis());
+    Track<Quaternion> quaternions;
+    quaternions.add(0.0f, a)
+               .add(1.0f, b);
+    CORRADE_COMPARE(quaternions.at(0.5f), Math::lerp(a, b, 0.5f));
+    CORRADE_VERIFY(quaternions.at(0.3f).isNormalized());
+
+    const DualQuaternion c = DualQuaternion::translation({2.0f, 0.0f, 0.0f});
+    const DualQuaternion d = DualQuaternion::translation({4.0f, 2.0f, 0.0f});
+    Track<DualQuaternion> dualQuaternions;
+    dualQuaternions.add(0.0f, c)
+                   .add(1.0f, d);
+    CORRADE_COMPARE(dualQuaternions.at(0.5f).translation(), (Vector3{3.0f, 1.0f, 0.0f}));
+}
+
+void TrackTest::spherical() {
+    const Quaternion a = Quaternion::rotation(Deg(0.0f), Vector3::zAxis());
+    const Quaternion b = Quaternion::rotation(Deg(90.0f), Vector3::zAxis());
+    Track<Quaternion> quaternions{Interpolation::Spherical};
+    quaternions.add(0.0f, a)
+               .add(1.0f, b);
+    CORRADE_COMPARE(quaternions.at(0.25f), Quaternion::rotation(Deg(22.5f), Vector3::zAxis()));
+
+    const DualQuaternion c = DualQuaternion::rotation(Deg(0.0f), Vector3::zAxis());
+    const DualQuaternion d = DualQuaternion::translation({4.0f, 0.0f, 0.0f})*DualQuaternion::rotation(Deg(90.0f), Vector3::zAxis());
+    Track<DualQuaternion> dualQuaternions{Interpolation::Spherical};
+    dualQuaternions.add(0.0f, c)
+                   .add(1.0f, d);
+    CORRADE_COMPARE(dualQuaternions.at(0.25f), Math::sclerp(c, d, 0.25f));
+
+    /* Same as linear for vectors */
+    Track<Vector3> vectors{Interpolation::Spherical};
+    vectors.add(0.0f, {1.0f, 0.0f, 0.0f})
+           .add(2.0f, {3.0f, 4.0f, 0.0f});
+    CORRADE_COMPARE(vectors.at(0.5f), (Vector3{1.5f, 1.0f, 0.0f}));
+}
+
+void TrackTest::cubicBezier() {
+    Track<Vector3> track{Interpolation::CubicBezier};
+    track.add(0.0f, {0.0f, 0.0f, 0.0f}, {}, {0.0f, 3.0f, 0.0f})
+         .add(1.0f, {3.0f, 0.0f, 0.0f}, {3.0f, 3.0f, 0.0f}, {});
+
+    /* Same as Math::Bezier */
+    const CubicBezier3D bezier{Vector3{0.0f, 0.0f, 0.0f}, Vector3{0.0f, 3.0f, 0.0f}, Vector3{3.0f, 3.0f, 0.0f}, Vector3{3.0f, 0.0f, 0.0f}};
+    CORRADE_COMPARE(track.at(0.5f), bezier.value(0.5f));
+    CORRADE_COMPARE(track.at(0.2f), bezier.value(0.2f));
+
+    /* Control points equal to the values result in a (non-uniform) line */
+    Track<Vector3> line{Interpolation::CubicBezier};
+    line.add(0.0f, {})
+        .add(1.0f, {2.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE(line.at(0.5f), (Vector3{1.0f, 0.0f, 0.0f}));
+
+    /* Quaternions are normalized */
+    Track<Quaternion> quaternions{Interpolation::CubicBezier};
+    quaternions.add(0.0f, {}, {}, Quaternion::rotation(Deg(10.0f), Vector3::xAxis()))
+               .add(1.0f, Quaternion::rotation(Deg(90.0f), Vector3::xAxis()), Quaternion::rotation(Deg(80.0f), Vector3::xAxis()), {});
+    CORRADE_VERIFY(quaternions.at(0.3f).isNormalized());
+    CORRADE_COMPARE(quaternions.at(0.5f), Quaternion::rotation(Deg(45.0f), Vector3::xAxis()));
+}
+
+void TrackTest::hintSequential() {
+    Track<Vector3> track;
+    for(std::size_t i = 0; i != 10; ++i)
+        track.add(Float(i), Vector3{Float(i)});
+
+    std::size_t hint = 0;
+    CORRADE_COMPARE(track.at(0.5f, hint), Vector3{0.5f});
+    CORRADE_COMPARE(hint, 0);
+    CORRADE_COMPARE(track.at(0.9f, hint), Vector3{0.9f});
+    CORRADE_COMPARE(hint, 0);
+    CORRADE_COMPARE(track.at(1.5f, hint), Vector3{1.5f});
+    CORRADE_COMPARE(hint, 1);
+    CORRADE_COMPARE(track.at(2.25f, hint), Vector3{2.25f});
+    CORRADE_COMPARE(hint, 2);
+    CORRADE_COMPARE(track.at(9.0f, hint), Vector3{9.0f});
+    CORRADE_COMPARE(hint, 9);
+    CORRADE_COMPARE(track.at(12.0f, hint), Vector3{9.0f});
+    CORRADE_COMPARE(hint, 9);
+}
+
+void TrackTest::hintSeek() {
+    Track<Vector3> track;
+    for(std::size_t i = 0; i != 10; ++i)
+        track.add(Float(i), Vector3{Float(i)});
+
+    /* Skipping keys falls back to binary search */
+    std::size_t hint = 1;
+    CORRADE_COMPARE(track.at(6.5f, hint), Vector3{6.5f});
+    CORRADE_COMPARE(hint, 6);
+
+    /* Invalid hint is also handled */
+    hint = 1000;
+    CORRADE_COMPARE(track.at(3.5f, hint), Vector3{3.5f});
+    CORRADE_COMPARE(hint, 3);
+}
+
+void TrackTest::hintReverse() {
+    Track<Vector3> track;
+    for(std::size_t i = 0; i != 10; ++i)
+        track.add(Float(i), Vector3{Float(i)});
+
+    /* Going back in time, e.g. after animation repeat */
+    std::size_t hint = 8;
+    CORRADE_COMPARE(track.at(0.25f, hint), Vector3{0.25f});
+    CORRADE_COMPARE(hint, 0);
+    CORRADE_COMPARE(track.at(-1.0f, hint), Vector3{0.0f});
+    CORRADE_COMPARE(hint, 0);
+}
+
+void TrackTest::debugInterpolation() {
+    std::ostringstream out;
+
+    Debug(&out) << Interpolation::CubicBezier << Interpolation(0xbe);
+    CORRADE_COMPARE(out.str(), "SceneGraph::Interpolation::CubicBezier SceneGraph::Interpolation(0xbe)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::TrackTest)
@@ -0,0 +1,220 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/TranslationRotationScalingTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+typedef Object<TranslationRotationScalingTransformation3D> Object3D;
+typedef Scene<TranslationRotationScalingTransformation3D> Scene3D;
+
+struct TranslationRotationScalingTransformation3DTest: TestSuite::Tester {
+    explicit TranslationRotationScalingTransformation3DTest();
+
+    void fromMatrix();
+    void toMatrix();
+    void compose();
+    void inverted();
+
+    void setTransformation();
+    void setTransformationReflection();
+    void setComponents();
+    void resetTransformation();
+    void translate();
+    void rotate();
+    void scale();
+};
+
+TranslationRotationScalingTransformation3DTest::TranslationRotationScalingTransformation3DTest() {
+    addTests({&TranslationRotationScalingTransformation3DTest::fromMatrix,
+              &TranslationRotationScalingTransformation3DTest::toMatrix,
+              &TranslationRotationScalingTransformation3DTest::compose,
+              &TranslationRotationScalingTransformation3DTest::inverted,
+
+              &TranslationRotationScalingTransformation3DTest::setTransformation,
+              &TranslationRotationScalingTransformation3DTest::setTransformationReflection,
+              &TranslationRotationScalingTransformation3DTest::setComponents,
+              &TranslationRotationScalingTransformation3DTest::resetTransformation,
+              &TranslationRotationScalingTransformation3DTest::translate,
+              &TranslationRotationScalingTransformation3DTest::rotate,
+              &TranslationRotationScalingTransformation3DTest::scale});
+}
+
+void TranslationRotationScalingTransformation3DTest::fromMatrix() {
+    Matrix4 m = Matrix4::rotationX(Deg(17.0f))*Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::scaling({2.0f, 1.4f, -2.1f});
+    CORRADE_COMPARE(Implementation::Transformation<TranslationRotationScalingTransformation3D>::fromMatrix(m), m);
+}
+
+void TranslationRotationScalingTransformation3DTest::toMatrix() {
+    Matrix4 m = Matrix4::rotationX(Deg(17.0f))*Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::scaling({2.0f, 1.4f, -2.1f});
+    CORRADE_COMPARE(Implementation::Transformation<TranslationRotationScalingTransformation3D>::toMatrix(m), m);
+}
+
+void TranslationRotationScalingTransformation3DTest::compose() {
+    Matrix4 parent = Matrix4::rotationX(Deg(17.0f));
+    Matrix4 child = Matrix4::translation({1.0f, -0.3f, 2.3f});
+    CORRADE_COMPARE(Implementation::Transformation<TranslationRotationScalingTransformation3D>::compose(parent, child), parent*child);
+}
+
+void TranslationRotationScalingTransformation3DTest::inverted() {
+    Matrix4 m = Matrix4::rotationX(Deg(17.0f))*Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::scaling({2.0f, 1.4f, -2.1f});
+    CORRADE_COMPARE(Implementation::Transformation<TranslationRotationScalingTransformation3D>::inverted(m)*m, Matrix4());
+}
+
+void TranslationRotationScalingTransformation3DTest::setTransformation() {
+    /* Dirty after setting transformation, decomposed to components */
+    Object3D o;
+    o.setClean();
+    CORRADE_VERIFY(!o.isDirty());
+    const Matrix4 m = Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::rotationX(Deg(17.0f))*Matrix4::scaling({2.0f, 1.4f, 2.1f});
+    o.setTransformation(m);
+    CORRADE_VERIFY(o.isDirty());
+    CORRADE_COMPARE(o.translation(), Vector3(1.0f, -0.3f, 2.3f));
+    CORRADE_COMPARE(o.rotation(), Quaternion::rotation(Deg(17.0f), Vector3::xAxis()));
+    CORRADE_COMPARE(o.scaling(), Vector3(2.0f, 1.4f, 2.1f));
+    CORRADE_COMPARE(o.transformationMatrix(), m);
+
+    /* Scene cannot be transformed */
+    Scene3D s;
+    s.setClean();
+    CORRADE_VERIFY(!s.isDirty());
+    s.setTransformation(Matrix4::rotationX(Deg(17.0f)));
+    CORRADE_VERIFY(!s.isDirty());
+    CORRADE_COMPARE(s.transformationMatrix(), Matrix4());
+}
+
+void TranslationRotationScalingTransformation3DTest::setTransformationReflection() {
+    Object3D o;
+    const Matrix4 m = Matrix4::rotationY(Deg(-35.0f))*Matrix4::scaling({2.0f, 1.4f, -2.1f});
+    o.setTransformation(m);
+    CORRADE_COMPARE(o.scaling().x(), -2.0f);
+    CORRADE_VERIFY(o.rotation().isNormalized());
+    CORRADE_COMPARE(o.transformationMatrix(), m);
+}
+
+void TranslationRotationScalingTransformation3DTest::setComponents() {
+    Object3D o;
+    o.setClean();
+    o.setTranslation({1.0f, -0.3f, 2.3f});
+    CORRADE_VERIFY(o.isDirty());
+
+    o.setClean();
+    o.setRotation(Quaternion::rotation(Deg(17.0f), Vector3::xAxis()));
+    CORRADE_VERIFY(o.isDirty());
+
+    o.setClean();
+    o.setScaling({2.0f, 1.4f, -2.1f});
+    CORRADE_VERIFY(o.isDirty());
+
+    CORRADE_COMPARE(o.transformationMatrix(),
+        Matrix4::translation({1.0f, -0.3f, 2.3f})*
+        Matrix4::rotationX(Deg(17.0f))*
+        Matrix4::scaling({2.0f, 1.4f, -2.1f}));
+
+    /* Rotation has to be normalized */
+    std::ostringstream out;
+    Error redirectError{&out};
+    o.setRotation(Quaternion{{1.0f, 2.0f, 3.0f}, 4.0f});
+    CORRADE_COMPARE(out.str(), "SceneGraph::TranslationRotationScalingTransformation3D::setRotation(): the quaternion must be normalized\n");
+    CORRADE_COMPARE(o.rotation(), Quaternion::rotation(Deg(17.0f), Vector3::xAxis()));
+}
+
+void TranslationRotationScalingTransformation3DTest::resetTransformation() {
+    Object3D o;
+    o.rotateX(Deg(17.0f))
+        .scale({2.0f, 1.4f, -2.1f});
+    CORRADE_VERIFY(o.transformationMatrix() != Matrix4());
+    o.resetTransformation();
+    CORRADE_COMPARE(o.transformationMatrix(), Matrix4());
+}
+
+void TranslationRotationScalingTransformation3DTest::translate() {
+    {
+        Object3D o;
+        o.setTransformation(Matrix4::rotationX(Deg(17.0f))*Matrix4::scaling({2.0f, 1.4f, -2.1f}));
+        o.translate({1.0f, -0.3f, 2.3f});
+        CORRADE_COMPARE(o.transformationMatrix(), Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::rotationX(Deg(17.0f))*Matrix4::scaling({2.0f, 1.4f, -2.1f}));
+    } {
+        Object3D o;
+        o.setTransformation(Matrix4::rotationX(Deg(17.0f))*Matrix4::scaling({2.0f, 1.4f, -2.1f}));
+        o.translateLocal({1.0f, -0.3f, 2.3f});
+        CORRADE_COMPARE(o.transformationMatrix(), Matrix4::rotationX(Deg(17.0f))*Matrix4::scaling({2.0f, 1.4f, -2.1f})*Matrix4::translation({1.0f, -0.3f, 2.3f}));
+    }
+}
+
+void TranslationRotationScalingTransformation3DTest::rotate() {
+    {
+        Object3D o;
+        o.setTransformation(Matrix4::translation({1.0f, -0.3f, 2.3f}));
+        o.rotateX(Deg(17.0f))
+            .rotateY(Deg(25.0f))
+            .rotateZ(Deg(-23.0f))
+            .rotate(Deg(96.0f), Vector3(1.0f/Constants::sqrt3()));
+        CORRADE_COMPARE(o.transformationMatrix(),
+            Matrix4::rotation(Deg(96.0f), Vector3(1.0f/Constants::sqrt3()))*
+            Matrix4::rotationZ(Deg(-23.0f))*
+            Matrix4::rotationY(Deg(25.0f))*
+            Matrix4::rotationX(Deg(17.0f))*
+            Matrix4::translation({1.0f, -0.3f, 2.3f}));
+    } {
+        /* Exact only with uniform scaling */
+        Object3D o;
+        o.setTransformation(Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::scaling(Vector3{1.5f}));
+        o.rotateXLocal(Deg(17.0f))
+            .rotateYLocal(Deg(25.0f))
+            .rotateZLocal(Deg(-23.0f))
+            .rotateLocal(Deg(96.0f), Vector3(1.0f/Constants::sqrt3()));
+        CORRADE_COMPARE(o.transformationMatrix(),
+            Matrix4::translation({1.0f, -0.3f, 2.3f})*
+            Matrix4::scaling(Vector3{1.5f})*
+            Matrix4::rotationX(Deg(17.0f))*
+            Matrix4::rotationY(Deg(25.0f))*
+            Matrix4::rotationZ(Deg(-23.0f))*
+            Matrix4::rotation(Deg(96.0f), Vector3(1.0f/Constants::sqrt3())));
+    }
+}
+
+void TranslationRotationScalingTransformation3DTest::scale() {
+    {
+        /* Exact only with uniform scaling */
+        Object3D o;
+        o.setTransformation(Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::rotationX(Deg(17.0f)));
+        o.scale(Vector3{2.5f});
+        CORRADE_COMPARE(o.transformationMatrix(), Matrix4::scaling(Vector3{2.5f})*Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::rotationX(Deg(17.0f)));
+    } {
+        Object3D o;
+        o.setTransformation(Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::rotationX(Deg(17.0f)));
+        o.scaleLocal({1.0f, -0.3f, 2.3f});
+        CORRADE_COMPARE(o.transformationMatrix(), Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::rotationX(Deg(17.0f))*Matrix4::scaling({1.0f, -0.3f, 2.3f}));
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::TranslationRotationScalingTransformation3DTest)
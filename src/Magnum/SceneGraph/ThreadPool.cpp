@@ -0,0 +1,142 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+struct ThreadPoolState {
+    std::vector<std::thread> threads;
+
+    std::mutex mutex;
+    std::condition_variable wakeUp, finished;
+
+    /* Current job, written only while all workers are waiting */
+    const std::function<void(std::size_t, std::size_t)>* function{};
+    std::size_t count{}, chunkSize{};
+    std::atomic<std::size_t> next{};
+
+    /* Incremented for every job, workers compare it with the last one they
+       processed to know there's new work */
+    std::size_t generation{};
+    std::size_t running{};
+    bool quit{};
+};
+
+}
+
+namespace {
+
+void work(Implementation::ThreadPoolState& state) {
+    for(;;) {
+        const std::size_t begin = state.next.fetch_add(state.chunkSize);
+        if(begin >= state.count) return;
+        (*state.function)(begin, std::min(begin + state.chunkSize, state.count));
+    }
+}
+
+void worker(Implementation::ThreadPoolState& state) {
+    std::size_t generation = 0;
+    for(;;) {
+        {
+            std::unique_lock<std::mutex> lock{state.mutex};
+            state.wakeUp.wait(lock, [&state, generation]() {
+                return state.quit || state.generation != generation;
+            });
+            if(state.quit) return;
+            generation = state.generation;
+        }
+
+        work(state);
+
+        {
+            std::lock_guard<std::mutex> lock{state.mutex};
+            if(--state.running == 0) state.finished.notify_one();
+        }
+    }
+}
+
+}
+
+ThreadPool::ThreadPool(UnsignedInt threadCount): _state{new Implementation::ThreadPoolState} {
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    _state->threads.reserve(threadCount - 1);
+    for(UnsignedInt i = 1; i < threadCount; ++i)
+        _state->threads.emplace_back(worker, std::ref(*_state));
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->quit = true;
+    }
+    _state->wakeUp.notify_all();
+
+    for(std::thread& thread: _state->threads) thread.join();
+}
+
+UnsignedInt ThreadPool::threadCount() const { return _state->threads.size() + 1; }
+
+void ThreadPool::parallelFor(const std::size_t count, const std::size_t chunkSize, const std::function<void(std::size_t, std::size_t)>& function) {
+    CORRADE_ASSERT(chunkSize, "SceneGraph::ThreadPool::parallelFor(): chunk size can't be zero", );
+
+    /* Not worth waking up the workers */
+    if(_state->threads.empty() || count <= chunkSize) {
+        for(std::size_t begin = 0; begin < count; begin += chunkSize)
+            function(begin, std::min(begin + chunkSize, count));
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->function = &function;
+        _state->count = count;
+        _state->chunkSize = chunkSize;
+        _state->next = 0;
+        _state->running = _state->threads.size();
+        ++_state->generation;
+    }
+    _state->wakeUp.notify_all();
+
+    work(*_state);
+
+    /* Wait until all workers are done, so the job can't be overwritten by
+       the next one while some worker is still processing it */
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    _state->finished.wait(lock, [this]() { return _state->running == 0; });
+}
+
+}}
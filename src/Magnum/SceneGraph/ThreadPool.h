@@ -0,0 +1,120 @@
+#ifndef Magnum_SceneGraph_ThreadPool_h
+#define Magnum_SceneGraph_ThreadPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::ThreadPool
+ */
+
+#include <functional>
+#include <memory>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation { struct ThreadPoolState; }
+
+/**
+@brief Thread pool
+
+Pool of worker threads for processing large scenes in parallel, used for
+example by @ref FlatScene::update(). The threads are created in the
+constructor and sleep when there is no work to do.
+
+Work is submitted using @ref parallelFor(), which splits given range into
+chunks. The chunks are not assigned to threads up front, but each thread takes
+the next unprocessed chunk once it finishes the previous one, so threads which
+finish early take over the remaining work of the slower ones. The calling
+thread participates in the work as well and the function returns only after
+all chunks are processed.
+@code
+SceneGraph::ThreadPool pool;
+pool.parallelFor(data.size(), 1024, [&](std::size_t begin, std::size_t end) {
+    for(std::size_t i = begin; i != end; ++i) process(data[i]);
+});
+@endcode
+
+The pool is not reentrant --- it's not possible to call @ref parallelFor()
+from inside the function being executed or from more than one thread at a
+time.
+*/
+class MAGNUM_SCENEGRAPH_EXPORT ThreadPool {
+    public:
+        /**
+         * @brief Constructor
+         * @param threadCount   Count of threads including the calling thread.
+         *      If `0`, @ref std::thread::hardware_concurrency() is used. If
+         *      `1`, no worker threads are created and all work is done on the
+         *      calling thread.
+         */
+        explicit ThreadPool(UnsignedInt threadCount = 0);
+
+        /** @brief Copying is not allowed */
+        ThreadPool(const ThreadPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ThreadPool(ThreadPool&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for all worker threads to finish.
+         */
+        ~ThreadPool();
+
+        /** @brief Copying is not allowed */
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ThreadPool& operator=(ThreadPool&&) = delete;
+
+        /** @brief Count of threads including the calling thread */
+        UnsignedInt threadCount() const;
+
+        /**
+         * @brief Execute a function on a range in parallel
+         * @param count         Size of the range
+         * @param chunkSize     Size of one chunk, expected to be non-zero
+         * @param function      Function to execute for each chunk
+         *
+         * Calls @p function with begin and end index of each chunk of the
+         * `[0, count)` range. All chunks except the last one have
+         * @p chunkSize items. The order and the thread in which the chunks
+         * are processed is unspecified, the function is expected to not
+         * depend on it. If @p count is not larger than @p chunkSize, the
+         * function is called directly without waking the worker threads.
+         */
+        void parallelFor(std::size_t count, std::size_t chunkSize, const std::function<void(std::size_t, std::size_t)>& function);
+
+    private:
+        std::unique_ptr<Implementation::ThreadPoolState> _state;
+};
+
+}}
+
+#endif
@@ -0,0 +1,283 @@
+#ifndef Magnum_SceneGraph_Track_h
+#define Magnum_SceneGraph_Track_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::Track, enum @ref Magnum::SceneGraph::Interpolation
+ */
+
+#include <algorithm>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Keyframe interpolation
+
+@see @ref Track
+*/
+enum class Interpolation: UnsignedByte {
+    /** Value of the preceding key is used until the next key */
+    Constant,
+
+    /**
+     * Linear interpolation. Quaternions and dual quaternions are normalized
+     * after interpolation.
+     */
+    Linear,
+
+    /**
+     * Spherical linear interpolation using @ref Math::slerp() for
+     * quaternions and @ref Math::sclerp() for dual quaternions. Same as
+     * @ref Interpolation::Linear for vectors.
+     */
+    Spherical,
+
+    /**
+     * Cubic Bézier interpolation between two keys using the out control
+     * point of the first and the in control point of the second key.
+     * Quaternions and dual quaternions are normalized after interpolation.
+     */
+    CubicBezier
+};
+
+/** @debugoperatorenum{Magnum::SceneGraph::Interpolation} */
+MAGNUM_SCENEGRAPH_EXPORT Debug& operator<<(Debug& debug, Interpolation value);
+
+namespace Implementation {
+    template<class> struct TrackTraits;
+    template<class T> struct TrackTraits<Math::Vector3<T>> {
+        typedef T Type;
+
+        static Math::Vector3<T> lerp(const Math::Vector3<T>& a, const Math::Vector3<T>& b, T t) {
+            return Math::lerp(a, b, t);
+        }
+        static Math::Vector3<T> slerp(const Math::Vector3<T>& a, const Math::Vector3<T>& b, T t) {
+            return Math::lerp(a, b, t);
+        }
+        static Math::Vector3<T> normalize(const Math::Vector3<T>& a) { return a; }
+    };
+    template<class T> struct TrackTraits<Math::Quaternion<T>> {
+        typedef T Type;
+
+        static Math::Quaternion<T> lerp(const Math::Quaternion<T>& a, const Math::Quaternion<T>& b, T t) {
+            return ((T(1) - t)*a + t*b).normalized();
+        }
+        static Math::Quaternion<T> slerp(const Math::Quaternion<T>& a, const Math::Quaternion<T>& b, T t) {
+            return Math::Implementation::slerp(a, b, t);
+        }
+        static Math::Quaternion<T> normalize(const Math::Quaternion<T>& a) {
+            return a.normalized();
+        }
+    };
+    template<class T> struct TrackTraits<Math::DualQuaternion<T>> {
+        typedef T Type;
+
+        static Math::DualQuaternion<T> lerp(const Math::DualQuaternion<T>& a, const Math::DualQuaternion<T>& b, T t) {
+            return (a*(T(1) - t) + b*t).normalized();
+        }
+        static Math::DualQuaternion<T> slerp(const Math::DualQuaternion<T>& a, const Math::DualQuaternion<T>& b, T t) {
+            return Math::Implementation::sclerp(a, b, t);
+        }
+        static Math::DualQuaternion<T> normalize(const Math::DualQuaternion<T>& a) {
+            return a.normalized();
+        }
+    };
+}
+
+/**
+@brief Keyframe animation track
+@tparam V   Value type, @ref Math::Vector3, @ref Math::Quaternion or
+    @ref Math::DualQuaternion
+
+Stores key times, values and (for @ref Interpolation::CubicBezier) control
+points in separate contiguous arrays, so the time lookup touches only the
+time array. Keys are expected to be added in ascending time order. Before the
+first key the first value is returned, after the last key the last value.
+
+@anchor SceneGraph-Track-lookup
+## Key lookup
+
+The @ref at(typename Track<V>::Type, std::size_t&) const overload takes a
+hint with index of the key found in the previous lookup. When the time
+advances monotonically (i.e. during playback), the hint or the key right
+after it is checked first and the lookup is @f$ \mathcal{O}(1) @f$, binary
+search is done only after seeking. Keep one hint per track and playback, as
+done in @ref BasicTrackPlayer "TrackPlayer".
+@see @ref Interpolation, @ref BasicTrackPlayer "TrackPlayer"
+*/
+template<class V> class Track {
+    public:
+        /** @brief Underlying time type */
+        typedef typename Implementation::TrackTraits<V>::Type Type;
+
+        /**
+         * @brief Constructor
+         * @param interpolation Key interpolation
+         */
+        explicit Track(Interpolation interpolation = Interpolation::Linear): _interpolation{interpolation} {}
+
+        /** @brief Key interpolation */
+        Interpolation interpolation() const { return _interpolation; }
+
+        /** @brief Key count */
+        std::size_t size() const { return _times.size(); }
+
+        /** @brief Whether the track is empty */
+        bool isEmpty() const { return _times.empty(); }
+
+        /** @brief Time of the last key or `0` if the track is empty */
+        Type duration() const { return _times.empty() ? Type(0) : _times.back(); }
+
+        /** @brief Key times */
+        Containers::ArrayView<const Type> times() const { return {_times.data(), _times.size()}; }
+
+        /** @brief Key values */
+        Containers::ArrayView<const V> values() const { return {_values.data(), _values.size()}; }
+
+        /**
+         * @brief Add key
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p time is not less than time of the last key. The
+         * control points of cubic Bézier interpolation are set to @p value.
+         */
+        Track<V>& add(Type time, const V& value) {
+            return add(time, value, value, value);
+        }
+
+        /**
+         * @brief Add key with Bézier control points
+         * @param time          Key time
+         * @param value         Key value
+         * @param inControlPoint  Control point used when interpolating from
+         *      the previous key
+         * @param outControlPoint Control point used when interpolating to
+         *      the next key
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p time is not less than time of the last key. The
+         * control points are used only with @ref Interpolation::CubicBezier.
+         */
+        Track<V>& add(Type time, const V& value, const V& inControlPoint, const V& outControlPoint) {
+            CORRADE_ASSERT(_times.empty() || _times.back() <= time,
+                "SceneGraph::Track::add(): keys must be added in ascending time order", *this);
+            _times.push_back(time);
+            _values.push_back(value);
+            _inControlPoints.push_back(inControlPoint);
+            _outControlPoints.push_back(outControlPoint);
+            return *this;
+        }
+
+        /**
+         * @brief Value at given time
+         *
+         * Finds the keys using binary search. Expects that the track is not
+         * empty.
+         * @see @ref at(Type, std::size_t&) const
+         */
+        V at(Type time) const {
+            std::size_t hint = 0;
+            return at(time, hint);
+        }
+
+        /**
+         * @brief Value at given time using a lookup hint
+         * @param time      Time
+         * @param hint      Index of the key found in the previous lookup,
+         *      updated to the key found in this one
+         *
+         * Expects that the track is not empty. See
+         * @ref SceneGraph-Track-lookup "class documentation" for more
+         * information.
+         */
+        V at(Type time, std::size_t& hint) const;
+
+    private:
+        std::size_t findKey(Type time, std::size_t hint) const;
+
+        Interpolation _interpolation;
+        std::vector<Type> _times;
+        std::vector<V> _values, _inControlPoints, _outControlPoints;
+};
+
+template<class V> std::size_t Track<V>::findKey(const Type time, const std::size_t hint) const {
+    const std::size_t last = _times.size() - 1;
+
+    /* Sequential playback: the key is either the same as before or the next
+       one */
+    if(hint < last && _times[hint] <= time) {
+        if(time < _times[hint + 1]) return hint;
+        if(hint + 1 == last || time < _times[hint + 2]) return hint + 1;
+    }
+
+    /* Seek, find the last key not greater than the time */
+    const std::size_t found = std::upper_bound(_times.begin(), _times.end(), time) - _times.begin();
+    return found ? found - 1 : 0;
+}
+
+template<class V> V Track<V>::at(const Type time, std::size_t& hint) const {
+    CORRADE_ASSERT(!_times.empty(), "SceneGraph::Track::at(): the track is empty", {});
+
+    const std::size_t i = hint = findKey(time, hint);
+
+    /* Clamp outside of the key range */
+    if(i + 1 == _times.size() || time <= _times[i])
+        return _values[time < _times[i] ? 0 : i];
+
+    if(_interpolation == Interpolation::Constant) return _values[i];
+
+    const Type t = (time - _times[i])/(_times[i + 1] - _times[i]);
+    switch(_interpolation) {
+        case Interpolation::Constant:
+        case Interpolation::Linear:
+            return Implementation::TrackTraits<V>::lerp(_values[i], _values[i + 1], t);
+        case Interpolation::Spherical:
+            return Implementation::TrackTraits<V>::slerp(_values[i], _values[i + 1], t);
+        case Interpolation::CubicBezier: {
+            const Type it = Type(1) - t;
+            return Implementation::TrackTraits<V>::normalize(
+                _values[i]*(it*it*it) +
+                _outControlPoints[i]*(Type(3)*it*it*t) +
+                _inControlPoints[i + 1]*(Type(3)*it*t*t) +
+                _values[i + 1]*(t*t*t));
+        }
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+}}
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef Magnum_SceneGraph_TrackPlayer_h
+#define Magnum_SceneGraph_TrackPlayer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BasicTrackPlayer, typedef @ref Magnum::SceneGraph::TrackPlayer
+ */
+
+#include <vector>
+
+#include "Magnum/SceneGraph/Animable.h"
+#include "Magnum/SceneGraph/Track.h"
+#include "Magnum/SceneGraph/TranslationRotationScalingTransformation3D.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Keyframe track player
+
+Plays @ref Track "tracks" bound to translation, rotation or scaling of objects
+using @ref BasicTranslationRotationScalingTransformation3D "TranslationRotationScalingTransformation3D".
+The player is an @ref Animable, its duration is the duration of the longest
+bound track and playback is controlled using @ref setState(),
+@ref setRepeated() and related functions. When the animation is stopped, the
+tracks are evaluated at the end so all targets are left in the final pose.
+
+## Usage
+
+@code
+typedef SceneGraph::Object<SceneGraph::TranslationRotationScalingTransformation3D> Object3D;
+
+SceneGraph::Track<Vector3> translation;
+translation.add(0.0f, {})
+           .add(2.0f, {0.0f, 3.0f, 0.0f});
+SceneGraph::Track<Quaternion> rotation{SceneGraph::Interpolation::Spherical};
+rotation.add(0.0f, {})
+        .add(2.0f, Quaternion::rotation(90.0_degf, Vector3::yAxis()));
+
+Object3D object{&scene};
+SceneGraph::TrackPlayer player{object, &animables};
+player.addTranslation(translation, object)
+      .addRotation(rotation, object)
+      .setState(SceneGraph::AnimationState::Running);
+@endcode
+
+The tracks are not copied, you have to ensure they are alive for the whole
+lifetime of the player.
+
+## Batch evaluation
+
+All bindings of the same kind are stored in one contiguous array together with
+the key lookup hint of each track, see
+@ref SceneGraph-Track-lookup "Track key lookup". In each
+@ref AnimableGroup::step() the player evaluates all tracks in a single pass
+and writes the values directly into the target objects, so with sequential
+playback the cost is constant per track regardless of key count. One player
+with many bindings is thus significantly cheaper than many players with one
+binding each.
+
+## Explicit template specializations
+
+The following specialization is explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref TrackPlayer.hpp implementation file to avoid linker
+errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref TrackPlayer
+
+@see @ref scenegraph, @ref Track, @ref TrackPlayer
+*/
+template<class T> class BasicTrackPlayer: public Animable<3, T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object this player belongs to
+         * @param group     Group this player belongs to
+         *
+         * Creates stopped non-repeating player with no tracks.
+         */
+        explicit BasicTrackPlayer(AbstractObject<3, T>& object, AnimableGroup<3, T>* group = nullptr);
+
+        /** @brief Count of bound tracks */
+        std::size_t trackCount() const {
+            return _translations.size() + _rotations.size() + _scalings.size() + _transformations.size();
+        }
+
+        /**
+         * @brief Bind translation track
+         * @return Reference to self (for method chaining)
+         *
+         * The track values are written using
+         * @ref BasicTranslationRotationScalingTransformation3D::setTranslation() "setTranslation()".
+         * Expects that the track is not empty.
+         */
+        BasicTrackPlayer<T>& addTranslation(const Track<Math::Vector3<T>>& track, Object<BasicTranslationRotationScalingTransformation3D<T>>& target);
+
+        /**
+         * @brief Bind rotation track
+         * @return Reference to self (for method chaining)
+         *
+         * The track values are written using
+         * @ref BasicTranslationRotationScalingTransformation3D::setRotation() "setRotation()".
+         * Expects that the track is not empty.
+         */
+        BasicTrackPlayer<T>& addRotation(const Track<Math::Quaternion<T>>& track, Object<BasicTranslationRotationScalingTransformation3D<T>>& target);
+
+        /**
+         * @brief Bind scaling track
+         * @return Reference to self (for method chaining)
+         *
+         * The track values are written using
+         * @ref BasicTranslationRotationScalingTransformation3D::setScaling() "setScaling()".
+         * Expects that the track is not empty.
+         */
+        BasicTrackPlayer<T>& addScaling(const Track<Math::Vector3<T>>& track, Object<BasicTranslationRotationScalingTransformation3D<T>>& target);
+
+        /**
+         * @brief Bind rigid transformation track
+         * @return Reference to self (for method chaining)
+         *
+         * Rotation and translation of the track values are written using
+         * @ref BasicTranslationRotationScalingTransformation3D::setRotation() "setRotation()"
+         * and @ref BasicTranslationRotationScalingTransformation3D::setTranslation() "setTranslation()",
+         * scaling of the target is kept. Expects that the track is not empty.
+         */
+        BasicTrackPlayer<T>& addTransformation(const Track<Math::DualQuaternion<T>>& track, Object<BasicTranslationRotationScalingTransformation3D<T>>& target);
+
+        /**
+         * @brief Evaluate all tracks
+         *
+         * Evaluates all bound tracks at given time and writes the values to
+         * their targets. Called from @ref animationStep(), can be used also
+         * to seek while the animation is not running.
+         */
+        void evaluate(T time);
+
+    protected:
+        void animationStep(Float time, Float delta) override;
+
+        /* Finish at the final pose regardless of frame rate */
+        void animationStopped() override;
+
+    private:
+        template<class V> struct Binding {
+            const Track<V>* track;
+            Object<BasicTranslationRotationScalingTransformation3D<T>>* target;
+            std::size_t hint;
+        };
+
+        void updateDuration(T duration);
+
+        std::vector<Binding<Math::Vector3<T>>> _translations;
+        std::vector<Binding<Math::Quaternion<T>>> _rotations;
+        std::vector<Binding<Math::Vector3<T>>> _scalings;
+        std::vector<Binding<Math::DualQuaternion<T>>> _transformations;
+};
+
+/**
+@brief Keyframe track player for float scenes
+
+@see @ref Track
+*/
+typedef BasicTrackPlayer<Float> TrackPlayer;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT BasicTrackPlayer<Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef Magnum_SceneGraph_TrackPlayer_hpp
+#define Magnum_SceneGraph_TrackPlayer_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref TrackPlayer.h
+ */
+
+#include "Magnum/SceneGraph/TrackPlayer.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<class T> BasicTrackPlayer<T>::BasicTrackPlayer(AbstractObject<3, T>& object, AnimableGroup<3, T>* group): Animable<3, T>{object, group} {}
+
+template<class T> void BasicTrackPlayer<T>::updateDuration(const T duration) {
+    if(duration > this->duration()) this->setDuration(Float(duration));
+}
+
+template<class T> BasicTrackPlayer<T>& BasicTrackPlayer<T>::addTranslation(const Track<Math::Vector3<T>>& track, Object<BasicTranslationRotationScalingTransformation3D<T>>& target) {
+    CORRADE_ASSERT(!track.isEmpty(), "SceneGraph::TrackPlayer::addTranslation(): the track is empty", *this);
+    _translations.push_back({&track, &target, 0});
+    updateDuration(track.duration());
+    return *this;
+}
+
+template<class T> BasicTrackPlayer<T>& BasicTrackPlayer<T>::addRotation(const Track<Math::Quaternion<T>>& track, Object<BasicTranslationRotationScalingTransformation3D<T>>& target) {
+    CORRADE_ASSERT(!track.isEmpty(), "SceneGraph::TrackPlayer::addRotation(): the track is empty", *this);
+    _rotations.push_back({&track, &target, 0});
+    updateDuration(track.duration());
+    return *this;
+}
+
+template<class T> BasicTrackPlayer<T>& BasicTrackPlayer<T>::addScaling(const Track<Math::Vector3<T>>& track, Object<BasicTranslationRotationScalingTransformation3D<T>>& target) {
+    CORRADE_ASSERT(!track.isEmpty(), "SceneGraph::TrackPlayer::addScaling(): the track is empty", *this);
+    _scalings.push_back({&track, &target, 0});
+    updateDuration(track.duration());
+    return *this;
+}
+
+template<class T> BasicTrackPlayer<T>& BasicTrackPlayer<T>::addTransformation(const Track<Math::DualQuaternion<T>>& track, Object<BasicTranslationRotationScalingTransformation3D<T>>& target) {
+    CORRADE_ASSERT(!track.isEmpty(), "SceneGraph::TrackPlayer::addTransformation(): the track is empty", *this);
+    _transformations.push_back({&track, &target, 0});
+    updateDuration(track.duration());
+    return *this;
+}
+
+template<class T> void BasicTrackPlayer<T>::evaluate(const T time) {
+    for(Binding<Math::Vector3<T>>& binding: _translations)
+        binding.target->setTranslation(binding.track->at(time, binding.hint));
+    for(Binding<Math::Quaternion<T>>& binding: _rotations)
+        binding.target->setRotation(binding.track->at(time, binding.hint));
+    for(Binding<Math::Vector3<T>>& binding: _scalings)
+        binding.target->setScaling(binding.track->at(time, binding.hint));
+    for(Binding<Math::DualQuaternion<T>>& binding: _transformations) {
+        const Math::DualQuaternion<T> transformation = binding.track->at(time, binding.hint);
+        binding.target->setRotation(transformation.rotation())
+            .setTranslation(transformation.translation());
+    }
+}
+
+template<class T> void BasicTrackPlayer<T>::animationStep(const Float time, Float) {
+    evaluate(T(time));
+}
+
+template<class T> void BasicTrackPlayer<T>::animationStopped() {
+    evaluate(T(this->duration()));
+}
+
+}}
+
+#endif
@@ -0,0 +1,337 @@
+#ifndef Magnum_SceneGraph_TranslationRotationScalingTransformation3D_h
+#define Magnum_SceneGraph_TranslationRotationScalingTransformation3D_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BasicTranslationRotationScalingTransformation3D, typedef @ref Magnum::SceneGraph::TranslationRotationScalingTransformation3D
+ */
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/SceneGraph/AbstractTranslationRotationScaling3D.h"
+#include "Magnum/SceneGraph/Object.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Three-dimensional transformation implemented using separate translation, rotation and scaling
+
+Stores translation as @ref Math::Vector3, rotation as normalized
+@ref Math::Quaternion and scaling as @ref Math::Vector3, the resulting
+transformation is composed as translation * rotation * scaling. Unlike
+@ref BasicMatrixTransformation3D "MatrixTransformation3D", the components can
+be queried and replaced independently without any decomposition, which makes
+this class a natural target for animation tracks (see
+@ref BasicTrackPlayer "TrackPlayer").
+
+The representation can't express shear, thus global scaling (@ref scale())
+and local rotation (@ref rotateLocal()) are exact only if the scaling is
+uniform or the rotation is aligned with the scaling axes.
+@see @ref scenegraph, @ref TranslationRotationScalingTransformation3D,
+    @ref BasicMatrixTransformation3D
+*/
+template<class T> class BasicTranslationRotationScalingTransformation3D: public AbstractBasicTranslationRotationScaling3D<T> {
+    public:
+        /** @brief Underlying transformation type */
+        typedef Math::Matrix4<T> DataType;
+
+        /**
+         * @brief Object transformation
+         *
+         * Composed from @ref translation(), @ref rotation() and
+         * @ref scaling().
+         */
+        Math::Matrix4<T> transformation() const {
+            return Math::Matrix4<T>::from(_rotation.toMatrix()*Math::Matrix3x3<T>::fromDiagonal(_scaling), _translation);
+        }
+
+        /** @brief Object translation */
+        Math::Vector3<T> translation() const { return _translation; }
+
+        /** @brief Object rotation */
+        Math::Quaternion<T> rotation() const { return _rotation; }
+
+        /** @brief Object scaling */
+        Math::Vector3<T> scaling() const { return _scaling; }
+
+        /**
+         * @brief Set transformation
+         * @return Reference to self (for method chaining)
+         *
+         * Decomposes the matrix into translation, rotation and scaling.
+         * Expects that the matrix doesn't contain shear or projection,
+         * reflection is expressed as negative scaling in X.
+         */
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& setTransformation(const Math::Matrix4<T>& transformation) {
+            const Math::Matrix3x3<T> rotationScaling = transformation.rotationScaling();
+            Math::Vector3<T> scaling{rotationScaling[0].length(),
+                                     rotationScaling[1].length(),
+                                     rotationScaling[2].length()};
+            if(rotationScaling.determinant() < T(0)) scaling.x() = -scaling.x();
+
+            return setTransformationInternal(transformation.translation(),
+                Math::Quaternion<T>::fromMatrix(rotationScaling*Math::Matrix3x3<T>::fromDiagonal(T(1)/scaling)),
+                scaling);
+        }
+
+        /**
+         * @brief Set translation
+         * @return Reference to self (for method chaining)
+         */
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& setTranslation(const Math::Vector3<T>& translation) {
+            return setTransformationInternal(translation, _rotation, _scaling);
+        }
+
+        /**
+         * @brief Set rotation
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the quaternion is normalized.
+         * @see @ref Math::Quaternion::isNormalized()
+         */
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& setRotation(const Math::Quaternion<T>& rotation) {
+            CORRADE_ASSERT(rotation.isNormalized(),
+                "SceneGraph::TranslationRotationScalingTransformation3D::setRotation(): the quaternion must be normalized",
+                static_cast<Object<BasicTranslationRotationScalingTransformation3D<T>>&>(*this));
+            return setTransformationInternal(_translation, rotation, _scaling);
+        }
+
+        /**
+         * @brief Set scaling
+         * @return Reference to self (for method chaining)
+         */
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& setScaling(const Math::Vector3<T>& scaling) {
+            return setTransformationInternal(_translation, _rotation, scaling);
+        }
+
+        /** @copydoc AbstractTranslationRotationScaling3D::resetTransformation() */
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& resetTransformation() {
+            return setTransformationInternal({}, {}, Math::Vector3<T>{T(1)});
+        }
+
+        /**
+         * @brief Translate object
+         * @return Reference to self (for method chaining)
+         *
+         * Adds the vector to @ref translation().
+         * @see @ref translateLocal(), @ref Math::Vector3::xAxis(),
+         *      @ref Math::Vector3::yAxis(), @ref Math::Vector3::zAxis()
+         */
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& translate(const Math::Vector3<T>& vector) {
+            return setTransformationInternal(_translation + vector, _rotation, _scaling);
+        }
+
+        /**
+         * @brief Translate object as a local transformation
+         *
+         * Similar to the above, except that the transformation is applied
+         * before all others.
+         */
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& translateLocal(const Math::Vector3<T>& vector) {
+            return setTransformationInternal(_translation + _rotation.transformVectorNormalized(_scaling*vector), _rotation, _scaling);
+        }
+
+        /**
+         * @brief Rotate object using a quaternion
+         * @param normalizedRotation    Normalized quaternion
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the quaternion is normalized. Rotates also the
+         * translation.
+         * @see @ref rotateLocal()
+         */
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& rotate(const Math::Quaternion<T>& normalizedRotation) {
+            CORRADE_ASSERT(normalizedRotation.isNormalized(),
+                "SceneGraph::TranslationRotationScalingTransformation3D::rotate(): the quaternion must be normalized",
+                static_cast<Object<BasicTranslationRotationScalingTransformation3D<T>>&>(*this));
+            return setTransformationInternal(normalizedRotation.transformVectorNormalized(_translation), (normalizedRotation*_rotation).normalized(), _scaling);
+        }
+
+        /**
+         * @brief Rotate object using a quaternion as a local transformation
+         *
+         * Similar to the above, except that the transformation is applied
+         * before all others. Exact only if the scaling is uniform, see
+         * @ref BasicTranslationRotationScalingTransformation3D "class documentation"
+         * for details.
+         */
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& rotateLocal(const Math::Quaternion<T>& normalizedRotation) {
+            CORRADE_ASSERT(normalizedRotation.isNormalized(),
+                "SceneGraph::TranslationRotationScalingTransformation3D::rotateLocal(): the quaternion must be normalized",
+                static_cast<Object<BasicTranslationRotationScalingTransformation3D<T>>&>(*this));
+            return setTransformationInternal(_translation, (_rotation*normalizedRotation).normalized(), _scaling);
+        }
+
+        /**
+         * @brief Rotate object
+         * @param angle             Angle (counterclockwise)
+         * @param normalizedAxis    Normalized rotation axis
+         * @return Reference to self (for method chaining)
+         *
+         * Same as calling @ref rotate(const Math::Quaternion<T>&) with
+         * @ref Math::Quaternion::rotation().
+         * @see @ref rotateLocal(), @ref Math::Vector3::xAxis(),
+         *      @ref Math::Vector3::yAxis(), @ref Math::Vector3::zAxis()
+         */
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& rotate(Math::Rad<T> angle, const Math::Vector3<T>& normalizedAxis) {
+            return rotate(Math::Quaternion<T>::rotation(angle, normalizedAxis));
+        }
+
+        /**
+         * @brief Rotate object as a local transformation
+         *
+         * Similar to the above, except that the transformation is applied
+         * before all others. Same as calling
+         * @ref rotateLocal(const Math::Quaternion<T>&) with
+         * @ref Math::Quaternion::rotation().
+         */
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& rotateLocal(Math::Rad<T> angle, const Math::Vector3<T>& normalizedAxis) {
+            return rotateLocal(Math::Quaternion<T>::rotation(angle, normalizedAxis));
+        }
+
+        /* Overloads to remove WTF-factor from method chaining order */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& rotateX(Math::Rad<T> angle) {
+            return rotate(angle, Math::Vector3<T>::xAxis());
+        }
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& rotateXLocal(Math::Rad<T> angle) {
+            return rotateLocal(angle, Math::Vector3<T>::xAxis());
+        }
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& rotateY(Math::Rad<T> angle) {
+            return rotate(angle, Math::Vector3<T>::yAxis());
+        }
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& rotateYLocal(Math::Rad<T> angle) {
+            return rotateLocal(angle, Math::Vector3<T>::yAxis());
+        }
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& rotateZ(Math::Rad<T> angle) {
+            return rotate(angle, Math::Vector3<T>::zAxis());
+        }
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& rotateZLocal(Math::Rad<T> angle) {
+            return rotateLocal(angle, Math::Vector3<T>::zAxis());
+        }
+        #endif
+
+        /**
+         * @brief Scale object
+         * @return Reference to self (for method chaining)
+         *
+         * Scales both translation and scaling. Exact only if the scaling is
+         * uniform, see
+         * @ref BasicTranslationRotationScalingTransformation3D "class documentation"
+         * for details.
+         * @see @ref scaleLocal(), @ref Math::Vector3::xScale(),
+         *      @ref Math::Vector3::yScale(), @ref Math::Vector3::zScale()
+         */
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& scale(const Math::Vector3<T>& vector) {
+            return setTransformationInternal(_translation*vector, _rotation, _scaling*vector);
+        }
+
+        /**
+         * @brief Scale object as a local transformation
+         *
+         * Similar to the above, except that the transformation is applied
+         * before all others.
+         */
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& scaleLocal(const Math::Vector3<T>& vector) {
+            return setTransformationInternal(_translation, _rotation, _scaling*vector);
+        }
+
+    protected:
+        /* Allow construction only from Object */
+        explicit BasicTranslationRotationScalingTransformation3D(): _scaling{T(1)} {}
+
+    private:
+        void doResetTransformation() override final { resetTransformation(); }
+
+        void doTranslate(const Math::Vector3<T>& vector) override final { translate(vector); }
+        void doTranslateLocal(const Math::Vector3<T>& vector) override final { translateLocal(vector); }
+
+        void doRotate(Math::Rad<T> angle, const Math::Vector3<T>& normalizedAxis) override final {
+            rotate(angle, normalizedAxis);
+        }
+        void doRotateLocal(Math::Rad<T> angle, const Math::Vector3<T>& normalizedAxis) override final {
+            rotateLocal(angle, normalizedAxis);
+        }
+
+        void doScale(const Math::Vector3<T>& vector) override final { scale(vector); }
+        void doScaleLocal(const Math::Vector3<T>& vector) override final { scaleLocal(vector); }
+
+        /* No assertions fired, for internal use */
+        Object<BasicTranslationRotationScalingTransformation3D<T>>& setTransformationInternal(const Math::Vector3<T>& translation, const Math::Quaternion<T>& rotation, const Math::Vector3<T>& scaling) {
+            /* Setting transformation is forbidden for the scene */
+            /** @todo Assert for this? */
+            /** @todo Do this in some common code so we don't need to include Object? */
+            if(!static_cast<Object<BasicTranslationRotationScalingTransformation3D<T>>*>(this)->isScene()) {
+                _translation = translation;
+                _rotation = rotation;
+                _scaling = scaling;
+                static_cast<Object<BasicTranslationRotationScalingTransformation3D<T>>*>(this)->setDirty();
+            }
+
+            return static_cast<Object<BasicTranslationRotationScalingTransformation3D<T>>&>(*this);
+        }
+
+        Math::Vector3<T> _translation;
+        Math::Quaternion<T> _rotation;
+        Math::Vector3<T> _scaling;
+};
+
+/**
+@brief Three-dimensional transformation for float scenes implemented using separate translation, rotation and scaling
+
+@see @ref MatrixTransformation3D
+*/
+typedef BasicTranslationRotationScalingTransformation3D<Float> TranslationRotationScalingTransformation3D;
+
+namespace Implementation {
+
+template<class T> struct Transformation<BasicTranslationRotationScalingTransformation3D<T>> {
+    constexpr static Math::Matrix4<T> fromMatrix(const Math::Matrix4<T>& matrix) {
+        return matrix;
+    }
+
+    constexpr static Math::Matrix4<T> toMatrix(const Math::Matrix4<T>& transformation) {
+        return transformation;
+    }
+
+    static Math::Matrix4<T> compose(const Math::Matrix4<T>& parent, const Math::Matrix4<T>& child) {
+        return parent*child;
+    }
+
+    static Math::Matrix4<T> inverted(const Math::Matrix4<T>& transformation) {
+        return transformation.inverted();
+    }
+};
+
+}
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT Object<BasicTranslationRotationScalingTransformation3D<Float>>;
+#endif
+
+}}
+
+#endif
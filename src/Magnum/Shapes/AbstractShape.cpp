@@ -33,8 +33,15 @@
 
 namespace Magnum { namespace Shapes {
 
-template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float>(object, group) {
+template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float>(object, group), _dirtyGroup{}, _dirtyIndex{} {
     SceneGraph::AbstractFeature<dimensions, Float>::setCachedTransformations(SceneGraph::CachedTransformation::Absolute);
+
+    /* The object doesn't notify its features again if it's already dirty */
+    if(group && object.isDirty()) AbstractShape<dimensions>::markDirty();
+}
+
+template<UnsignedInt dimensions> AbstractShape<dimensions>::~AbstractShape() {
+    if(_dirtyGroup) _dirtyGroup->removeDirtyShape(*this);
 }
 
 template<UnsignedInt dimensions> ShapeGroup<dimensions>* AbstractShape<dimensions>::group() {
@@ -58,7 +65,16 @@ template<UnsignedInt dimensions> Collision<dimensions> AbstractShape<dimensions>
 }
 
 template<UnsignedInt dimensions> void AbstractShape<dimensions>::markDirty() {
-    if(group()) group()->setDirty();
+    ShapeGroup<dimensions>* const group = this->group();
+
+    /* Record the shape in its current group, so the group can clean only
+       the shapes that changed */
+    if(_dirtyGroup != group) {
+        if(_dirtyGroup) _dirtyGroup->removeDirtyShape(*this);
+        if(group) group->addDirtyShape(*this);
+    }
+
+    if(group) group->setDirty();
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -29,17 +29,50 @@
 
 namespace Magnum { namespace Shapes {
 
+template<UnsignedInt dimensions> ShapeGroup<dimensions>::~ShapeGroup() {
+    for(AbstractShape<dimensions>* shape: _dirtyShapes)
+        shape->_dirtyGroup = nullptr;
+}
+
+template<UnsignedInt dimensions> ShapeGroup<dimensions>& ShapeGroup<dimensions>::add(AbstractShape<dimensions>& shape) {
+    SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>, Float>::add(shape);
+
+    /* The object doesn't notify its features again if it's already dirty */
+    if(shape.object().isDirty()) shape.AbstractShape<dimensions>::markDirty();
+    return *this;
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::addDirtyShape(AbstractShape<dimensions>& shape) {
+    shape._dirtyGroup = this;
+    shape._dirtyIndex = _dirtyShapes.size();
+    _dirtyShapes.push_back(&shape);
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::removeDirtyShape(AbstractShape<dimensions>& shape) {
+    /* Move the last shape in place of the removed one */
+    _dirtyShapes[shape._dirtyIndex] = _dirtyShapes.back();
+    _dirtyShapes[shape._dirtyIndex]->_dirtyIndex = shape._dirtyIndex;
+    _dirtyShapes.pop_back();
+    shape._dirtyGroup = nullptr;
+}
+
 template<UnsignedInt dimensions> void ShapeGroup<dimensions>::setClean() {
-    /* Clean all objects */
-    if(!this->isEmpty()) {
-        std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>> objects;
-        objects.reserve(this->size());
-        for(std::size_t i = 0; i != this->size(); ++i)
-            objects.push_back((*this)[i].object());
-
-        SceneGraph::AbstractObject<dimensions, Float>::setClean(objects);
+    if(!dirty) return;
+
+    /* Go only through shapes that changed since the last clean. The first
+       dirty object found cleans all dirty objects in its scene, as the scene
+       keeps track of them, so other changed shapes in the same scene are
+       already clean when reached. Objects without a scene are cleaned one by
+       one. */
+    for(AbstractShape<dimensions>* shape: _dirtyShapes) {
+        shape->_dirtyGroup = nullptr;
+        SceneGraph::AbstractObject<dimensions, Float>& object = shape->object();
+        if(!object.isDirty()) continue;
+        if(object.scene()) object.setSceneClean();
+        else object.setClean();
     }
 
+    _dirtyShapes.clear();
     dirty = false;
 }
 
@@ -52,6 +85,21 @@ template<UnsignedInt dimensions> AbstractShape<dimensions>* ShapeGroup<dimension
     return nullptr;
 }
 
+template<UnsignedInt dimensions> AbstractShape<dimensions>* ShapeGroup<dimensions>::firstCollision(const AbstractShape<dimensions>& shape, ShapeIndex<dimensions>& index) {
+    CORRADE_ASSERT(index.contains(shape),
+        "Shapes::ShapeGroup::firstCollision(): the shape is not in the index", nullptr);
+
+    /* The index cleans its scene, which is all the candidates need. Cleaning
+       the whole group would make the query as expensive as the brute-force
+       one. */
+    index.queryBox(index.absoluteBounds(shape), _candidates);
+    for(AbstractShape<dimensions>& candidate: _candidates)
+        if(&candidate != &shape && candidate.group() == this && candidate.collides(shape))
+            return &candidate;
+
+    return nullptr;
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT ShapeGroup<2>;
 template class MAGNUM_SHAPES_EXPORT ShapeGroup<3>;
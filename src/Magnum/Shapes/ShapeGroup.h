@@ -26,17 +26,45 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::Shapes::ShapeGroup, typedef @ref Magnum::Shapes::ShapeGroup2D, @ref Magnum::Shapes::ShapeGroup3D
+ * @brief Class @ref Magnum::Shapes::ShapeGroup, alias @ref Magnum::Shapes::ShapeIndex, typedef @ref Magnum::Shapes::ShapeGroup2D, @ref Magnum::Shapes::ShapeGroup3D, @ref Magnum::Shapes::ShapeIndex2D, @ref Magnum::Shapes::ShapeIndex3D
  */
 
+#include <functional>
 #include <vector>
 
 #include "Magnum/SceneGraph/FeatureGroup.h"
+#include "Magnum/SceneGraph/SpatialIndex.h"
 #include "Magnum/Shapes/AbstractShape.h"
 #include "Magnum/Shapes/visibility.h"
 
 namespace Magnum { namespace Shapes {
 
+/**
+@brief Spatial index of shapes
+
+Can be used as a broad phase in
+@ref ShapeGroup::firstCollision(const AbstractShape<dimensions>&, ShapeIndex<dimensions>&).
+See @ref SceneGraph::SpatialIndex for more information.
+@see @ref ShapeIndex2D, @ref ShapeIndex3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<UnsignedInt dimensions> using ShapeIndex = SceneGraph::SpatialIndex<dimensions, AbstractShape<dimensions>, Float>;
+#endif
+
+/**
+@brief Spatial index of two-dimensional shapes
+
+@see @ref ShapeIndex3D
+*/
+typedef ShapeIndex<2> ShapeIndex2D;
+
+/**
+@brief Spatial index of three-dimensional shapes
+
+@see @ref ShapeIndex2D
+*/
+typedef ShapeIndex<3> ShapeIndex3D;
+
 /**
 @brief Group of shapes
 
@@ -54,6 +82,8 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          */
         explicit ShapeGroup(): dirty(true) {}
 
+        ~ShapeGroup();
+
         /**
          * @brief Whether the group is dirty
          * @return True if any object in the group is dirty, false otherwise.
@@ -70,11 +100,28 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          */
         void setDirty() { dirty = true; }
 
+        /**
+         * @brief Add shape to the group
+         * @return Reference to self (for method chaining)
+         *
+         * Same as @ref SceneGraph::FeatureGroup::add(), but if the object
+         * holding the shape is dirty, the shape is also remembered for
+         * @ref setClean().
+         */
+        ShapeGroup<dimensions>& add(AbstractShape<dimensions>& shape);
+
         /**
          * @brief Set the group and all bodies as clean
          *
          * This function is called before computing any collisions to ensure
-         * all objects are cleaned.
+         * all objects are cleaned. Does nothing if the group isn't dirty.
+         * The group remembers shapes whose objects were marked dirty since
+         * the last call, so the cost is proportional to the count of changed
+         * shapes, not the group size. Calls @ref SceneGraph::AbstractObject::setSceneClean()
+         * once for each scene containing a changed shape, so all dirty
+         * objects in these scenes are cleaned, not just the ones in this
+         * group. Objects that aren't part of any scene are cleaned
+         * separately.
          */
         void setClean();
 
@@ -87,8 +134,31 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          */
         AbstractShape<dimensions>* firstCollision(const AbstractShape<dimensions>& shape);
 
+        /**
+         * @brief First collision of given shape with other shapes in the group using spatial index
+         *
+         * Same as @ref firstCollision(const AbstractShape<dimensions>&), but
+         * tests only shapes with bounds in @p index intersecting bounds of
+         * given shape. Shapes of this group that aren't in the index are not
+         * tested at all, shapes in the index that aren't in this group are
+         * ignored. Given shape is expected to be in the index. Unlike
+         * @ref firstCollision(const AbstractShape<dimensions>&), doesn't call
+         * @ref setClean(), only the scene of the index is cleaned by the
+         * query, so the cost doesn't depend on the group size.
+         */
+        AbstractShape<dimensions>* firstCollision(const AbstractShape<dimensions>& shape, ShapeIndex<dimensions>& index);
+
     private:
+        void MAGNUM_SHAPES_LOCAL addDirtyShape(AbstractShape<dimensions>& shape);
+        void MAGNUM_SHAPES_LOCAL removeDirtyShape(AbstractShape<dimensions>& shape);
+
         bool dirty;
+
+        /* Shapes whose objects were marked dirty since the last clean */
+        std::vector<AbstractShape<dimensions>*> _dirtyShapes;
+
+        /* Candidates from the index, kept to avoid reallocations */
+        std::vector<std::reference_wrapper<AbstractShape<dimensions>>> _candidates;
 };
 
 /**
@@ -30,6 +30,7 @@
  */
 
 #include "Magnum/Types.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
 
 namespace Magnum { namespace Shapes {
 
@@ -76,6 +77,10 @@ template<UnsignedInt> class ShapeGroup;
 typedef ShapeGroup<2> ShapeGroup2D;
 typedef ShapeGroup<3> ShapeGroup3D;
 
+template<UnsignedInt dimensions> using ShapeIndex = SceneGraph::SpatialIndex<dimensions, AbstractShape<dimensions>, Float>;
+typedef ShapeIndex<2> ShapeIndex2D;
+typedef ShapeIndex<3> ShapeIndex3D;
+
 template<UnsignedInt> class Sphere;
 typedef Sphere<2> Sphere2D;
 typedef Sphere<3> Sphere3D;
@@ -40,9 +40,13 @@ struct ShapeTest: TestSuite::Tester {
     explicit ShapeTest();
 
     void clean();
+    void cleanMultipleScenes();
+    void cleanChangedOnly();
     void collides();
     void collision();
     void firstCollision();
+    void firstCollisionIndex();
+    void firstCollisionIndexCandidatesOnly();
     void shapeGroup();
 };
 
@@ -53,9 +57,13 @@ typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
 
 ShapeTest::ShapeTest() {
     addTests({&ShapeTest::clean,
+              &ShapeTest::cleanMultipleScenes,
+              &ShapeTest::cleanChangedOnly,
               &ShapeTest::collides,
               &ShapeTest::collision,
               &ShapeTest::firstCollision,
+              &ShapeTest::firstCollisionIndex,
+              &ShapeTest::firstCollisionIndexCandidatesOnly,
               &ShapeTest::shapeGroup});
 }
 
@@ -99,6 +107,71 @@ void ShapeTest::clean() {
     CORRADE_VERIFY(b.isDirty());
 }
 
+void ShapeTest::cleanMultipleScenes() {
+    Scene3D scene;
+    Scene3D another;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    new Shapes::Shape<Shapes::Point3D>(a, &shapes);
+
+    Object3D b(&another);
+    auto shape = new Shapes::Shape<Shapes::Point3D>(b, {{1.0f, -2.0f, 3.0f}}, &shapes);
+    b.translate(Vector3::xAxis(1.0f));
+
+    /* Not in any scene */
+    Object3D c;
+    new Shapes::Shape<Shapes::Point3D>(c, &shapes);
+
+    /* Objects in all scenes are cleaned, not just the first one */
+    shapes.setClean();
+    CORRADE_VERIFY(!shapes.isDirty());
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(shape->transformedShape().position(),
+        Vector3(2.0f, -2.0f, 3.0f));
+}
+
+void ShapeTest::cleanChangedOnly() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    new Shapes::Shape<Shapes::Point3D>(a, &shapes);
+    shapes.setClean();
+    CORRADE_VERIFY(!a.isDirty());
+
+    /* Object without any shape in the group, the group isn't dirty so it
+       doesn't touch the scene */
+    Object3D b(&scene);
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_VERIFY(!shapes.isDirty());
+    shapes.setClean();
+    CORRADE_VERIFY(b.isDirty());
+
+    /* Shape added later to an object that's already dirty */
+    Object3D c(&scene);
+    c.translate(Vector3::xAxis(1.0f));
+    Shapes::Shape<Shapes::Point3D> cShape(c, {{1.0f, -2.0f, 3.0f}});
+    shapes.add(cShape);
+    CORRADE_VERIFY(shapes.isDirty());
+    shapes.setClean();
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(cShape.transformedShape().position(),
+        Vector3(2.0f, -2.0f, 3.0f));
+
+    /* Shape destroyed while waiting for the clean */
+    {
+        Object3D d(&scene);
+        new Shapes::Shape<Shapes::Point3D>(d, &shapes);
+        a.translate(Vector3::xAxis(1.0f));
+        CORRADE_VERIFY(shapes.isDirty());
+    }
+    shapes.setClean();
+    CORRADE_VERIFY(!a.isDirty());
+}
+
 void ShapeTest::collides() {
     Scene3D scene;
     ShapeGroup3D shapes;
@@ -206,6 +279,66 @@ void ShapeTest::firstCollision() {
     CORRADE_VERIFY(!shapes.isDirty());
 }
 
+void ShapeTest::firstCollisionIndex() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+    ShapeIndex3D index{{Vector3{-10.0f}, Vector3{10.0f}}};
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> aShape(a, {{1.0f, -2.0f, 3.0f}, 1.5f}, &shapes);
+    index.add(aShape, {{-0.5f, -3.5f, 1.5f}, {2.5f, -0.5f, 4.5f}});
+
+    Object3D b(&scene);
+    Shape<Shapes::Point3D> bShape(b, {{3.0f, -2.0f, 3.0f}}, &shapes);
+    index.add(bShape, {{3.0f, -2.0f, 3.0f}, {3.0f, -2.0f, 3.0f}});
+
+    /* Overlapping with the sphere, but in another group */
+    ShapeGroup3D otherShapes;
+    Object3D c(&scene);
+    Shape<Shapes::Point3D> cShape(c, {{1.0f, -2.0f, 3.0f}}, &otherShapes);
+    index.add(cShape, {{1.0f, -2.0f, 3.0f}, {1.0f, -2.0f, 3.0f}});
+
+    /* No collisions initially */
+    CORRADE_VERIFY(!shapes.firstCollision(aShape, index));
+    CORRADE_VERIFY(!shapes.firstCollision(bShape, index));
+
+    /* Move point into sphere */
+    b.translate(Vector3::xAxis(-1.0f));
+
+    /* Collision */
+    CORRADE_VERIFY(shapes.firstCollision(aShape, index) == &bShape);
+    CORRADE_VERIFY(shapes.firstCollision(bShape, index) == &aShape);
+}
+
+void ShapeTest::firstCollisionIndexCandidatesOnly() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+    ShapeIndex3D index{{Vector3{-10.0f}, Vector3{10.0f}}};
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> aShape(a, {{1.0f, -2.0f, 3.0f}, 1.5f}, &shapes);
+    index.add(aShape, {{-0.5f, -3.5f, 1.5f}, {2.5f, -0.5f, 4.5f}});
+
+    /* In the group, but not in the index and not in its scene */
+    Scene3D another;
+    Object3D b(&another);
+    Shape<Shapes::Point3D> bShape(b, {{1.0f, -2.0f, 3.0f}}, &shapes);
+
+    /* Moved, but only the scene of the index gets cleaned by the query */
+    a.translate(Vector3::xAxis(1.0f));
+    b.translate(Vector3::xAxis(1.0f));
+    CORRADE_VERIFY(shapes.isDirty());
+    CORRADE_VERIFY(!shapes.firstCollision(aShape, index));
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_VERIFY(shapes.isDirty());
+
+    /* The brute-force query cleans the whole group and finds the collision */
+    CORRADE_VERIFY(shapes.firstCollision(aShape) == &bShape);
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!shapes.isDirty());
+}
+
 void ShapeTest::shapeGroup() {
     Scene2D scene;
     ShapeGroup2D shapes;
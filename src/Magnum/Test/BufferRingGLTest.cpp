@@ -0,0 +1,192 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/BufferRing.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct BufferRingGLTest: AbstractOpenGLTester {
+    explicit BufferRingGLTest();
+
+    void construct();
+    void constructCopy();
+    void constructMove();
+
+    void setData();
+    void setDataGrow();
+    void setDataShrink();
+};
+
+BufferRingGLTest::BufferRingGLTest() {
+    addTests({&BufferRingGLTest::construct,
+              &BufferRingGLTest::constructCopy,
+              &BufferRingGLTest::constructMove,
+
+              &BufferRingGLTest::setData,
+              &BufferRingGLTest::setDataGrow,
+              &BufferRingGLTest::setDataShrink});
+}
+
+void BufferRingGLTest::construct() {
+    {
+        BufferRing ring{3, Buffer::TargetHint::ElementArray};
+
+        MAGNUM_VERIFY_NO_ERROR();
+        CORRADE_COMPARE(ring.count(), 3);
+        CORRADE_COMPARE(ring.current(), 2);
+        CORRADE_COMPARE(&ring.currentBuffer(), &ring[2]);
+        for(std::size_t i = 0; i != ring.count(); ++i) {
+            CORRADE_VERIFY(ring[i].id() > 0);
+            CORRADE_COMPARE(ring[i].targetHint(), Buffer::TargetHint::ElementArray);
+            CORRADE_COMPARE(ring.capacity(i), 0);
+        }
+        CORRADE_VERIFY(ring[0].id() != ring[1].id());
+        CORRADE_VERIFY(ring[1].id() != ring[2].id());
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void BufferRingGLTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<BufferRing, const BufferRing&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<BufferRing, const BufferRing&>{}));
+}
+
+void BufferRingGLTest::constructMove() {
+    BufferRing a{2};
+    const GLuint id = a[1].id();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(id > 0);
+
+    BufferRing b{std::move(a)};
+    CORRADE_COMPARE(b.count(), 2);
+    CORRADE_COMPARE(b[1].id(), id);
+
+    BufferRing c{1};
+    c = std::move(b);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(c.count(), 2);
+    CORRADE_COMPARE(c[1].id(), id);
+}
+
+void BufferRingGLTest::setData() {
+    BufferRing ring{3};
+
+    /* Each upload goes to the next buffer, wrapping around */
+    constexpr Int first[] = {2, 7, 5};
+    constexpr Int second[] = {13, 25, 1};
+    constexpr Int third[] = {8, 0, 4};
+    constexpr Int fourth[] = {3, 3, 9};
+    CORRADE_COMPARE(ring.setData(first, BufferUsage::StreamDraw), 0);
+    CORRADE_COMPARE(ring.setData(second, BufferUsage::StreamDraw), 1);
+    CORRADE_COMPARE(ring.setData(third, BufferUsage::StreamDraw), 2);
+    CORRADE_COMPARE(ring.current(), 2);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    for(std::size_t i = 0; i != ring.count(); ++i) {
+        CORRADE_COMPARE(ring.capacity(i), 3*4);
+        CORRADE_COMPARE(ring[i].size(), 3*4);
+    }
+
+    /* Reusing the first buffer orphans the storage of the same size */
+    CORRADE_COMPARE(ring.setData(fourth, BufferUsage::StreamDraw), 0);
+    CORRADE_COMPARE(ring.current(), 0);
+    CORRADE_COMPARE(&ring.currentBuffer(), &ring[0]);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(ring.capacity(0), 3*4);
+    CORRADE_COMPARE(ring[0].size(), 3*4);
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE_AS(ring[0].data<Int>(),
+        Containers::ArrayView<const Int>{fourth},
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ring[1].data<Int>(),
+        Containers::ArrayView<const Int>{second},
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ring[2].data<Int>(),
+        Containers::ArrayView<const Int>{third},
+        TestSuite::Compare::Container);
+    MAGNUM_VERIFY_NO_ERROR();
+    #endif
+}
+
+void BufferRingGLTest::setDataGrow() {
+    BufferRing ring{1};
+
+    constexpr Int small[] = {2, 7};
+    ring.setData(small, BufferUsage::StreamDraw);
+
+    /* Larger data reallocate the storage */
+    std::vector<Int> large{13, 25, 1, 8, 0};
+    CORRADE_COMPARE(ring.setData(large, BufferUsage::StreamDraw), 0);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(ring.capacity(0), 5*4);
+    CORRADE_COMPARE(ring[0].size(), 5*4);
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE_AS(ring[0].data<Int>(),
+        Containers::ArrayView<const Int>{large.data(), large.size()},
+        TestSuite::Compare::Container);
+    MAGNUM_VERIFY_NO_ERROR();
+    #endif
+}
+
+void BufferRingGLTest::setDataShrink() {
+    BufferRing ring{1};
+
+    constexpr Int large[] = {13, 25, 1, 8, 0};
+    ring.setData(large, BufferUsage::StreamDraw);
+
+    /* Smaller data keep the storage, only the beginning is filled */
+    constexpr Int small[] = {2, 7};
+    CORRADE_COMPARE(ring.setData(small, BufferUsage::StreamDraw), 0);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(ring.capacity(0), 5*4);
+    CORRADE_COMPARE(ring[0].size(), 5*4);
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE_AS(ring[0].subData<Int>(0, 2),
+        Containers::ArrayView<const Int>{small},
+        TestSuite::Compare::Container);
+    MAGNUM_VERIFY_NO_ERROR();
+    #endif
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::BufferRingGLTest)
@@ -28,6 +28,7 @@
 #cmakedefine MAGNUM_BUILD_DEPRECATED
 #cmakedefine MAGNUM_BUILD_STATIC
 #cmakedefine MAGNUM_BUILD_MULTITHREADED
+#cmakedefine MAGNUM_BUILD_SIMD
 #cmakedefine MAGNUM_TARGET_GLES
 #cmakedefine MAGNUM_TARGET_GLES2
 #cmakedefine MAGNUM_TARGET_GLES3
@@ -35,4 +36,12 @@
 #cmakedefine MAGNUM_TARGET_WEBGL
 #cmakedefine MAGNUM_TARGET_HEADLESS
 
+#ifdef MAGNUM_BUILD_SIMD
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define MAGNUM_TARGET_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MAGNUM_TARGET_NEON
+#endif
+#endif
+
 #endif